@@ -157,7 +157,7 @@ struct and_op_not
 {};
 
 template<class T>
-inline void swap_proxy(T& x, T& y, typename boost::move_detail::enable_if_c<!boost::move_detail::has_move_emulation_enabled_impl<T>::value>::type* = 0)
+inline BOOST_MOVE_CONSTEXPR20 void swap_proxy(T& x, T& y, typename boost::move_detail::enable_if_c<!boost::move_detail::has_move_emulation_enabled_impl<T>::value>::type* = 0)
 {
    //use std::swap if argument dependent lookup fails
    //Use using directive ("using namespace xxx;") instead as some older compilers
@@ -167,14 +167,14 @@ inline void swap_proxy(T& x, T& y, typename boost::move_detail::enable_if_c<!boo
 }
 
 template<class T>
-void swap_proxy(T& x, T& y
+BOOST_MOVE_CONSTEXPR20 void swap_proxy(T& x, T& y
                , typename boost::move_detail::enable_if< and_op_not_impl<boost::move_detail::has_move_emulation_enabled_impl<T>
                                                                         , boost_move_member_swap::has_member_swap<T> >
                                                        >::type* = 0)
 {  T t(::boost::move(x)); x = ::boost::move(y); y = ::boost::move(t);  }
 
 template<class T>
-inline void swap_proxy(T& x, T& y
+inline BOOST_MOVE_CONSTEXPR20 void swap_proxy(T& x, T& y
                , typename boost::move_detail::enable_if< and_op_impl< boost::move_detail::has_move_emulation_enabled_impl<T>
                                                                     , boost_move_member_swap::has_member_swap<T> >
                                                        >::type* = 0)
@@ -187,7 +187,7 @@ inline void swap_proxy(T& x, T& y
 namespace boost_move_adl_swap{
 
 template<class T>
-inline void swap_proxy(T& x, T& y)
+inline BOOST_MOVE_CONSTEXPR20 void swap_proxy(T& x, T& y)
 {
    using std::swap;
    swap(x, y);
@@ -200,7 +200,7 @@ inline void swap_proxy(T& x, T& y)
 namespace boost_move_adl_swap{
 
 template<class T, std::size_t N>
-void swap_proxy(T (& x)[N], T (& y)[N])
+BOOST_MOVE_CONSTEXPR20 void swap_proxy(T (& x)[N], T (& y)[N])
 {
    for (std::size_t i = 0; i < N; ++i){
       ::boost_move_adl_swap::swap_proxy(x[i], y[i]);
@@ -224,7 +224,7 @@ namespace boost{
 //!   -  Otherwise a move-based swap is called, equivalent to: 
 //!      <code>T t(::boost::move(x)); x = ::boost::move(y); y = ::boost::move(t);</code>.
 template<class T>
-inline void adl_move_swap(T& x, T& y)
+inline BOOST_MOVE_CONSTEXPR20 void adl_move_swap(T& x, T& y)
 {
    ::boost_move_adl_swap::swap_proxy(x, y);
 }
@@ -244,7 +244,7 @@ inline void adl_move_swap(T& x, T& y)
 //! Return value: Iterator to the element past the last element exchanged in the range
 //! beginning with first2.
 template<class ForwardIt1, class ForwardIt2>
-ForwardIt2 adl_move_swap_ranges(ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2)
+BOOST_MOVE_CONSTEXPR20 ForwardIt2 adl_move_swap_ranges(ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2)
 {
     while (first1 != last1) {
       ::boost::adl_move_swap(*first1, *first2);
@@ -255,7 +255,7 @@ ForwardIt2 adl_move_swap_ranges(ForwardIt1 first1, ForwardIt1 last1, ForwardIt2
 }
 
 template<class BidirIt1, class BidirIt2>
-BidirIt2 adl_move_swap_ranges_backward(BidirIt1 first1, BidirIt1 last1, BidirIt2 last2)
+BOOST_MOVE_CONSTEXPR20 BidirIt2 adl_move_swap_ranges_backward(BidirIt1 first1, BidirIt1 last1, BidirIt2 last2)
 {
    while (first1 != last1) {
       ::boost::adl_move_swap(*(--last1), *(--last2));
@@ -264,7 +264,7 @@ BidirIt2 adl_move_swap_ranges_backward(BidirIt1 first1, BidirIt1 last1, BidirIt2
 }
 
 template<class ForwardIt1, class ForwardIt2>
-void adl_move_iter_swap(ForwardIt1 a, ForwardIt2 b)
+BOOST_MOVE_CONSTEXPR20 void adl_move_iter_swap(ForwardIt1 a, ForwardIt2 b)
 {
    boost::adl_move_swap(*a, *b); 
 }
@@ -14,6 +14,7 @@
 
 #include <boost/move/detail/config_begin.hpp>
 #include <boost/move/algo/detail/adaptive_sort_merge.hpp>
+#include <boost/move/unique_array.hpp>
 #include <cassert>
 
 #if defined(BOOST_CLANG) || (defined(BOOST_GCC) && (BOOST_GCC >= 40600))
@@ -50,7 +51,6 @@ inline void adaptive_merge_combine_blocks( RandIt first
     if(n_keys){
       RandIt const first_data = first+collected;
       RandIt const keys = first;
-      BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   A combine: ", len);
       if(xbuf_used){
          if(xbuf.size() < l_block){
             xbuf.initialize_until(l_block, *first);
@@ -62,7 +62,6 @@ inline void adaptive_merge_combine_blocks( RandIt first
                            , n_block_a, n_block_b, l_irreg1, l_irreg2);   //Outputs
          op_merge_blocks_with_buf
             (keys, comp, first_data, l_block, l_irreg1, n_block_a, n_block_b, l_irreg2, comp, move_op(), xbuf.data());
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("   A mrg xbf: ", len);
       }
       else{
          size_type n_block_a, n_block_b, l_irreg1, l_irreg2;
@@ -73,12 +72,10 @@ inline void adaptive_merge_combine_blocks( RandIt first
             op_merge_blocks_with_buf
                ( keys, comp, first_data, l_block, l_irreg1, n_block_a, n_block_b
                , l_irreg2, comp, swap_op(), first_data-l_block);
-            BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   A mrg buf: ", len);
          }
          else{
             merge_blocks_bufferless
                (keys, comp, first_data, l_block, l_irreg1, n_block_a, n_block_b, l_irreg2, comp);
-            BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("   A mrg nbf: ", len);
          }
       }
    }
@@ -92,12 +89,11 @@ inline void adaptive_merge_combine_blocks( RandIt first
       combine_params( uint_keys, less(), l_combine
                      , l_combine1, l_block, xbuf
                      , n_block_a, n_block_b, l_irreg1, l_irreg2, true);   //Outputs
-      BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   A combine: ", len);
       assert(xbuf.size() >= l_block);
+      BOOST_MOVE_SCRATCH_RECORD_KEY_BYTES(sizeof(size_type)*(n_block_a + n_block_b));
       op_merge_blocks_with_buf
          (uint_keys, less(), first, l_block, l_irreg1, n_block_a, n_block_b, l_irreg2, comp, move_op(), xbuf.data());
       xbuf.clear();
-      BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("   A mrg buf: ", len);
    }
 }
 
@@ -122,10 +118,8 @@ inline void adaptive_merge_final_merge( RandIt first
       xbuf.clear();
       const size_type middle = xbuf_used && n_keys ? n_keys: collected;
       unstable_sort(first, first + middle, comp, xbuf);
-      BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   A k/b srt: ", len);
       stable_merge(first, first + middle, first + len, comp, xbuf);
    }
-   BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("   A fin mrg: ", len);
 }
 
 template<class SizeType>
@@ -221,18 +215,22 @@ inline SizeType adaptive_merge_n_keys_intbuf(SizeType &rl_block, SizeType len1,
 // * If auxiliary memory is more than csqrtlen+n_keys*sizeof(std::size_t),
 //   then no csqrtlen need to be extracted and "combine_blocks" will use integral
 //   keys to combine blocks.
-template<class RandIt, class Compare, class XBuf>
+template<class RandIt, class Compare, class XBuf, class Stats>
 void adaptive_merge_impl
    ( RandIt first
    , typename iter_size<RandIt>::type len1
    , typename iter_size<RandIt>::type len2
    , Compare comp
    , XBuf & xbuf
+   , Stats & stats
    )
 {
    typedef typename iter_size<RandIt>::type size_type;
 
    if(xbuf.capacity() >= min_value<size_type>(len1, len2)){
+      stats.record_strategy(adaptive_buffered_strategy);
+      stats.record_buffers(false, true);
+      stats.begin_phase(adaptive_final_merge_phase);
       buffered_merge( first, first+len1
                     , first + len1+len2, comp, xbuf);
    }
@@ -244,6 +242,8 @@ void adaptive_merge_impl
       //One range is not big enough to extract keys and the internal buffer so a
       //rotation-based based merge will do just fine
       if(len1 <= l_block*2 || len2 <= l_block*2){
+         stats.record_strategy(adaptive_rotation_strategy);
+         stats.begin_phase(adaptive_final_merge_phase);
          merge_bufferless(first, first+len1, first+len1+len2, comp);
          return;
       }
@@ -255,10 +255,12 @@ void adaptive_merge_impl
       size_type const to_collect = size_type(l_intbuf+n_keys);
       //Try to extract needed unique values from the first range
       size_type const collected  = collect_unique(first, first+len1, to_collect, comp, xbuf);
-      BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("\n   A collect: ", len);
+      stats.record_keys(to_collect, collected);
 
       //Not the minimum number of keys is not available on the first range, so fallback to rotations
       if(collected != to_collect && collected < 4){
+         stats.record_strategy(adaptive_rotation_strategy);
+         stats.begin_phase(adaptive_final_merge_phase);
          merge_bufferless(first, first+collected, first+len1, comp);
          merge_bufferless(first, first + len1, first + len1 + len2, comp);
          return;
@@ -275,13 +277,51 @@ void adaptive_merge_impl
       }
 
       bool const xbuf_used = collected == to_collect && xbuf.capacity() >= l_block;
+      stats.record_strategy(adaptive_block_strategy);
+      stats.record_block(l_block, l_intbuf);
+      stats.record_buffers(n_keys && !xbuf_used && use_internal_buf, xbuf_used || !n_keys);
+      stats.record_merge_pass();
       //Merge trailing elements using smart merges
+      stats.begin_phase(adaptive_combine_phase);
       adaptive_merge_combine_blocks(first, len1, len2, collected,   n_keys, l_block, use_internal_buf, xbuf_used, comp, xbuf);
       //Merge buffer and keys with the rest of the values
+      stats.begin_phase(adaptive_final_merge_phase);
       adaptive_merge_final_merge   (first, len1, len2, collected, l_intbuf, l_block, use_internal_buf, xbuf_used, comp, xbuf);
    }
 }
 
+//Reduces [first, last) skipping leading and trailing elements that are already
+//in place. Returns false if no element needs to be merged.
+template<class RandIt, class Compare>
+bool adaptive_merge_trim(RandIt &first, RandIt const middle, RandIt &last, Compare comp)
+{
+   if (first == middle || middle == last){
+      return false;
+   }
+
+   do {
+      if (comp(*middle, *first)){
+         break;
+      }
+      ++first;
+      if (first == middle)
+         return false;
+   } while(1);
+
+   RandIt first_high(middle);
+   --first_high;
+   do {
+      --last;
+      if (comp(*last, *first_high)){
+         ++last;
+         break;
+      }
+      if (last == middle)
+         return false;
+   } while(1);
+   return true;
+}
+
 }  //namespace detail_adaptive {
 
 ///@endcond
@@ -323,34 +363,95 @@ void adaptive_merge( RandIt first, RandIt middle, RandIt last, Compare comp
    typedef typename iter_size<RandIt>::type  size_type;
    typedef typename iterator_traits<RandIt>::value_type value_type;
 
-   if (first == middle || middle == last){
+   //Reduce ranges to merge if possible
+   if(!::boost::movelib::detail_adaptive::adaptive_merge_trim(first, middle, last, comp)){
       return;
    }
 
+   ::boost::movelib::adaptive_xbuf<value_type, value_type*, size_type> xbuf(uninitialized, size_type(uninitialized_len));
+   ::boost::movelib::detail_adaptive::null_stats stats;
+   ::boost::movelib::detail_adaptive::adaptive_merge_impl(first, size_type(middle - first), size_type(last - middle), comp, xbuf, stats);
+}
+
+//! <b>Effects</b>: Same as the previous overload, but records in "stats" the strategy, the key
+//!   and buffer configuration chosen, and comparisons and moves performed in each phase.
+//!   Previous contents of "stats" (except its move counter) are overwritten.
+//!
+//! <b>Note</b>: Comparisons done to skip elements already in place are attributed to the collect phase.
+template<class RandIt, class Compare>
+void adaptive_merge( RandIt first, RandIt middle, RandIt last, Compare comp
+                , typename iterator_traits<RandIt>::value_type* uninitialized
+                , typename iter_size<RandIt>::type uninitialized_len
+                , adaptive_stats &stats)
+{
+   typedef typename iter_size<RandIt>::type  size_type;
+   typedef typename iterator_traits<RandIt>::value_type value_type;
+
+   stats.clear();
+   stats.begin(std::size_t(last - first), std::size_t(uninitialized_len));
+   ::boost::movelib::detail_adaptive::stats_compare<Compare> scomp(comp, stats);
+   if(::boost::movelib::detail_adaptive::adaptive_merge_trim(first, middle, last, scomp)){
+      ::boost::movelib::adaptive_xbuf<value_type, value_type*, size_type> xbuf(uninitialized, size_type(uninitialized_len));
+      ::boost::movelib::detail_adaptive::adaptive_merge_impl
+         (first, size_type(middle - first), size_type(last - middle), scomp, xbuf, stats);
+   }
+   stats.end();
+}
+
+//! <b>Effects</b>: Same as the overload taking raw storage, but the external buffer is obtained from "a".
+//!   min(std::distance(first, middle), std::distance(middle, last)) elements (the ideal length) are
+//!   requested first. If that fails, ceil(sqrt(std::distance(first, last)))*2 elements are requested
+//!   and, if that also fails, ranges are merged without external buffer. No more than "max_elements"
+//!   elements are requested. Nothing is allocated if elements are already in place.
+//!   The buffer is deallocated before returning.
+//!
+//! <b>Requires</b>:
+//!   - Allocator::value_type must be iterator_traits<RandIt>::value_type and a.allocate(n) must return
+//!     a pointer to value_type. Memory resources can be used through polymorphic allocators
+//!     (e.g. std::pmr::polymorphic_allocator<value_type>).
+//!   - Allocator can't be a pointer or an iterator, as those select the raw storage overload.
+//!
+//! <b>Throws</b>: If comp throws or the move constructor, move assignment or swap of the type
+//!   of dereferenced RandIt throws. Allocation failures are not propagated.
+//!
+//! <b>Caution</b>: Experimental implementation, not production-ready.
+template<class RandIt, class Compare, class Allocator>
+typename ::boost::move_detail::disable_if_c
+   < ::boost::movelib::detail_adaptive::is_raw_storage<Allocator>::value, void >::type
+   adaptive_merge( RandIt first, RandIt middle, RandIt last, Compare comp
+                 , const Allocator &a, std::size_t max_elements = std::size_t(-1))
+{
+   typedef typename iter_size<RandIt>::type  size_type;
+   typedef typename iterator_traits<RandIt>::value_type value_type;
+   BOOST_MOVE_STATIC_ASSERT((::boost::move_detail::is_same<typename Allocator::value_type, value_type>::value));
+
    //Reduce ranges to merge if possible
-   do {
-      if (comp(*middle, *first)){
-         break;
-      }
-      ++first;
-      if (first == middle)
-         return;
-   } while(1);
+   if(!::boost::movelib::detail_adaptive::adaptive_merge_trim(first, middle, last, comp)){
+      return;
+   }
 
-   RandIt first_high(middle);
-   --first_high;
-   do {
-      --last;
-      if (comp(*last, *first_high)){
-         ++last;
-         break;
-      }
-      if (last == middle)
-         return;
-   } while(1);
+   size_type const len1 = size_type(middle - first);
+   size_type const len2 = size_type(last - middle);
+   ::boost::movelib::detail_adaptive::allocator_raw_buffer<value_type, Allocator> buf(a);
+   ::boost::movelib::detail_adaptive::allocate_adaptive_buffer
+      ( buf, std::size_t(len1 < len2 ? len1 : len2)
+      , std::size_t(2u*::boost::movelib::detail_adaptive::ceil_sqrt(size_type(len1 + len2))), max_elements);
+   ::boost::movelib::adaptive_xbuf<value_type, value_type*, size_type> xbuf(buf.data(), size_type(buf.size()));
+   ::boost::movelib::detail_adaptive::null_stats stats;
+   ::boost::movelib::detail_adaptive::adaptive_merge_impl(first, len1, len2, comp, xbuf, stats);
+}
 
-   ::boost::movelib::adaptive_xbuf<value_type, value_type*, size_type> xbuf(uninitialized, size_type(uninitialized_len));
-   ::boost::movelib::detail_adaptive::adaptive_merge_impl(first, size_type(middle - first), size_type(last - middle), comp, xbuf);
+//! <b>Effects</b>: Same as the overload taking raw storage, using the spare storage of "buffer"
+//!   (buffer.spare_data(), buffer.spare_capacity()) as external buffer, e.g. a buffer created with
+//!   make_unique_array_uninit. Elements constructed in "buffer" are not modified.
+//!
+//! <b>Caution</b>: Experimental implementation, not production-ready.
+template<class RandIt, class Compare>
+void adaptive_merge( RandIt first, RandIt middle, RandIt last, Compare comp
+                   , unique_array<typename iterator_traits<RandIt>::value_type> &buffer)
+{
+   typedef typename iter_size<RandIt>::type  size_type;
+   adaptive_merge(first, middle, last, comp, buffer.spare_data(), size_type(buffer.spare_capacity()));
 }
 
 }  //namespace movelib {
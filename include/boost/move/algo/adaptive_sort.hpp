@@ -15,6 +15,7 @@
 #include <boost/move/detail/config_begin.hpp>
 
 #include <boost/move/algo/detail/adaptive_sort_merge.hpp>
+#include <boost/move/unique_array.hpp>
 #include <cassert>
 
 #if defined(BOOST_CLANG) || (defined(BOOST_GCC) && (BOOST_GCC >= 40600))
@@ -198,7 +199,6 @@ void adaptive_sort_combine_blocks
          combine_params( keys, key_comp, l_cur_combined
                         , l_prev_merged, l_block, rbuf
                         , n_block_a, n_block_b, l_irreg1, l_irreg2);   //Outputs
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   A combpar:            ", len + l_block);
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(combined_first, combined_first + n_block_a*l_block+l_irreg1, comp));
             BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(combined_first + n_block_a*l_block+l_irreg1, combined_first + n_block_a*l_block+l_irreg1+n_block_b*l_block+l_irreg2, comp));
          if(!use_buf){
@@ -209,7 +209,6 @@ void adaptive_sort_combine_blocks
             merge_blocks_left
                (keys, key_comp, combined_first, l_block, 0u, n_block_a, n_block_b, l_irreg2, comp, xbuf_used);
          }
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   After merge_blocks_L: ", len + l_block);
          ++combined_i;
          if(combined_i != max_i)
             combined_first += l_reg_combined;
@@ -228,12 +227,10 @@ void adaptive_sort_combine_blocks
          combine_params( keys, key_comp, l_cur_combined
                         , l_prev_merged, l_block, rbuf
                         , n_block_a, n_block_b, l_irreg1, l_irreg2);  //Outputs
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   A combpar:            ", len + l_block);
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(combined_first, combined_first + n_block_a*l_block+l_irreg1, comp));
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(combined_first + n_block_a*l_block+l_irreg1, combined_first + n_block_a*l_block+l_irreg1+n_block_b*l_block+l_irreg2, comp));
          merge_blocks_right
             (keys, key_comp, combined_first, l_block, n_block_a, n_block_b, l_irreg2, comp, xbuf_used);
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   After merge_blocks_R: ", len + l_block);
          if(combined_i)
             combined_first -= l_reg_combined;
       }
@@ -243,7 +240,7 @@ void adaptive_sort_combine_blocks
 //Returns true if buffer is placed in 
 //[buffer+len-l_intbuf, buffer+len). Otherwise, buffer is
 //[buffer,buffer+l_intbuf)
-template<class RandIt, class Compare, class XBuf>
+template<class RandIt, class Compare, class XBuf, class Stats>
 bool adaptive_sort_combine_all_blocks
    ( RandIt keys
    , typename iter_size<RandIt>::type &n_keys
@@ -252,7 +249,8 @@ bool adaptive_sort_combine_all_blocks
    , typename iter_size<RandIt>::type l_merged
    , typename iter_size<RandIt>::type &l_intbuf
    , XBuf & xbuf
-   , Compare comp)
+   , Compare comp
+   , Stats & stats)
 {
    typedef typename iter_size<RandIt>::type       size_type;
 
@@ -265,7 +263,9 @@ bool adaptive_sort_combine_all_blocks
       xbuf.move_assign(buffer, l_intbuf);
    }
 
-   bool prev_merge_left = true;
+   //If build_blocks already merged all data no pass is performed
+   //and the buffer stays on the left (buffer_right must be false)
+   bool prev_merge_left = false;
    size_type l_prev_total_combined = l_merged, l_prev_block = 0;
    bool prev_use_internal_buf = true;
 
@@ -282,6 +282,9 @@ bool adaptive_sort_combine_all_blocks
       assert(!l_intbuf || (l_block == l_intbuf));
       assert(n == 0 || (!use_internal_buf || prev_use_internal_buf) );
       assert(n == 0 || (!use_internal_buf || l_prev_block == l_block) );
+      stats.record_merge_pass();
+      stats.record_block(l_block, use_internal_buf ? l_block : 0u);
+      stats.record_buffers(use_internal_buf, common_xbuf || !n_keys);
       
       bool const is_merge_left = (n&1) == 0;
       size_type const l_total_combined = calculate_total_combined(l_data, l_merged);
@@ -302,7 +305,6 @@ bool adaptive_sort_combine_all_blocks
                move_data_forward(buf_end, l_diff, buf_beg, common_xbuf);
             }
          }
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   After move_data     : ", l_data + l_intbuf);
       }
 
       //Combine to form l_merged*2 segments
@@ -322,12 +324,13 @@ bool adaptive_sort_combine_all_blocks
       }
       else{
          size_type *const uint_keys = xbuf.template aligned_trailing<size_type>();
+         BOOST_MOVE_SCRATCH_RECORD_KEY_BYTES
+            (sizeof(size_type)*(((size_type(2u*l_merged) < l_data ? size_type(2u*l_merged) : l_data) + l_block - 1u)/l_block));
          adaptive_sort_combine_blocks
             ( uint_keys, less(), !use_internal_buf || is_merge_left ? first : first-l_block
             , l_data, l_merged, l_block, use_internal_buf, common_xbuf, xbuf, comp, is_merge_left);
       }
 
-      BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1(is_merge_left ? "   After comb blocks L:  " : "   After comb blocks R:  ", l_data + l_intbuf);
       prev_merge_left = is_merge_left;
       l_prev_total_combined = l_total_combined;
       l_prev_block = l_block;
@@ -388,14 +391,14 @@ void adaptive_sort_final_merge( bool buffer_right
          stable_merge(first, first+n_key_plus_buf, first+len, comp, xbuf);
       }
    }
-   BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("   After final_merge   : ", len);
 }
 
-template<class RandIt, class Compare, class Unsigned, class XBuf>
+template<class RandIt, class Compare, class Unsigned, class XBuf, class Stats>
 bool adaptive_sort_build_params
    (RandIt first, Unsigned const len, Compare comp
    , Unsigned &n_keys, Unsigned &l_intbuf, Unsigned &l_base, Unsigned &l_build_buf
    , XBuf & xbuf
+   , Stats & stats
    )
 {
    typedef typename iter_size<RandIt>::type         size_type;
@@ -442,6 +445,7 @@ bool adaptive_sort_build_params
       bool const non_unique_buf = xbuf.capacity() >= l_intbuf;
       size_type const to_collect = non_unique_buf ? n_min_ideal_keys : size_type(l_intbuf*2u);
       size_type collected = collect_unique(first, first+len, to_collect, comp, xbuf);
+      stats.record_keys(to_collect, collected);
 
       //If available memory is 2*sqrt(l), then for "build_params" 
       //the situation is the same as if 2*l_intbuf were collected.
@@ -539,21 +543,27 @@ bool adaptive_sort_build_params
 //
 // * If auxiliary memory is available, the "build_blocks" will be extended to build bigger blocks
 //   using classic merge and "combine_blocks" will use bigger blocks when merging.
-template<class RandIt, class Compare, class XBuf>
+template<class RandIt, class Compare, class XBuf, class Stats>
 void adaptive_sort_impl
    ( RandIt first
    , typename iter_size<RandIt>::type const len
    , Compare comp
    , XBuf & xbuf
+   , Stats & stats
    )
 {
    typedef typename iter_size<RandIt>::type         size_type;
 
    //Small sorts go directly to insertion sort
    if(len <= size_type(AdaptiveSortInsertionSortThreshold)){
+      stats.record_strategy(adaptive_trivial_strategy);
+      stats.begin_phase(adaptive_final_merge_phase);
       insertion_sort(first, first + len, comp);
    }
    else if((len-len/2) <= xbuf.capacity()){
+      stats.record_strategy(adaptive_buffered_strategy);
+      stats.record_buffers(false, true);
+      stats.begin_phase(adaptive_final_merge_phase);
       merge_sort(first, first+len, comp, xbuf.data());
    }
    else{
@@ -567,29 +577,35 @@ void adaptive_sort_impl
 
       //Calculate and extract needed unique elements. If a minimum is not achieved
       //fallback to a slow stable sort
-      if(!adaptive_sort_build_params(first, len, comp, n_keys, l_intbuf, l_base, l_build_buf, xbuf)){
+      if(!adaptive_sort_build_params(first, len, comp, n_keys, l_intbuf, l_base, l_build_buf, xbuf, stats)){
+         stats.record_strategy(adaptive_rotation_strategy);
+         stats.begin_phase(adaptive_final_merge_phase);
          stable_sort(first, first+len, comp, xbuf);
       }
       else{
          assert(l_build_buf);
+         stats.record_strategy(adaptive_block_strategy);
+         stats.record_block(l_build_buf, l_intbuf);
          //Otherwise, continue the adaptive_sort
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("\n   After collect_unique: ", len);
          size_type const n_key_plus_buf = size_type(l_intbuf+n_keys);
          //l_build_buf is always power of two if l_intbuf is zero
          assert(l_intbuf || (0 == (l_build_buf & (l_build_buf-1))));
 
          //Classic merge sort until internal buffer and xbuf are exhausted
+         stats.begin_phase(adaptive_build_phase);
+         stats.record_buffers(l_intbuf != 0, xbuf.capacity() >= l_base);
          size_type const l_merged = adaptive_sort_build_blocks
             ( first + n_key_plus_buf-l_build_buf
             , size_type(len-n_key_plus_buf+l_build_buf)
             , l_base, l_build_buf, xbuf, comp);
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1("   After build_blocks:   ", len);
 
          //Non-trivial merge
+         stats.begin_phase(adaptive_combine_phase);
          bool const buffer_right = adaptive_sort_combine_all_blocks
-            (first, n_keys, first+n_keys, size_type(len-n_keys), l_merged, l_intbuf, xbuf, comp);
+            (first, n_keys, first+n_keys, size_type(len-n_keys), l_merged, l_intbuf, xbuf, comp, stats);
 
          //Sort keys and buffer and merge the whole sequence
+         stats.begin_phase(adaptive_final_merge_phase);
          adaptive_sort_final_merge(buffer_right, first, l_intbuf, n_keys, len, xbuf, comp);
       }
    }
@@ -633,7 +649,30 @@ void adaptive_sort( RandIt first, RandIt last, Compare comp
    typedef typename iterator_traits<RandIt>::value_type value_type;
 
    ::boost::movelib::adaptive_xbuf<value_type, RandRawIt, size_type> xbuf(uninitialized, uninitialized_len);
-   ::boost::movelib::detail_adaptive::adaptive_sort_impl(first, size_type(last - first), comp, xbuf);
+   ::boost::movelib::detail_adaptive::null_stats stats;
+   ::boost::movelib::detail_adaptive::adaptive_sort_impl(first, size_type(last - first), comp, xbuf, stats);
+}
+
+//! <b>Effects</b>: Same as the previous overload, but records in "stats" the strategy, the key
+//!   and buffer configuration chosen, and comparisons and moves performed in each phase.
+//!   Previous contents of "stats" (except its move counter) are overwritten.
+//!
+//! <b>Note</b>: Comparisons are counted through a wrapper of "comp", so they include key comparisons.
+template<class RandIt, class RandRawIt, class Compare>
+void adaptive_sort( RandIt first, RandIt last, Compare comp
+               , RandRawIt uninitialized
+               , typename iter_size<RandIt>::type uninitialized_len
+               , adaptive_stats &stats)
+{
+   typedef typename iter_size<RandIt>::type  size_type;
+   typedef typename iterator_traits<RandIt>::value_type value_type;
+
+   ::boost::movelib::adaptive_xbuf<value_type, RandRawIt, size_type> xbuf(uninitialized, uninitialized_len);
+   stats.clear();
+   stats.begin(std::size_t(last - first), std::size_t(uninitialized_len));
+   ::boost::movelib::detail_adaptive::stats_compare<Compare> scomp(comp, stats);
+   ::boost::movelib::detail_adaptive::adaptive_sort_impl(first, size_type(last - first), scomp, xbuf, stats);
+   stats.end();
 }
 
 template<class RandIt, class Compare>
@@ -643,6 +682,55 @@ void adaptive_sort( RandIt first, RandIt last, Compare comp)
    adaptive_sort(first, last, comp, (value_type*)0, 0u);
 }
 
+//! <b>Effects</b>: Same as the overload taking raw storage, but the external buffer is obtained from "a".
+//!   ceil(std::distance(first, last)/2) elements (the ideal length) are requested first. If that fails,
+//!   approximately ceil(sqrt(std::distance(first, last)))*2 elements are requested and, if that also fails,
+//!   the range is sorted without external buffer. No more than "max_elements" elements are requested.
+//!   The buffer is deallocated before returning.
+//!
+//! <b>Requires</b>:
+//!   - Allocator::value_type must be iterator_traits<RandIt>::value_type and a.allocate(n) must return
+//!     a pointer to value_type. Memory resources can be used through polymorphic allocators
+//!     (e.g. std::pmr::polymorphic_allocator<value_type>).
+//!   - Allocator can't be a pointer or an iterator, as those select the raw storage overload.
+//!
+//! <b>Throws</b>: If comp throws or the move constructor, move assignment or swap of the type
+//!   of dereferenced RandIt throws. Allocation failures are not propagated.
+//!
+//! <b>Caution</b>: Experimental implementation, not production-ready.
+template<class RandIt, class Compare, class Allocator>
+typename ::boost::move_detail::disable_if_c
+   < ::boost::movelib::detail_adaptive::is_raw_storage<Allocator>::value, void >::type
+   adaptive_sort( RandIt first, RandIt last, Compare comp
+                , const Allocator &a, std::size_t max_elements = std::size_t(-1))
+{
+   typedef typename iter_size<RandIt>::type  size_type;
+   typedef typename iterator_traits<RandIt>::value_type value_type;
+   BOOST_MOVE_STATIC_ASSERT((::boost::move_detail::is_same<typename Allocator::value_type, value_type>::value));
+
+   size_type const len = size_type(last - first);
+   ::boost::movelib::detail_adaptive::allocator_raw_buffer<value_type, Allocator> buf(a);
+   if(len > ::boost::movelib::detail_adaptive::AdaptiveSortInsertionSortThreshold){
+      ::boost::movelib::detail_adaptive::allocate_adaptive_buffer
+         ( buf, std::size_t(len - len/2u)
+         , std::size_t(2u*::boost::movelib::detail_adaptive::ceil_sqrt_multiple(len)), max_elements);
+   }
+   adaptive_sort(first, last, comp, buf.data(), size_type(buf.size()));
+}
+
+//! <b>Effects</b>: Same as the overload taking raw storage, using the spare storage of "buffer"
+//!   (buffer.spare_data(), buffer.spare_capacity()) as external buffer, e.g. a buffer created with
+//!   make_unique_array_uninit. Elements constructed in "buffer" are not modified.
+//!
+//! <b>Caution</b>: Experimental implementation, not production-ready.
+template<class RandIt, class Compare>
+void adaptive_sort( RandIt first, RandIt last, Compare comp
+                  , unique_array<typename iterator_traits<RandIt>::value_type> &buffer)
+{
+   typedef typename iter_size<RandIt>::type  size_type;
+   adaptive_sort(first, last, comp, buffer.spare_data(), size_type(buffer.spare_capacity()));
+}
+
 }  //namespace movelib {
 }  //namespace boost {
 
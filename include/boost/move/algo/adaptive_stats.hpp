@@ -0,0 +1,251 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+
+#ifndef BOOST_MOVE_ALGO_ADAPTIVE_STATS_HPP
+#define BOOST_MOVE_ALGO_ADAPTIVE_STATS_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace movelib {
+
+//! Phases of [funcref boost::movelib::adaptive_sort adaptive_sort] and
+//! [funcref boost::movelib::adaptive_merge adaptive_merge] statistics are recorded for.
+enum adaptive_phase
+{
+   //! Unique key extraction (and, for adaptive_merge, trimming of already placed elements)
+   adaptive_collect_phase,
+   //! Classic buffered merge steps of adaptive_sort ("build_blocks")
+   adaptive_build_phase,
+   //! Block merges using keys as markers ("combine_blocks")
+   adaptive_combine_phase,
+   //! Merge of keys and internal buffer with the rest of the range. Strategies
+   //! that don't use blocks perform all their work in this phase.
+   adaptive_final_merge_phase,
+   adaptive_phase_count
+};
+
+//! Strategies [funcref boost::movelib::adaptive_sort adaptive_sort] and
+//! [funcref boost::movelib::adaptive_merge adaptive_merge] choose from.
+enum adaptive_strategy
+{
+   //! The range was too short (insertion sort) or no work was needed
+   adaptive_trivial_strategy,
+   //! External buffer was big enough for a classic merge sort or buffered merge
+   adaptive_buffered_strategy,
+   //! Not enough unique keys were found, rotation based algorithms were used
+   adaptive_rotation_strategy,
+   //! Keys and blocks were used to merge
+   adaptive_block_strategy
+};
+
+//! Statistics sink for [funcref boost::movelib::adaptive_sort adaptive_sort] and
+//! [funcref boost::movelib::adaptive_merge adaptive_merge]. Pass an instance to the
+//! overloads taking an adaptive_stats argument to record the decisions taken by the algorithm
+//! and the work done in each phase. Overloads without this argument don't record anything
+//! and have no overhead.
+//!
+//! Comparisons are counted by the algorithm. Moves can't be observed by the algorithm,
+//! so if move_counter is not null it's sampled at each phase boundary and the difference is
+//! attributed to the finished phase. Typically it returns a counter incremented by the
+//! move constructor and assignment of an instrumented type.
+struct adaptive_stats
+{
+   typedef std::size_t (*counter_function)();
+
+   //! <b>Effects</b>: Zero-initializes all statistics and stores the move counter.
+   explicit adaptive_stats(counter_function move_cnt = 0)
+      : move_counter(move_cnt)
+   {  this->clear();  }
+
+   //! <b>Effects</b>: Zero-initializes all statistics. move_counter is not modified.
+   void clear()
+   {
+      length = xbuf_capacity = 0u;
+      strategy = adaptive_trivial_strategy;
+      keys_requested = keys_collected = 0u;
+      block_length = internal_buffer_length = 0u;
+      used_internal_buffer = used_xbuf = false;
+      merge_passes = 0u;
+      for(std::size_t i = 0; i != adaptive_phase_count; ++i){
+         comparisons[i] = 0u;
+         moves[i] = 0u;
+      }
+      current_phase = adaptive_collect_phase;
+      m_last_moves = 0u;
+   }
+
+   //! <b>Returns</b>: Comparisons performed in all phases.
+   std::size_t total_comparisons() const
+   {
+      std::size_t r = 0u;
+      for(std::size_t i = 0; i != adaptive_phase_count; ++i){
+         r += comparisons[i];
+      }
+      return r;
+   }
+
+   //! <b>Returns</b>: Moves performed in all phases (always zero if move_counter is null).
+   std::size_t total_moves() const
+   {
+      std::size_t r = 0u;
+      for(std::size_t i = 0; i != adaptive_phase_count; ++i){
+         r += moves[i];
+      }
+      return r;
+   }
+
+   counter_function move_counter;
+
+   //! Number of elements to sort or merge
+   std::size_t length;
+   //! Capacity of the external buffer, in elements
+   std::size_t xbuf_capacity;
+   adaptive_strategy strategy;
+   //! Unique elements the algorithm tried to extract to be used as keys and internal buffer
+   std::size_t keys_requested;
+   //! Unique elements actually found. If less than keys_requested, the input had few distinct values
+   std::size_t keys_collected;
+   //! Length of blocks merged in the last combine step
+   std::size_t block_length;
+   //! Length of the internal buffer made of unique elements (zero if none was used)
+   std::size_t internal_buffer_length;
+   //! True if unique elements of the input were used as merge buffer
+   bool used_internal_buffer;
+   //! True if the external buffer was used to hold elements or integral keys
+   bool used_xbuf;
+   //! Number of "combine_blocks" passes
+   std::size_t merge_passes;
+   std::size_t comparisons[adaptive_phase_count];
+   std::size_t moves[adaptive_phase_count];
+   adaptive_phase current_phase;
+
+   ///@cond
+   //Hooks called by the algorithms
+
+   void begin(std::size_t len, std::size_t xbuf_cap)
+   {
+      length = len;
+      xbuf_capacity = xbuf_cap;
+      current_phase = adaptive_collect_phase;
+      m_last_moves = move_counter ? move_counter() : 0u;
+   }
+
+   void begin_phase(adaptive_phase p)
+   {
+      this->sample_moves();
+      current_phase = p;
+   }
+
+   void end()
+   {  this->sample_moves();  }
+
+   void record_strategy(adaptive_strategy s)
+   {  strategy = s;  }
+
+   void record_keys(std::size_t requested, std::size_t collected)
+   {
+      keys_requested = requested;
+      keys_collected = collected;
+   }
+
+   void record_block(std::size_t l_block, std::size_t l_intbuf)
+   {
+      block_length = l_block;
+      internal_buffer_length = l_intbuf;
+   }
+
+   void record_buffers(bool internal_buf, bool xbuf)
+   {
+      used_internal_buffer = used_internal_buffer || internal_buf;
+      used_xbuf = used_xbuf || xbuf;
+   }
+
+   void record_merge_pass()
+   {  ++merge_passes;  }
+
+   void record_comparison()
+   {  ++comparisons[current_phase];  }
+
+   private:
+   void sample_moves()
+   {
+      if(move_counter){
+         std::size_t const now = move_counter();
+         moves[current_phase] += now - m_last_moves;
+         m_last_moves = now;
+      }
+   }
+
+   std::size_t m_last_moves;
+   ///@endcond
+};
+
+///@cond
+
+namespace detail_adaptive {
+
+//Used when no statistics are requested. All hooks are empty
+//so that calls are optimized away.
+struct null_stats
+{
+   void begin(std::size_t, std::size_t) {}
+   void begin_phase(adaptive_phase) {}
+   void end() {}
+   void record_strategy(adaptive_strategy) {}
+   void record_keys(std::size_t, std::size_t) {}
+   void record_block(std::size_t, std::size_t) {}
+   void record_buffers(bool, bool) {}
+   void record_merge_pass() {}
+};
+
+//Counts comparisons in the current phase of the stats object
+template<class Comp>
+class stats_compare
+{
+   public:
+   stats_compare(Comp comp, adaptive_stats &stats)
+      : m_comp(comp), m_stats(&stats)
+   {}
+
+   template <class T1, class T2>
+   inline bool operator()(const T1& l, const T2& r)
+   {
+      m_stats->record_comparison();
+      return m_comp(l, r);
+   }
+
+   private:
+   Comp m_comp;
+   adaptive_stats *m_stats;
+};
+
+}  //namespace detail_adaptive {
+
+///@endcond
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#define BOOST_MOVE_ALGO_ADAPTIVE_STATS_HPP
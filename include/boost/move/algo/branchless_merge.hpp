@@ -0,0 +1,322 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Branch-free selection of the next element in merge kernels.
+
+#ifndef BOOST_MOVE_ALGO_BRANCHLESS_MERGE_HPP
+#define BOOST_MOVE_ALGO_BRANCHLESS_MERGE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/detail/iterator_to_raw_pointer.hpp>
+#include <boost/move/algo/move.hpp>
+#include <cstddef>
+
+#include <boost/move/detail/std_ns_begin.hpp>
+BOOST_MOVE_STD_NS_BEG
+
+template<class T>
+struct less;
+
+template<class T>
+struct greater;
+
+BOOST_MOVE_STD_NS_END
+#include <boost/move/detail/std_ns_end.hpp>
+
+//! By default, trivially copyable elements up to this size are merged without
+//! branches (see [classref boost::movelib::branchless_merge branchless_merge]).
+#if !defined(BOOST_MOVE_BRANCHLESS_MERGE_MAX_SIZE)
+#  define BOOST_MOVE_BRANCHLESS_MERGE_MAX_SIZE 16
+#endif
+
+namespace boost {
+namespace movelib {
+
+//! Merge kernels of merge_sort, adaptive_sort and adaptive_merge (and the
+//! algorithms built on them) select the next element without branching when
+//! merging contiguous ranges of T if this trait is true: the comparison result
+//! selects the source address and advances the cursors arithmetically, so
+//! the processor does not mispredict about half of the steps on random data.
+//! Before each batch of 8 steps two extra comparisons check if the next 8
+//! elements come from the same range, to move them at once (as a predicted
+//! branch does with clustered or presorted data).
+//!
+//! It pays off when moving T is a plain copy and comparisons are cheap and inlined,
+//! so it's only used if [classref boost::movelib::branchless_merge_compare branchless_merge_compare]
+//! is also true for the comparison. By default it's true if T is trivially copyable
+//! (trivially copy constructible, copy assignable and destructible, as elements are also
+//! constructed in and destroyed from buffers) and sizeof(T) <= BOOST_MOVE_BRANCHLESS_MERGE_MAX_SIZE.
+//!
+//! Users can specialize it to enable or disable branch-free merges for their types.
+//! Defining BOOST_MOVE_NO_BRANCHLESS_MERGE disables it for all types.
+template<class T>
+struct branchless_merge
+{
+   static const bool value = ::boost::move_detail::is_trivially_copy_constructible<T>::value &&
+      ::boost::move_detail::is_trivially_copy_assignable<T>::value &&
+      ::boost::move_detail::is_trivially_destructible<T>::value &&
+      sizeof(T) <= std::size_t(BOOST_MOVE_BRANCHLESS_MERGE_MAX_SIZE);
+};
+
+//! If this trait yields to true (<i>branchless_merge_compare&lt;Compare, T&gt;::value == true</i>)
+//! comparing elements of type T with Compare is cheap enough to pay the extra comparisons of
+//! branch-free merges (see [classref boost::movelib::branchless_merge branchless_merge]).
+//!
+//! By default this trait is true for std::less and std::greater comparing arithmetic, enumeration
+//! or pointer types, also when they are adapted by the comparison wrappers used by the
+//! algorithms. Users can specialize it for their own comparators (e.g. one that compares an
+//! integer key), but not for comparators that follow pointers or call functions like strcmp.
+template<class Compare, class T>
+struct branchless_merge_compare
+{
+   static const bool value = false;
+};
+
+///@cond
+
+template<class Comp>
+struct antistable;
+
+template<class Comp>
+class negate;
+
+template<class Comp>
+class inverse;
+
+namespace detail_branchless {
+
+template<class T>
+struct is_cheap_key
+{
+   static const bool value = ::boost::move_detail::is_arithmetic<T>::value ||
+                             ::boost::move_detail::is_enum<T>::value ||
+                             ::boost::move_detail::is_pointer<T>::value;
+};
+
+}  //namespace detail_branchless {
+
+template<class T>
+struct branchless_merge_compare< ::std::less<T>, T>
+   : ::boost::move_detail::bool_<detail_branchless::is_cheap_key<T>::value>
+{};
+
+template<class T>
+struct branchless_merge_compare< ::std::greater<T>, T>
+   : ::boost::move_detail::bool_<detail_branchless::is_cheap_key<T>::value>
+{};
+
+template<class T>
+struct branchless_merge_compare< ::std::less<void>, T>
+   : ::boost::move_detail::bool_<detail_branchless::is_cheap_key<T>::value>
+{};
+
+template<class T>
+struct branchless_merge_compare< ::std::greater<void>, T>
+   : ::boost::move_detail::bool_<detail_branchless::is_cheap_key<T>::value>
+{};
+
+template<class Comp, class T>
+struct branchless_merge_compare<antistable<Comp>, T>
+   : branchless_merge_compare<Comp, T>
+{};
+
+template<class Comp, class T>
+struct branchless_merge_compare<negate<Comp>, T>
+   : branchless_merge_compare<Comp, T>
+{};
+
+template<class Comp, class T>
+struct branchless_merge_compare<inverse<Comp>, T>
+   : branchless_merge_compare<Comp, T>
+{};
+
+namespace detail_branchless {
+
+//Elements merged by each batch of branch-free steps
+static const std::size_t batch_length = 8u;
+
+template<class It1, class It2, class Compare>
+struct enabled
+{
+   typedef typename ::boost::movelib::iter_value<It1>::type value_type;
+   static const bool value =
+   #if defined(BOOST_MOVE_NO_BRANCHLESS_MERGE)
+      false;
+   #else
+      ::boost::move_detail::is_contiguous_iterator<It1>::value &&
+      ::boost::move_detail::is_contiguous_iterator<It2>::value &&
+      ::boost::move_detail::is_same<value_type, typename ::boost::movelib::iter_value<It2>::type>::value &&
+      branchless_merge<value_type>::value &&
+      branchless_merge_compare<typename ::boost::move_detail::remove_cv<Compare>::type, value_type>::value;
+   #endif
+};
+
+//Returns c ? p : q. The pointer is computed with a mask so that compilers
+//can't turn the selection into a branch (e.g. to reuse an already loaded key)
+template<class T>
+BOOST_MOVE_FORCEINLINE T *select(bool c, T *p, T *q)
+{
+   const std::size_t mask = std::size_t(0u) - std::size_t(c);
+   return reinterpret_cast<T*>
+      ((reinterpret_cast<std::size_t>(p) & mask) | (reinterpret_cast<std::size_t>(q) & ~mask));
+}
+
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 OutIt batch_forward
+   (It1 &first1, It1, It2 &first2, It2, OutIt dest, Compare &comp, Op &op, ::boost::move_detail::false_)
+{
+   if(comp(*first2, *first1)){
+      op(first2, dest);
+      ++first2;
+   }
+   else{
+      op(first1, dest);
+      ++first1;
+   }
+   return ++dest;
+}
+
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_CONSTEXPR20 OutIt batch_forward
+   (It1 &first1, It1 const last1, It2 &first2, It2 const last2, OutIt dest, Compare &comp, Op &op, ::boost::move_detail::true_)
+{
+   #if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+   if(BOOST_MOVE_IS_CONSTANT_EVALUATED())
+      return (batch_forward)(first1, last1, first2, last2, dest, comp, op, ::boost::move_detail::false_());
+   #endif
+   typedef typename ::boost::movelib::iter_difference<It1>::type difference1;
+   typedef typename ::boost::movelib::iter_difference<It2>::type difference2;
+   const difference1 n1 = difference1(batch_length);
+   const difference2 n2 = difference2(batch_length);
+   //A batch of consecutive elements from the same range is moved without selecting
+   //each one, so clustered inputs are merged as fast as with a predicted branch
+   if((last1 - first1) >= n1 && !comp(*first2, first1[n1 - 1])){
+      for(std::size_t i = 0; i != batch_length; ++i, ++first1, ++dest)
+         op(first1, dest);
+   }
+   else if((last2 - first2) >= n2 && comp(first2[n2 - 1], *first1)){
+      for(std::size_t i = 0; i != batch_length; ++i, ++first2, ++dest)
+         op(first2, dest);
+   }
+   else{
+      for(std::size_t i = 0; i != batch_length && first1 != last1 && first2 != last2; ++i, ++dest){
+         const bool take2 = comp(*first2, *first1);
+         op((select)(take2, (iterator_to_raw_pointer)(first2), (iterator_to_raw_pointer)(first1)), dest);
+         first2 += difference2(take2);
+         first1 += difference1(!take2);
+      }
+   }
+   return dest;
+}
+
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 OutIt batch_backward
+   (It1, It1 &last1, It2, It2 &last2, OutIt dest_last, Compare &comp, Op &op, ::boost::move_detail::false_)
+{
+   It1 const back1 = last1 - 1;
+   It2 const back2 = last2 - 1;
+   --dest_last;
+   if(comp(*back2, *back1)){
+      op(back1, dest_last);
+      last1 = back1;
+   }
+   else{
+      op(back2, dest_last);
+      last2 = back2;
+   }
+   return dest_last;
+}
+
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_CONSTEXPR20 OutIt batch_backward
+   (It1 const first1, It1 &last1, It2 const first2, It2 &last2, OutIt dest_last, Compare &comp, Op &op, ::boost::move_detail::true_)
+{
+   #if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+   if(BOOST_MOVE_IS_CONSTANT_EVALUATED())
+      return (batch_backward)(first1, last1, first2, last2, dest_last, comp, op, ::boost::move_detail::false_());
+   #endif
+   typedef typename ::boost::movelib::iter_difference<It1>::type difference1;
+   typedef typename ::boost::movelib::iter_difference<It2>::type difference2;
+   const difference1 n1 = difference1(batch_length);
+   const difference2 n2 = difference2(batch_length);
+   if((last2 - first2) >= n2 && !comp(last2[-n2], last1[-1])){
+      for(std::size_t i = 0; i != batch_length; ++i)
+         op(--last2, --dest_last);
+   }
+   else if((last1 - first1) >= n1 && comp(last2[-1], last1[-n1])){
+      for(std::size_t i = 0; i != batch_length; ++i)
+         op(--last1, --dest_last);
+   }
+   else{
+      for(std::size_t i = 0; i != batch_length && first1 != last1 && first2 != last2; ++i){
+         const bool take1 = comp(last2[-1], last1[-1]);
+         op((select)(take1, (iterator_to_raw_pointer)(last1 - 1), (iterator_to_raw_pointer)(last2 - 1)), --dest_last);
+         last1 -= difference1(take1);
+         last2 -= difference2(!take1);
+      }
+   }
+   return dest_last;
+}
+
+}  //namespace detail_branchless {
+
+//Merges the first elements of the non-empty ranges [first1, last1) and [first2, last2)
+//(range 1 goes first on ties) applying op to them and the range starting at dest.
+//Advances the cursors past the merged elements and returns the new dest. Branch-free
+//kernels merge up to detail_branchless::batch_length elements, otherwise one element is merged.
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 OutIt merge_batch_forward
+   (It1 &first1, It1 const last1, It2 &first2, It2 const last2, OutIt dest, Compare &comp, Op &op)
+{
+   return detail_branchless::batch_forward
+      (first1, last1, first2, last2, dest, comp, op, ::boost::move_detail::bool_<detail_branchless::enabled<It1, It2, Compare>::value>());
+}
+
+//Same as merge_batch_forward but it always merges a single element
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 OutIt merge_step_forward
+   (It1 &first1, It1 const last1, It2 &first2, It2 const last2, OutIt dest, Compare &comp, Op &op)
+{
+   return detail_branchless::batch_forward
+      (first1, last1, first2, last2, dest, comp, op, ::boost::move_detail::false_());
+}
+
+//Same as merge_batch_forward, but merges the last elements of the ranges, moving
+//the cursors back, into the range ending at dest_last. Returns the new dest_last.
+template<class It1, class It2, class OutIt, class Compare, class Op>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 OutIt merge_batch_backward
+   (It1 const first1, It1 &last1, It2 const first2, It2 &last2, OutIt dest_last, Compare &comp, Op &op)
+{
+   return detail_branchless::batch_backward
+      (first1, last1, first2, last2, dest_last, comp, op, ::boost::move_detail::bool_<detail_branchless::enabled<It1, It2, Compare>::value>());
+}
+
+///@endcond
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif //#ifndef BOOST_MOVE_ALGO_BRANCHLESS_MERGE_HPP
@@ -49,10 +49,18 @@
 #include <boost/move/algo/detail/merge.hpp>
 #include <boost/move/adl_move_swap.hpp>
 #include <boost/move/algo/detail/insertion_sort.hpp>
+#include <boost/move/algo/static_sort.hpp>
 #include <boost/move/algo/detail/merge_sort.hpp>
 #include <boost/move/algo/detail/heap_sort.hpp>
 #include <boost/move/algo/detail/merge.hpp>
 #include <boost/move/algo/detail/is_sorted.hpp>
+#include <boost/move/algo/adaptive_stats.hpp>
+#include <boost/move/algo/merge_prefetch.hpp>
+#include <boost/move/algo/branchless_merge.hpp>
+#include <boost/move/algo/three_way_compare.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <boost/move/detail/workaround.hpp>
 #include <cassert>
 #include <boost/cstdint.hpp>
 #include <limits.h>
@@ -63,31 +71,6 @@
 #pragma GCC diagnostic ignored "-Wconversion"
 #endif
 
-#ifndef BOOST_MOVE_ADAPTIVE_SORT_STATS_LEVEL
-   #define BOOST_MOVE_ADAPTIVE_SORT_STATS_LEVEL 1
-#endif
-
-#ifdef BOOST_MOVE_ADAPTIVE_SORT_STATS
-   #if BOOST_MOVE_ADAPTIVE_SORT_STATS_LEVEL == 2
-      #define BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1(STR, L) \
-         print_stats(STR, L)\
-      //
-
-      #define BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2(STR, L) \
-         print_stats(STR, L)\
-      //
-   #else
-      #define BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1(STR, L) \
-         print_stats(STR, L)\
-      //
-
-      #define BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2(STR, L)
-   #endif
-#else
-   #define BOOST_MOVE_ADAPTIVE_SORT_PRINT_L1(STR, L)
-   #define BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2(STR, L)
-#endif
-
 #ifdef BOOST_MOVE_ADAPTIVE_SORT_INVARIANTS
    #define BOOST_MOVE_ADAPTIVE_SORT_INVARIANT  assert
 #else
@@ -395,9 +378,10 @@ typename iter_size<RandIt>::type
       if(xbuf.capacity() >= max_collected){
          typename XBuf::iterator const ph0 = xbuf.add(first);
          while(u != last && h < max_collected){
-            typename XBuf::iterator const r = boost::movelib::lower_bound(ph0, xbuf.end(), *u, comp);
+            bool found;
+            typename XBuf::iterator const r = detail_three_way::search_unique(ph0, xbuf.end(), *u, comp, found);
             //If key not found add it to [h, h+h0)
-            if(r == xbuf.end() || comp(*u, *r) ){
+            if(!found){
                RandIt const new_h0 = boost::move(search_end, u, h0);
                search_end = u;
                ++search_end;
@@ -412,9 +396,10 @@ typename iter_size<RandIt>::type
       }
       else{
          while(u != last && h < max_collected){
-            RandIt const r = boost::movelib::lower_bound(h0, search_end, *u, comp);
+            bool found;
+            RandIt const r = detail_three_way::search_unique(h0, search_end, *u, comp, found);
             //If key not found add it to [h, h+h0)
-            if(r == search_end || comp(*u, *r) ){
+            if(!found){
                RandIt const new_h0 = rotate_gcd(h0, search_end, u);
                search_end = u;
                ++search_end;
@@ -532,10 +517,10 @@ void slow_stable_sort
    {  //Use insertion sort to merge first elements
       size_type m = 0;
       while((L - m) > size_type(AdaptiveSortInsertionSortThreshold)){
-         insertion_sort(first+m, first+m+size_type(AdaptiveSortInsertionSortThreshold), comp);
+         ::boost::movelib::small_stable_sort(first+m, first+m+size_type(AdaptiveSortInsertionSortThreshold), comp);
          m = size_type(m + AdaptiveSortInsertionSortThreshold);
       }
-      insertion_sort(first+m, last, comp);
+      ::boost::movelib::small_stable_sort(first+m, last, comp);
    }
 
    size_type h = AdaptiveSortInsertionSortThreshold;
@@ -725,17 +710,12 @@ OutputIt op_partial_merge_impl
    InputIt2 first2(r_first2);
    if(first2 != last2 && last1 != first1)
    while(1){
-      if(comp(*first2, *first1)) {
-         op(first2++, d_first++);
-         if(first2 == last2){
-            break;
-         }
-      }
-      else{
-         op(first1++, d_first++);
-         if(first1 == last1){
-            break;
-         }
+      ::boost::movelib::prefetch_read_forward(first1);
+      ::boost::movelib::prefetch_read_forward(first2);
+      ::boost::movelib::prefetch_write_forward(d_first);
+      d_first = ::boost::movelib::merge_batch_forward(first1, last1, first2, last2, d_first, comp, op);
+      if(first1 == last1 || first2 == last2){
+         break;
       }
    }
    r_first1 = first1;
@@ -771,6 +751,10 @@ OutputIt op_partial_merge_and_swap_impl
       InputIt2 first_min(r_first_min);
       bool non_empty_ranges = true;
       do{
+         ::boost::movelib::prefetch_read_forward(first1);
+         ::boost::movelib::prefetch_write_forward(first2);
+         ::boost::movelib::prefetch_read_forward(first_min);
+         ::boost::movelib::prefetch_write_forward(d_first);
          if(comp(*first_min, *first1)) {
             op(three_way_t(), first2++, first_min++, d_first++);
             non_empty_ranges = first2 != last2;
@@ -817,7 +801,11 @@ RandItB op_buffered_partial_merge_and_swap_to_range1_and_buffer
             lastb = op(forward_t(), first1, last1, firstb);
             break;
          }
-
+         ::boost::movelib::prefetch_write_forward(first1);
+         ::boost::movelib::prefetch_write_forward(first2);
+         ::boost::movelib::prefetch_read_forward(first_min);
+         ::boost::movelib::prefetch_read_forward(firstb);
+         ::boost::movelib::prefetch_write_forward(lastb);
          if(comp(*first_min, *firstb)){
             op( four_way_t(), first2++, first_min++, first1++, lastb++);
          }
@@ -857,6 +845,10 @@ RandItB op_buffered_partial_merge_to_range1_and_buffer
             lastb = op(forward_t(), first1, last1, firstb);
             break;
          }
+         ::boost::movelib::prefetch_write_forward(first1);
+         ::boost::movelib::prefetch_read_forward(first2);
+         ::boost::movelib::prefetch_read_forward(firstb);
+         ::boost::movelib::prefetch_write_forward(lastb);
          if (comp(*first2, *firstb)) {
             op(three_way_t(), first2++, first1++, lastb++);
          }
@@ -1262,8 +1254,6 @@ void op_merge_blocks_with_buf
    RandIt first2 = last1;
    RandIt const first_irr2 = first2 + size_type(n_block_left*l_block);
    bool is_range1_A = true;
-   const size_type len = size_type(l_block * n_block_a + l_block * n_block_b + l_irreg1 + l_irreg2);
-   boost::movelib::ignore(len);
 
    RandItKeys key_range2(key_first);
 
@@ -1300,20 +1290,17 @@ void op_merge_blocks_with_buf
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT((first1 == last1) || (buffer_empty ? !comp(*first_min, last1[-1]) : !comp(*first_min, buffer_end[-1])));
          //If buffered, put those elements in place
          RandIt res = op(forward_t(), buffer, buffer_end, first1);
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_fwd: ", len);
          buffer    = buffer_end = buf_first;
          assert(buffer_empty || res == last1);
          boost::movelib::ignore(res);
          //swap_and_update_key(key_next, key_range2, key_mid, first2, last2, first_min);
          buffer_end = buffer_and_update_key(key_next, key_range2, key_mid, first2, last2, first_min, buffer = buf_first, op);
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_swp: ", len);
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(first_min, last_min, comp));
          first1 = first2;
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(first, first1, comp));
       }
       else {
          RandIt const unmerged = op_partial_merge_and_save(first1, last1, first2, last2, first_min, buffer, buffer_end, comp, op, is_range1_A);
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_mrs: ", len);
          bool const is_range_1_empty = buffer == buffer_end;
          assert(is_range_1_empty || (buffer_end-buffer) == (last1+l_block-unmerged));
          if(is_range_1_empty){
@@ -1328,7 +1315,6 @@ void op_merge_blocks_with_buf
             update_key(key_next, key_range2, key_mid);
          }
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(!is_range_1_empty || (last_min-first_min) == (last2-unmerged));
-         BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_swp: ", len);
          BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(first_min, last_min, comp));
          is_range1_A ^= is_range_1_empty;
          first1 = unmerged;
@@ -1346,14 +1332,12 @@ void op_merge_blocks_with_buf
    RandIt res = op(forward_t(), buffer, buffer_end, first1);
    boost::movelib::ignore(res);
    BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(first, res, comp));
-   BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_fwd: ", len);
 
    ////////////////////////////////////////////////////////////////////////////
    //Process irregular B block and remaining A blocks
    ////////////////////////////////////////////////////////////////////////////
    RandIt const last_irr2 = first_irr2 + l_irreg2;
    op(forward_t(), first_irr2, first_irr2+l_irreg2, buf_first);
-   BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_fwir:", len);
    buffer = buf_first;
    buffer_end = buffer+l_irreg2;
 
@@ -1364,12 +1348,10 @@ void op_merge_blocks_with_buf
       , l_block, n_block_left, 0, n_block_left
       , inverse<Compare>(comp), true, op).base();
    BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(dest, last_irr2, comp));
-   BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_blocks_w_irg: ", len);
 
    buffer_end = rbuf_beg.base();
    assert((dest-last1) == (buffer_end-buffer));
    op_merge_with_left_placed(is_range1_A ? first1 : last1, last1, dest, buffer, buffer_end, comp, op);
-   BOOST_MOVE_ADAPTIVE_SORT_PRINT_L2("   merge_with_left_plc:", len);
    BOOST_MOVE_ADAPTIVE_SORT_INVARIANT(boost::movelib::is_sorted(first, last_irr2, comp));
 }
 
@@ -1454,10 +1436,10 @@ typename iter_size<RandIt>::type
    size_type m = 0;
 
    while((length - m) > s){
-      insertion_sort(first+m, first+m+s, comp);
+      ::boost::movelib::small_stable_sort(first+m, first+m+s, comp);
       m = size_type(m + s);
    }
-   insertion_sort(first+m, first+length, comp);
+   ::boost::movelib::small_stable_sort(first+m, first+length, comp);
    return s;
 }
 
@@ -1509,6 +1491,86 @@ typename iter_size<RandIt>::type
    return l_merged;
 }
 
+//Storage passed to the allocator overloads of adaptive_sort and adaptive_merge
+//can't be a pointer or an iterator, those select the raw storage overloads.
+template<class T>
+struct has_iterator_category
+{
+   template <class U>
+   static ::boost::move_detail::yes_type test(typename U::iterator_category*);
+
+   template <class U>
+   static ::boost::move_detail::no_type test(...);
+
+   static const bool value = sizeof(test<T>(0)) == sizeof(::boost::move_detail::yes_type);
+};
+
+template<class T>
+struct is_raw_storage
+{
+   static const bool value = ::boost::move_detail::is_pointer<T>::value || has_iterator_category<T>::value;
+};
+
+//Raw storage obtained from an allocator. Each call to try_allocate requests
+//n elements if nothing was obtained yet. Allocation failures (exceptions or
+//null pointers) are not propagated and leave the buffer empty.
+template<class T, class Allocator>
+class allocator_raw_buffer
+{
+   allocator_raw_buffer(const allocator_raw_buffer &);
+   allocator_raw_buffer & operator=(const allocator_raw_buffer &);
+
+   public:
+   explicit allocator_raw_buffer(const Allocator &a)
+      : m_alloc(a), m_ptr(), m_size()
+   {}
+
+   ~allocator_raw_buffer()
+   {
+      if(m_size)
+         m_alloc.deallocate(m_ptr, m_size);
+   }
+
+   bool try_allocate(std::size_t n)
+   {
+      if(!m_size && n){
+         BOOST_MOVE_TRY{
+            m_ptr = m_alloc.allocate(n);
+            m_size = m_ptr ? n : 0u;
+         }
+         BOOST_MOVE_CATCH(...){
+            m_size = 0u;
+         }
+         BOOST_MOVE_CATCH_END
+      }
+      return m_size != 0u;
+   }
+
+   T *data() const
+   {  return m_size ? m_ptr : (T*)0;  }
+
+   std::size_t size() const
+   {  return m_size;  }
+
+   private:
+   Allocator m_alloc;
+   T *m_ptr;
+   std::size_t m_size;
+};
+
+//Tries the ideal buffer length and, if it can't be allocated, the smaller
+//fallback length. Both are limited by max_elements.
+template<class T, class Allocator>
+void allocate_adaptive_buffer
+   ( allocator_raw_buffer<T, Allocator> &buf, std::size_t ideal
+   , std::size_t fallback, std::size_t const max_elements)
+{
+   ideal    = ideal    < max_elements ? ideal    : max_elements;
+   fallback = fallback < ideal        ? fallback : ideal;
+   if(!buf.try_allocate(ideal) && fallback < ideal){
+      buf.try_allocate(fallback);
+   }
+}
 
 }  //namespace detail_adaptive {
 }  //namespace movelib {
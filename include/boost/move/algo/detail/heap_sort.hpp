@@ -43,7 +43,7 @@ class heap_sort_helper
    typedef typename boost::movelib::iter_size<RandomAccessIterator>::type  size_type;
    typedef typename boost::movelib::iterator_traits<RandomAccessIterator>::value_type value_type;
 
-   static void adjust_heap(RandomAccessIterator first, size_type hole_index, size_type const len, value_type &value, Compare comp)
+   static BOOST_MOVE_CONSTEXPR20 void adjust_heap(RandomAccessIterator first, size_type hole_index, size_type const len, value_type &value, Compare comp)
    {
       size_type const top_index = hole_index;
       size_type second_child = size_type(2u*(hole_index + 1u));
@@ -71,7 +71,7 @@ class heap_sort_helper
       }
    }
 
-   static void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+   static BOOST_MOVE_CONSTEXPR20 void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
    {
       size_type const len = size_type(last - first);
       if (len > 1) {
@@ -84,7 +84,7 @@ class heap_sort_helper
       }
    }
 
-   static void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+   static BOOST_MOVE_CONSTEXPR20 void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
    {
       size_type len = size_type(last - first);
       while (len > 1) {
@@ -97,7 +97,7 @@ class heap_sort_helper
    }
 
    public:
-   static void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+   static BOOST_MOVE_CONSTEXPR20 void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
    {
       make_heap(first, last, comp);
       sort_heap(first, last, comp);
@@ -106,7 +106,7 @@ class heap_sort_helper
 };
 
 template <class RandomAccessIterator, class Compare>
-inline void heap_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+inline BOOST_MOVE_CONSTEXPR20 void heap_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 {
    heap_sort_helper<RandomAccessIterator, Compare>::sort(first, last, comp);
 }
@@ -27,10 +27,9 @@
 #include <boost/move/detail/iterator_traits.hpp>
 #include <boost/move/adl_move_swap.hpp>
 #include <boost/move/utility_core.hpp>
-#include <boost/move/detail/placement_new.hpp>
+#include <boost/move/detail/construct_at.hpp>
 #include <boost/move/detail/destruct_n.hpp>
 #include <boost/move/algo/detail/basic_op.hpp>
-#include <boost/move/detail/placement_new.hpp>
 #include <boost/move/detail/iterator_to_raw_pointer.hpp>
 
 #if defined(BOOST_CLANG) || (defined(BOOST_GCC) && (BOOST_GCC >= 40600))
@@ -43,7 +42,7 @@ namespace boost {  namespace movelib{
 // @cond
 
 template <class Compare, class ForwardIterator, class BirdirectionalIterator, class Op>
-void insertion_sort_op(ForwardIterator first1, ForwardIterator last1, BirdirectionalIterator first2, Compare comp, Op op)
+BOOST_MOVE_CONSTEXPR20 void insertion_sort_op(ForwardIterator first1, ForwardIterator last1, BirdirectionalIterator first2, Compare comp, Op op)
 {
    if (first1 != last1){
       BirdirectionalIterator last2 = first2;
@@ -63,14 +62,14 @@ void insertion_sort_op(ForwardIterator first1, ForwardIterator last1, Birdirecti
 }
 
 template <class Compare, class ForwardIterator, class BirdirectionalIterator>
-void insertion_sort_swap(ForwardIterator first1, ForwardIterator last1, BirdirectionalIterator first2, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void insertion_sort_swap(ForwardIterator first1, ForwardIterator last1, BirdirectionalIterator first2, Compare comp)
 {
    insertion_sort_op(first1, last1, first2, comp, swap_op());
 }
 
 
 template <class Compare, class ForwardIterator, class BirdirectionalIterator>
-void insertion_sort_copy(ForwardIterator first1, ForwardIterator last1, BirdirectionalIterator first2, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void insertion_sort_copy(ForwardIterator first1, ForwardIterator last1, BirdirectionalIterator first2, Compare comp)
 {
    insertion_sort_op(first1, last1, first2, comp, move_op());
 }
@@ -78,7 +77,7 @@ void insertion_sort_copy(ForwardIterator first1, ForwardIterator last1, Birdirec
 // @endcond
 
 template <class Compare, class BirdirectionalIterator>
-void insertion_sort(BirdirectionalIterator first, BirdirectionalIterator last, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void insertion_sort(BirdirectionalIterator first, BirdirectionalIterator last, Compare comp)
 {
    typedef typename boost::movelib::iterator_traits<BirdirectionalIterator>::value_type value_type;
    if (first != last){
@@ -98,7 +97,7 @@ void insertion_sort(BirdirectionalIterator first, BirdirectionalIterator last, C
 }
 
 template <class Compare, class BirdirectionalIterator, class BirdirectionalRawIterator>
-void insertion_sort_uninitialized_copy
+BOOST_MOVE_CONSTEXPR20 void insertion_sort_uninitialized_copy
    (BirdirectionalIterator first1, BirdirectionalIterator const last1
    , BirdirectionalRawIterator const first2
    , Compare comp)
@@ -106,21 +105,21 @@ void insertion_sort_uninitialized_copy
    typedef typename iterator_traits<BirdirectionalIterator>::value_type value_type;
    if (first1 != last1){
       BirdirectionalRawIterator last2 = first2;
-      ::new((iterator_to_raw_pointer)(last2), boost_move_new_t()) value_type(::boost::move(*first1));
+      (construct_at)((iterator_to_raw_pointer)(last2), ::boost::move(*first1));
       destruct_n<value_type, BirdirectionalRawIterator> d(first2);
       d.incr();
       for (++last2; ++first1 != last1; ++last2){
          BirdirectionalRawIterator j2 = last2;
          BirdirectionalRawIterator k2 = j2;
          if (comp(*first1, *--k2)){
-            ::new((iterator_to_raw_pointer)(j2), boost_move_new_t()) value_type(::boost::move(*k2));
+            (construct_at)((iterator_to_raw_pointer)(j2), ::boost::move(*k2));
             d.incr();
             for (--j2; k2 != first2 && comp(*first1, *--k2); --j2)
                *j2 = ::boost::move(*k2);
             *j2 = ::boost::move(*first1);
          }
          else{
-            ::new((iterator_to_raw_pointer)(j2), boost_move_new_t()) value_type(::boost::move(*first1));
+            (construct_at)((iterator_to_raw_pointer)(j2), ::boost::move(*first1));
             d.incr();
          }
       }
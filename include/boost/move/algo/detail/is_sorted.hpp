@@ -18,11 +18,13 @@
 #  pragma once
 #endif
 
+#include <boost/move/detail/workaround.hpp>
+
 namespace boost {
 namespace movelib {
 
 template<class ForwardIt, class Pred>
-bool is_sorted(ForwardIt const first, ForwardIt last, Pred pred)
+BOOST_MOVE_CONSTEXPR20 bool is_sorted(ForwardIt const first, ForwardIt last, Pred pred)
 {
    if (first != last) {
       ForwardIt next = first, cur(first);
@@ -36,7 +38,7 @@ bool is_sorted(ForwardIt const first, ForwardIt last, Pred pred)
 }
 
 template<class ForwardIt, class Pred>
-bool is_sorted_and_unique(ForwardIt first, ForwardIt last, Pred pred)
+BOOST_MOVE_CONSTEXPR20 bool is_sorted_and_unique(ForwardIt first, ForwardIt last, Pred pred)
 {
    if (first != last) {
       ForwardIt next = first;
@@ -15,9 +15,13 @@
 #include <boost/move/algo/detail/basic_op.hpp>
 #include <boost/move/detail/iterator_traits.hpp>
 #include <boost/move/detail/destruct_n.hpp>
+#include <boost/move/detail/construct_at.hpp>
 #include <boost/move/algo/predicate.hpp>
 #include <boost/move/algo/detail/search.hpp>
 #include <boost/move/detail/iterator_to_raw_pointer.hpp>
+#include <boost/move/algo/scratch_stats.hpp>
+#include <boost/move/algo/merge_prefetch.hpp>
+#include <boost/move/algo/branchless_merge.hpp>
 #include <cassert>
 #include <cstddef>
 
@@ -67,6 +71,7 @@ class adaptive_xbuf
          RandRawIt result = boost::move(first, first+rand_diff_t(m_size), m_ptr);
          boost::uninitialized_move(first+rand_diff_t(m_size), first+rand_diff_t(n), result);
          m_size = n;
+         BOOST_MOVE_SCRATCH_RECORD_XBUF(m_size, T);
       }
    }
 
@@ -76,6 +81,7 @@ class adaptive_xbuf
       assert(m_capacity - m_size >= n);
       boost::uninitialized_move(first, first+n, m_ptr+m_size);
       m_size += n;
+      BOOST_MOVE_SCRATCH_RECORD_XBUF(m_size, T);
    }
 
    template<class RandIt>
@@ -85,6 +91,7 @@ class adaptive_xbuf
       RandRawIt p_ret = m_ptr + m_size;
       ::new(&*p_ret) T(::boost::move(*it));
       ++m_size;
+      BOOST_MOVE_SCRATCH_RECORD_XBUF(m_size, T);
       return p_ret;
    }
 
@@ -105,6 +112,7 @@ class adaptive_xbuf
    inline void set_size(size_type sz)
    {
       m_size = sz;
+      BOOST_MOVE_SCRATCH_RECORD_XBUF(m_size, T);
    }
 
    void shrink_to_fit(size_type const sz)
@@ -129,6 +137,7 @@ class adaptive_xbuf
                ::new((void*)&m_ptr[m_size]) T(::boost::move(m_ptr[m_size-1]));
             }
             t = ::boost::move(m_ptr[m_size-1]);
+            BOOST_MOVE_SCRATCH_RECORD_XBUF(m_size, T);
          }
          BOOST_MOVE_CATCH(...)
          {
@@ -306,7 +315,7 @@ inline Unsigned gcd(Unsigned x, Unsigned y)
 
 //Modified version from "An Optimal In-Place Array Rotation Algorithm", Ching-Kuang Shene
 template<typename Unsigned>
-Unsigned gcd(Unsigned x, Unsigned y)
+BOOST_MOVE_CONSTEXPR20 Unsigned gcd(Unsigned x, Unsigned y)
 {
    if(0 == ((x &(x-1)) | (y & (y-1)))){
       return x < y ? x : y;
@@ -333,7 +342,7 @@ Unsigned gcd(Unsigned x, Unsigned y)
 }
 
 template<typename RandIt>
-RandIt rotate_gcd(RandIt first, RandIt middle, RandIt last)
+BOOST_MOVE_CONSTEXPR20 RandIt rotate_gcd(RandIt first, RandIt middle, RandIt last)
 {
    typedef typename iter_size<RandIt>::type size_type;
    typedef typename iterator_traits<RandIt>::value_type value_type;
@@ -375,19 +384,15 @@ void op_merge_left( RandIt buf_first
                     , Compare comp
                     , Op op)
 {
-   for(RandIt first2=last1; first2 != last2; ++buf_first){
+   for(RandIt first2=last1; first2 != last2; ){
       if(first1 == last1){
          op(forward_t(), first2, last2, buf_first);
          return;
       }
-      else if(comp(*first2, *first1)){
-         op(first2, buf_first);
-         ++first2;
-      }
-      else{
-         op(first1, buf_first);
-         ++first1;
-      }
+      ::boost::movelib::prefetch_read_forward(first1);
+      ::boost::movelib::prefetch_read_forward(first2);
+      ::boost::movelib::prefetch_write_forward(buf_first);
+      buf_first = ::boost::movelib::merge_batch_forward(first1, last1, first2, last2, buf_first, comp, op);
    }
    if(buf_first != first1){//In case all remaining elements are in the same place
                            //(e.g. buffer is exactly the size of the second half
@@ -428,17 +433,10 @@ void op_merge_right
          op(backward_t(), first1, last1, buf_last);
          return;
       }
-      --last2;
-      --last1;
-      --buf_last;
-      if(comp(*last2, *last1)){
-         op(last1, buf_last);
-         ++last2;
-      }
-      else{
-         op(last2, buf_last);
-         ++last1;
-      }
+      ::boost::movelib::prefetch_read_backward(last1);
+      ::boost::movelib::prefetch_read_backward(last2);
+      ::boost::movelib::prefetch_write_backward(buf_last);
+      buf_last = ::boost::movelib::merge_batch_backward(first1, last1, first2, last2, buf_last, comp, op);
    }
    if(last2 != buf_last){  //In case all remaining elements are in the same place
                            //(e.g. buffer is exactly the size of the first half
@@ -508,7 +506,7 @@ void buffered_merge
 
 //Complexity: min(len1,len2)^2 + max(len1,len2)
 template<class RandIt, class Compare>
-void merge_bufferless_ON2(RandIt first, RandIt middle, RandIt last, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void merge_bufferless_ON2(RandIt first, RandIt middle, RandIt last, Compare comp)
 {
    if((middle - first) < (last - middle)){
       while(first != middle){
@@ -542,12 +540,13 @@ void merge_bufferless_ON2(RandIt first, RandIt middle, RandIt last, Compare comp
 static const std::size_t MergeBufferlessONLogNRotationThreshold = 16u;
 
 template <class RandIt, class Compare>
-void merge_bufferless_ONlogN_recursive
+BOOST_MOVE_CONSTEXPR20 void merge_bufferless_ONlogN_recursive
    ( RandIt first, RandIt middle, RandIt last
    , typename iter_size<RandIt>::type len1
    , typename iter_size<RandIt>::type len2
    , Compare comp)
 {
+   BOOST_MOVE_SCRATCH_RECURSION_GUARD;
    typedef typename iter_size<RandIt>::type size_type;
 
    while(1) {
@@ -609,7 +608,7 @@ void merge_bufferless_ONlogN_recursive
 
 //Complexity: NlogN
 template<class RandIt, class Compare>
-void merge_bufferless_ONlogN(RandIt first, RandIt middle, RandIt last, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void merge_bufferless_ONlogN(RandIt first, RandIt middle, RandIt last, Compare comp)
 {
    typedef typename iter_size<RandIt>::type size_type;
    merge_bufferless_ONlogN_recursive
@@ -617,7 +616,7 @@ void merge_bufferless_ONlogN(RandIt first, RandIt middle, RandIt last, Compare c
 }
 
 template<class RandIt, class Compare>
-void merge_bufferless(RandIt first, RandIt middle, RandIt last, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void merge_bufferless(RandIt first, RandIt middle, RandIt last, Compare comp)
 {
    #define BOOST_ADAPTIVE_MERGE_NLOGN_MERGE
    #ifdef BOOST_ADAPTIVE_MERGE_NLOGN_MERGE
@@ -629,7 +628,7 @@ void merge_bufferless(RandIt first, RandIt middle, RandIt last, Compare comp)
 
 // [r_first, r_last) are already in the right part of the destination range.
 template <class Compare, class InputIterator, class InputOutIterator, class Op>
-void op_merge_with_right_placed
+BOOST_MOVE_CONSTEXPR20 void op_merge_with_right_placed
    ( InputIterator first, InputIterator last
    , InputOutIterator dest_first, InputOutIterator r_first, InputOutIterator r_last
    , Compare comp, Op op)
@@ -642,15 +641,10 @@ void op_merge_with_right_placed
          boost::movelib::ignore(end);
          return;
       }
-      else if (comp(*r_first, *first)) {
-         op(r_first, dest_first);
-         ++r_first;
-      }
-      else {
-         op(first, dest_first);
-         ++first;
-      }
-      ++dest_first;
+      ::boost::movelib::prefetch_read_forward(first);
+      ::boost::movelib::prefetch_read_forward(r_first);
+      ::boost::movelib::prefetch_write_forward(dest_first);
+      dest_first = ::boost::movelib::merge_batch_forward(first, last, r_first, r_last, dest_first, comp, op);
    }
    // Remaining [r_first, r_last) already in the correct place
 }
@@ -679,18 +673,10 @@ void op_merge_with_left_placed
          boost::movelib::ignore(res);
          return;
       }
-      --r_last;
-      --last;
-      if(comp(*r_last, *last)){
-         ++r_last;
-         --dest_last;
-         op(last, dest_last);
-      }
-      else{
-         ++last;
-         --dest_last;
-         op(r_last, dest_last);
-      }
+      ::boost::movelib::prefetch_read_backward(r_last);
+      ::boost::movelib::prefetch_read_backward(last);
+      ::boost::movelib::prefetch_write_backward(dest_last);
+      dest_last = ::boost::movelib::merge_batch_backward(first, last, r_first, r_last, dest_last, comp, op);
    }
    // Remaining [first, last) already in the correct place
 }
@@ -709,7 +695,7 @@ void merge_with_left_placed
 
 // [r_first, r_last) are already in the right part of the destination range.
 template <class Compare, class InputIterator, class InputOutIterator>
-void merge_with_right_placed
+BOOST_MOVE_CONSTEXPR20 void merge_with_right_placed
    ( InputIterator first, InputIterator last
    , InputOutIterator dest_first, InputOutIterator r_first, InputOutIterator r_last
    , Compare comp)
@@ -717,10 +703,17 @@ void merge_with_right_placed
    op_merge_with_right_placed(first, last, dest_first, r_first, r_last, comp, move_op());
 }
 
+struct construct_op
+{
+   template <class SourceIt, class DestinationIt>
+   inline BOOST_MOVE_CONSTEXPR20 void operator()(SourceIt source, DestinationIt dest)
+   {  (construct_at)((iterator_to_raw_pointer)(dest), ::boost::move(*source));  }
+};
+
 // [r_first, r_last) are already in the right part of the destination range.
 // [dest_first, r_first) is uninitialized memory
 template <class Compare, class InputIterator, class InputOutIterator>
-void uninitialized_merge_with_right_placed
+BOOST_MOVE_CONSTEXPR20 void uninitialized_merge_with_right_placed
    ( InputIterator first, InputIterator last
    , InputOutIterator dest_first, InputOutIterator r_first, InputOutIterator r_last
    , Compare comp)
@@ -730,11 +723,12 @@ void uninitialized_merge_with_right_placed
    InputOutIterator const original_r_first = r_first;
 
    destruct_n<value_type, InputOutIterator> d(dest_first);
+   construct_op op;
 
    while ( first != last && dest_first != original_r_first ) {
       if (r_first == r_last) {
          for(; dest_first != original_r_first; ++dest_first, ++first){
-            ::new((iterator_to_raw_pointer)(dest_first)) value_type(::boost::move(*first));
+            (construct_at)((iterator_to_raw_pointer)(dest_first), ::boost::move(*first));
             d.incr();
          }
          d.release();
@@ -743,17 +737,15 @@ void uninitialized_merge_with_right_placed
          boost::movelib::ignore(end);
          return;
       }
-      else if (comp(*r_first, *first)) {
-         ::new((iterator_to_raw_pointer)(dest_first)) value_type(::boost::move(*r_first));
-         d.incr();
-         ++r_first;
-      }
-      else {
-         ::new((iterator_to_raw_pointer)(dest_first)) value_type(::boost::move(*first));
-         d.incr();
-         ++first;
-      }
-      ++dest_first;
+      ::boost::movelib::prefetch_read_forward(first);
+      ::boost::movelib::prefetch_read_forward(r_first);
+      ::boost::movelib::prefetch_write_forward(dest_first);
+      //Batches can't go past the uninitialized part
+      InputOutIterator const d_first = dest_first;
+      dest_first = std::size_t(original_r_first - dest_first) >= detail_branchless::batch_length
+         ? ::boost::movelib::merge_batch_forward(first, last, r_first, r_last, dest_first, comp, op)
+         : ::boost::movelib::merge_step_forward(first, last, r_first, r_last, dest_first, comp, op);
+      d.incr(std::size_t(dest_first - d_first));
    }
    d.release();
    merge_with_right_placed(first, last, original_r_first, r_first, r_last, comp);
@@ -809,6 +801,7 @@ template<typename BidirectionalIterator,
       typename  iter_size<BidirectionalIterator>::type buffer_size,
       Compare comp)
 {
+   BOOST_MOVE_SCRATCH_RECURSION_GUARD;
    typedef typename  iter_size<BidirectionalIterator>::type size_type;
    //trivial cases
    if (!len2 || !len1) {
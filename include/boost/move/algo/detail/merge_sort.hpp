@@ -47,7 +47,7 @@ namespace movelib {
 static const unsigned MergeSortInsertionSortThreshold = 16;
 
 template <class RandIt, class Compare>
-void inplace_stable_sort(RandIt first, RandIt last, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void inplace_stable_sort(RandIt first, RandIt last, Compare comp)
 {
    typedef typename iter_size<RandIt>::type  size_type;
    if (size_type(last - first) <= size_type(MergeSortInsertionSortThreshold)) {
@@ -64,9 +64,10 @@ void inplace_stable_sort(RandIt first, RandIt last, Compare comp)
 // @endcond
 
 template<class RandIt, class RandIt2, class Compare>
-void merge_sort_copy( RandIt first, RandIt last
+BOOST_MOVE_CONSTEXPR20 void merge_sort_copy( RandIt first, RandIt last
                    , RandIt2 dest, Compare comp)
 {
+   BOOST_MOVE_SCRATCH_RECURSION_GUARD;
    typedef typename iter_size<RandIt>::type         size_type;
    
    size_type const count = size_type(last - first);
@@ -85,10 +86,11 @@ void merge_sort_copy( RandIt first, RandIt last
 }
 
 template<class RandIt, class RandItRaw, class Compare>
-void merge_sort_uninitialized_copy( RandIt first, RandIt last
+BOOST_MOVE_CONSTEXPR20 void merge_sort_uninitialized_copy( RandIt first, RandIt last
                                  , RandItRaw uninitialized
                                  , Compare comp)
 {
+   BOOST_MOVE_SCRATCH_RECURSION_GUARD;
    typedef typename iter_size<RandIt>::type       size_type;
    typedef typename iterator_traits<RandIt>::value_type value_type;
 
@@ -111,7 +113,7 @@ void merge_sort_uninitialized_copy( RandIt first, RandIt last
 }
 
 template<class RandIt, class RandItRaw, class Compare>
-void merge_sort( RandIt first, RandIt last, Compare comp
+BOOST_MOVE_CONSTEXPR20 void merge_sort( RandIt first, RandIt last, Compare comp
                , RandItRaw uninitialized)
 {
    typedef typename iter_size<RandIt>::type       size_type;
@@ -130,6 +132,7 @@ void merge_sort( RandIt first, RandIt last, Compare comp
       merge_sort_uninitialized_copy(half_it, last, uninitialized, comp);
       destruct_n<value_type, RandItRaw> d(uninitialized);
       d.incr(rest);
+      BOOST_MOVE_SCRATCH_RECORD_XBUF(rest, value_type);
       merge_sort_copy(first, half_it, rest_it, comp);
       merge_with_right_placed
          ( uninitialized, uninitialized + rest
@@ -140,7 +143,7 @@ void merge_sort( RandIt first, RandIt last, Compare comp
 ///@cond
 
 template<class RandIt, class RandItRaw, class Compare>
-void merge_sort_with_constructed_buffer( RandIt first, RandIt last, Compare comp, RandItRaw buffer)
+BOOST_MOVE_CONSTEXPR20 void merge_sort_with_constructed_buffer( RandIt first, RandIt last, Compare comp, RandItRaw buffer)
 {
    typedef typename iter_size<RandIt>::type       size_type;
 
@@ -166,6 +169,7 @@ template<typename RandIt, typename Pointer,
          typename Distance, typename Compare>
 void stable_sort_ONlogN_recursive(RandIt first, RandIt last, Pointer buffer, Distance buffer_size, Compare comp)
 {
+   BOOST_MOVE_SCRATCH_RECURSION_GUARD;
    typedef typename iter_size<RandIt>::type  size_type;
    if (size_type(last - first) <= size_type(MergeSortInsertionSortThreshold)) {
       insertion_sort(first, last, comp);
@@ -51,10 +51,12 @@
 #include <boost/move/detail/workaround.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/move/algo/detail/insertion_sort.hpp>
+#include <boost/move/algo/static_sort.hpp>
 #include <boost/move/algo/detail/heap_sort.hpp>
 #include <boost/move/detail/iterator_traits.hpp>
 
 #include <boost/move/adl_move_swap.hpp>
+#include <boost/move/algo/scratch_stats.hpp>
 #include <cstddef>
 
 #if defined(BOOST_CLANG) || (defined(BOOST_GCC) && (BOOST_GCC >= 40600))
@@ -71,10 +73,10 @@ namespace pdqsort_detail {
    template<class T1, class T2>
    struct pair
    {
-      pair()
+      BOOST_MOVE_CONSTEXPR20 pair()
       {}
 
-      pair(const T1 &t1, const T2 &t2)
+      BOOST_MOVE_CONSTEXPR20 pair(const T1 &t1, const T2 &t2)
          : first(t1), second(t2)
       {}
 
@@ -103,7 +105,7 @@ namespace pdqsort_detail {
 
     // Returns floor(log2(n)), assumes n > 0.
     template<class Unsigned>
-    Unsigned log2(Unsigned n) {
+    BOOST_MOVE_CONSTEXPR20 Unsigned log2(Unsigned n) {
         Unsigned log = 0;
         while (n >>= 1) ++log;
         return log;
@@ -113,7 +115,7 @@ namespace pdqsort_detail {
     // partial_insertion_sort_limit elements were moved, and abort sorting. Otherwise it will
     // successfully sort and return true.
     template<class Iter, class Compare>
-    inline bool partial_insertion_sort(Iter begin, Iter end, Compare comp) {
+    inline BOOST_MOVE_CONSTEXPR20 bool partial_insertion_sort(Iter begin, Iter end, Compare comp) {
         typedef typename boost::movelib::iterator_traits<Iter>::value_type T;
         typedef typename boost::movelib:: iter_size<Iter>::type  size_type;
         if (begin == end) return true;
@@ -141,13 +143,13 @@ namespace pdqsort_detail {
     }
 
     template<class Iter, class Compare>
-    inline void sort2(Iter a, Iter b, Compare comp) {
+    inline BOOST_MOVE_CONSTEXPR20 void sort2(Iter a, Iter b, Compare comp) {
         if (comp(*b, *a)) boost::adl_move_iter_swap(a, b);
     }
 
     // Sorts the elements *a, *b and *c using comparison function comp.
     template<class Iter, class Compare>
-    inline void sort3(Iter a, Iter b, Iter c, Compare comp) {
+    inline BOOST_MOVE_CONSTEXPR20 void sort3(Iter a, Iter b, Iter c, Compare comp) {
         sort2(a, b, comp);
         sort2(b, c, comp);
         sort2(a, b, comp);
@@ -159,7 +161,7 @@ namespace pdqsort_detail {
     // pivot is a median of at least 3 elements and that [begin, end) is at least
     // insertion_sort_threshold long.
     template<class Iter, class Compare>
-    pdqsort_detail::pair<Iter, bool> partition_right(Iter begin, Iter end, Compare comp) {
+    BOOST_MOVE_CONSTEXPR20 pdqsort_detail::pair<Iter, bool> partition_right(Iter begin, Iter end, Compare comp) {
         typedef typename boost::movelib::iterator_traits<Iter>::value_type T;
         
         // Move pivot into local for speed.
@@ -204,7 +206,7 @@ namespace pdqsort_detail {
     // Since this is rarely used (the many equal case), and in that case pdqsort already has O(n)
     // performance, no block quicksort is applied here for simplicity.
     template<class Iter, class Compare>
-    inline Iter partition_left(Iter begin, Iter end, Compare comp) {
+    inline BOOST_MOVE_CONSTEXPR20 Iter partition_left(Iter begin, Iter end, Compare comp) {
         typedef typename boost::movelib::iterator_traits<Iter>::value_type T;
 
         T pivot(boost::move(*begin));
@@ -231,19 +233,20 @@ namespace pdqsort_detail {
 
 
    template<class Iter, class Compare>
-   void pdqsort_loop( Iter begin, Iter end, Compare comp
+   BOOST_MOVE_CONSTEXPR20 void pdqsort_loop( Iter begin, Iter end, Compare comp
                     , typename boost::movelib:: iter_size<Iter>::type bad_allowed
                     , bool leftmost = true)
    {
+        BOOST_MOVE_SCRATCH_RECURSION_GUARD;
         typedef typename boost::movelib:: iter_size<Iter>::type size_type;
 
         // Use a while loop for tail recursion elimination.
         while (true) {
             size_type size = size_type(end - begin);
 
-            // Insertion sort is faster for small arrays.
+            // Insertion sort (or a sorting network) is faster for small arrays.
             if (size < insertion_sort_threshold) {
-                insertion_sort(begin, end, comp);
+                ::boost::movelib::small_sort(begin, end, comp);
                 return;
             }
 
@@ -326,7 +329,7 @@ namespace pdqsort_detail {
 
 
 template<class Iter, class Compare>
-void pdqsort(Iter begin, Iter end, Compare comp)
+BOOST_MOVE_CONSTEXPR20 void pdqsort(Iter begin, Iter end, Compare comp)
 {
    if (begin == end) return;
    typedef typename boost::movelib:: iter_size<Iter>::type size_type;
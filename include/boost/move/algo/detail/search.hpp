@@ -11,6 +11,7 @@
 #ifndef BOOST_MOVE_DETAIL_SEARCH_HPP
 #define BOOST_MOVE_DETAIL_SEARCH_HPP
 
+#include <boost/move/detail/workaround.hpp>
 #include <boost/move/detail/iterator_traits.hpp>
 
 #if defined(BOOST_CLANG) || (defined(BOOST_GCC) && (BOOST_GCC >= 40600))
@@ -22,7 +23,7 @@ namespace boost {
 namespace movelib {
 
 template <class RandIt, class T, class Compare>
-RandIt lower_bound
+BOOST_MOVE_CONSTEXPR20 RandIt lower_bound
    (RandIt first, const RandIt last, const T& key, Compare comp)
 {
    typedef typename iter_size<RandIt>::type size_type;
@@ -46,7 +47,7 @@ RandIt lower_bound
 }
 
 template <class RandIt, class T, class Compare>
-RandIt upper_bound
+BOOST_MOVE_CONSTEXPR20 RandIt upper_bound
    (RandIt first, const RandIt last, const T& key, Compare comp)
 {
    typedef typename iter_size<RandIt>::type size_type;
@@ -14,6 +14,7 @@
 #include <boost/move/algo/move.hpp>
 #include <boost/move/iterator.hpp>
 #include <boost/move/utility_core.hpp>
+#include <boost/move/algo/three_way_compare.hpp>
 
 #if defined(BOOST_CLANG) || (defined(BOOST_GCC) && (BOOST_GCC >= 40600))
 #pragma GCC diagnostic push
@@ -27,7 +28,7 @@ template<class InputIt, class OutputIt>
 OutputIt copy(InputIt first, InputIt last, OutputIt result)
 {
    while (first != last) {
-      *result++ = *first;
+      *result = *first;
       ++result;
       ++first;
    }
@@ -53,13 +54,14 @@ OutputIt set_difference
       if (first2 == last2)
          return boost::move_detail::copy(first1, last1, result);
 
-      if (comp(*first1, *first2)) {
+      const int c = detail_three_way::compare(comp, *first1, *first2);
+      if (c < 0) {
          *result = *first1;
          ++result;
          ++first1;
       }
       else {
-         if (!comp(*first2, *first1)) {
+         if (c == 0) {
             ++first1;
          }
          ++first2;
@@ -82,11 +84,12 @@ InputOutputIt1 inplace_set_difference
       if (first2 == last2){
          return last1;
       }
-      else if (comp(*first1, *first2)){
+      const int c = detail_three_way::compare(comp, *first1, *first2);
+      if (c < 0){
          ++first1;
       }
       else{
-         if (!comp(*first2, *first1)) {
+         if (c == 0) {
             InputOutputIt1 result = first1;
             //An element from range 1 must be skipped, no longer an inplace operation
             return boost::movelib::set_difference
@@ -129,7 +132,8 @@ OutputIt set_unique_difference
          break;
       }
 
-      if (comp(*first1, *first2)) {
+      const int c = detail_three_way::compare(comp, *first1, *first2);
+      if (c < 0) {
          //Skip equivalent elements in range1 but don't write i
          //to result before comparing as moving *i could alter the value in i.
          ForwardIt1 i = first1;
@@ -141,13 +145,11 @@ OutputIt set_unique_difference
          *result = *i;
          ++result;
       }
+      else if (c > 0) {
+         ++first2;
+      }
       else {
-         if (comp(*first2, *first1)) {
-            ++first2;
-         }
-         else{
-            ++first1;
-         }
+         ++first1;
       }
    }
    return result;
@@ -174,10 +176,12 @@ ForwardOutputIt1 inplace_set_unique_difference
          }
          return ++result;
       }
-      else if (comp(*first2, *first1)) {
+      //Compare *first2 first: a boolean comparator advancing range 2 needs a single call
+      const int c = -detail_three_way::compare(comp, *first2, *first1);
+      if (c > 0) {
          ++first2;
       }
-      else if (comp(*first1, *first2)){
+      else if (c < 0){
          //skip any adjacent equivalent element in range 1
          ForwardOutputIt1 result = first1;
          if (++first1 != last1 && !comp(*result, *first1)) {
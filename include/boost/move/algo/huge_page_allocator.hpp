@@ -0,0 +1,247 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Allocator for big scratch buffers backed by huge pages.
+
+#ifndef BOOST_MOVE_ALGO_HUGE_PAGE_ALLOCATOR_HPP
+#define BOOST_MOVE_ALGO_HUGE_PAGE_ALLOCATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/throw_bad_alloc.hpp>
+#include <cstddef>
+#include <new>
+
+///@cond
+
+#if defined(__linux__) && !defined(BOOST_MOVE_NO_HUGE_PAGES)
+#  define BOOST_MOVE_DETAIL_HAS_HUGE_PAGES
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+///@endcond
+
+namespace boost {
+namespace movelib {
+
+//! Kind of memory backing a block returned by
+//! [classref boost::movelib::huge_page_allocator huge_page_allocator].
+enum huge_page_backing
+{
+   //! Allocated with operator new: the block was small or mappings are not supported
+   heap_backing,
+   //! Anonymous mapping with normal pages (huge pages were not available)
+   mapped_backing,
+   //! Anonymous mapping advised to use transparent huge pages
+   transparent_huge_page_backing,
+   //! Mapping from the huge page pool (hugetlbfs)
+   explicit_huge_page_backing
+};
+
+//! Size of the huge pages requested by
+//! [classref boost::movelib::huge_page_allocator huge_page_allocator].
+static const std::size_t huge_page_size = std::size_t(2u*1024u*1024u);
+
+///@cond
+
+namespace detail_huge_page {
+
+#if defined(BOOST_MOVE_DETAIL_HAS_HUGE_PAGES)
+
+//Blocks of at least min_bytes are mapped. The decision only depends on the
+//size so that deallocate_block can recover it without storing anything.
+inline bool is_mapped(std::size_t bytes, std::size_t min_bytes)
+{  return bytes != 0u && bytes >= min_bytes;  }
+
+inline std::size_t mapped_size(std::size_t bytes)
+{  return (bytes + huge_page_size - 1u)/huge_page_size*huge_page_size;  }
+
+//Maps "bytes" bytes (a multiple of huge_page_size) aligned to huge_page_size so that
+//transparent huge pages can back the whole range.
+inline void *map_aligned(std::size_t bytes)
+{
+   std::size_t const over = bytes + huge_page_size;
+   if(over < bytes)
+      return 0;
+   void *const raw = ::mmap(0, over, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if(raw == MAP_FAILED)
+      return 0;
+   char *const first = static_cast<char*>(raw);
+   char *const aligned = first + (huge_page_size - reinterpret_cast<std::size_t>(first) % huge_page_size) % huge_page_size;
+   if(aligned != first)
+      ::munmap(first, std::size_t(aligned - first));
+   std::size_t const tail = std::size_t((first + over) - (aligned + bytes));
+   if(tail)
+      ::munmap(aligned + bytes, tail);
+   return aligned;
+}
+
+inline void *map_block(std::size_t mapped, bool use_hugetlbfs, huge_page_backing &backing)
+{
+   #if defined(MAP_HUGETLB)
+   if(use_hugetlbfs){
+      void *const p = ::mmap(0, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if(p != MAP_FAILED){
+         backing = explicit_huge_page_backing;
+         return p;
+      }
+   }
+   #else
+   (void)use_hugetlbfs;
+   #endif
+   void *const p = map_aligned(mapped);
+   if(!p)
+      return 0;
+   backing = mapped_backing;
+   #if defined(MADV_HUGEPAGE)
+   if(0 == ::madvise(p, mapped, MADV_HUGEPAGE))
+      backing = transparent_huge_page_backing;
+   #endif
+   return p;
+}
+
+//Writes a byte in each page so that pages are allocated in the NUMA node
+//of the calling thread (Linux first-touch policy).
+inline void first_touch(void *p, std::size_t bytes)
+{
+   long const sys_page = ::sysconf(_SC_PAGESIZE);
+   std::size_t const page = sys_page > 0 ? std::size_t(sys_page) : std::size_t(4096u);
+   volatile char *const c = static_cast<char*>(p);
+   for(std::size_t i = 0; i < bytes; i += page){
+      c[i] = 0;
+   }
+}
+
+#endif   //BOOST_MOVE_DETAIL_HAS_HUGE_PAGES
+
+inline void *allocate_block(std::size_t bytes, std::size_t min_bytes, bool use_hugetlbfs, bool touch, huge_page_backing &backing)
+{
+   #if defined(BOOST_MOVE_DETAIL_HAS_HUGE_PAGES)
+   if(is_mapped(bytes, min_bytes)){
+      std::size_t const mapped = mapped_size(bytes);
+      void *const base = mapped < bytes ? 0 : map_block(mapped, use_hugetlbfs, backing);
+      if(!base)
+         ::boost::move_detail::throw_bad_alloc();
+      //Pages past the request are left untouched, so the kernel does not commit them
+      if(touch)
+         first_touch(base, bytes);
+      return base;
+   }
+   #else
+   (void)min_bytes; (void)use_hugetlbfs; (void)touch;
+   #endif
+   backing = heap_backing;
+   return ::operator new(bytes);
+}
+
+inline void deallocate_block(void *p, std::size_t bytes, std::size_t min_bytes)
+{
+   #if defined(BOOST_MOVE_DETAIL_HAS_HUGE_PAGES)
+   if(is_mapped(bytes, min_bytes)){
+      ::munmap(p, mapped_size(bytes));
+      return;
+   }
+   #else
+   (void)bytes; (void)min_bytes;
+   #endif
+   ::operator delete(p);
+}
+
+}  //namespace detail_huge_page {
+
+///@endcond
+
+//! Allocator for big, short lived scratch buffers such as the external buffers of
+//! [funcref boost::movelib::adaptive_sort adaptive_sort] and
+//! [funcref boost::movelib::adaptive_merge adaptive_merge] (pass it to their allocator overloads)
+//! or merge_sort. It reduces TLB misses of sorts of very big ranges.
+//!
+//! On Linux, blocks of at least "min_bytes" bytes are mapped with mmap, rounded up to and aligned to
+//! huge_page_size, and advised to use transparent huge pages (MADV_HUGEPAGE). If "use_hugetlbfs" is
+//! true, the huge page pool (MAP_HUGETLB) is tried first and normal pages are used if it is empty.
+//! If "first_touch" is true, every requested page is written by the allocating thread so that memory
+//! is placed in its NUMA node. Smaller blocks and other systems use operator new.
+//!
+//! No bookkeeping is stored with the blocks: the size passed to deallocate() selects how a block is
+//! released, so only allocators with the same "min_bytes" compare equal.
+//!
+//! Define BOOST_MOVE_NO_HUGE_PAGES to always use operator new.
+template<class T>
+class huge_page_allocator
+{
+   template<class U>
+   friend class huge_page_allocator;
+
+   public:
+   typedef T value_type;
+
+   //! <b>Effects</b>: Constructs an allocator with the given options.
+   explicit huge_page_allocator(std::size_t min_bytes = huge_page_size, bool use_hugetlbfs = false, bool first_touch = true)
+      : m_min_bytes(min_bytes), m_use_hugetlbfs(use_hugetlbfs), m_first_touch(first_touch)
+   {}
+
+   //! <b>Effects</b>: Constructs an allocator with the options of "other".
+   template<class U>
+   huge_page_allocator(const huge_page_allocator<U> &other)
+      : m_min_bytes(other.m_min_bytes), m_use_hugetlbfs(other.m_use_hugetlbfs), m_first_touch(other.m_first_touch)
+   {}
+
+   //! <b>Returns</b>: Storage for "n" elements.
+   //!
+   //! <b>Throws</b>: std::bad_alloc if the memory can't be mapped or allocated.
+   T *allocate(std::size_t n)
+   {
+      huge_page_backing b;
+      return this->allocate(n, b);
+   }
+
+   //! <b>Effects</b>: Same as allocate(n), and stores in "backing" the kind of memory used.
+   T *allocate(std::size_t n, huge_page_backing &backing)
+   {
+      if(n > std::size_t(-1)/sizeof(T))
+         ::boost::move_detail::throw_bad_alloc();
+      return static_cast<T*>(detail_huge_page::allocate_block
+         (n*sizeof(T), m_min_bytes, m_use_hugetlbfs, m_first_touch, backing));
+   }
+
+   //! <b>Requires</b>: "p" was returned by allocate(n) of an allocator equal to *this.
+   //!
+   //! <b>Effects</b>: Unmaps or deallocates "p".
+   void deallocate(T *p, std::size_t n)
+   {  detail_huge_page::deallocate_block(p, n*sizeof(T), m_min_bytes);  }
+
+   friend bool operator==(const huge_page_allocator &l, const huge_page_allocator &r)
+   {  return l.m_min_bytes == r.m_min_bytes;  }
+
+   friend bool operator!=(const huge_page_allocator &l, const huge_page_allocator &r)
+   {  return l.m_min_bytes != r.m_min_bytes;  }
+
+   private:
+   std::size_t m_min_bytes;
+   bool m_use_hugetlbfs;
+   bool m_first_touch;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#define BOOST_MOVE_ALGO_HUGE_PAGE_ALLOCATOR_HPP
@@ -0,0 +1,310 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Stable sorting of singly and doubly linked lists that relinks nodes instead of moving values.
+
+#ifndef BOOST_MOVE_ALGO_LIST_SORT_HPP
+#define BOOST_MOVE_ALGO_LIST_SORT_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <climits>
+#include <cstddef>
+
+namespace boost {
+namespace movelib {
+
+///@cond
+
+namespace detail_list_sort {
+
+//A sorted sequence of linked nodes. The next pointer of last
+//is not part of the run and it's only written when linking runs.
+template<class NodeTraits>
+struct run
+{
+   typedef typename NodeTraits::node_ptr node_ptr;
+
+   run()
+      : first(), last()
+   {}
+
+   node_ptr first;
+   node_ptr last;
+};
+
+template<std::size_t K>
+struct log2_floor
+{
+   static const std::size_t value = 1u + log2_floor<K/2u>::value;
+};
+
+template<>
+struct log2_floor<1u>
+{
+   static const std::size_t value = 0u;
+};
+
+//Merges two runs, a holding the nodes that precede those of b in the original order.
+//Only links between nodes coming from different runs are rewritten.
+template<class NodeTraits, class Compare>
+run<NodeTraits> merge_two(run<NodeTraits> a, run<NodeTraits> b, Compare &comp)
+{
+   typedef typename NodeTraits::node_ptr node_ptr;
+   run<NodeTraits> r;
+   bool from_b = comp(b.first, a.first);
+   node_ptr tail = from_b ? b.first : a.first;
+   r.first = tail;
+   while(true){
+      if(from_b){
+         if(tail == b.last){
+            NodeTraits::set_next(tail, a.first);
+            r.last = a.last;
+            return r;
+         }
+         b.first = NodeTraits::get_next(tail);
+      }
+      else{
+         if(tail == a.last){
+            NodeTraits::set_next(tail, b.first);
+            r.last = b.last;
+            return r;
+         }
+         a.first = NodeTraits::get_next(tail);
+      }
+      const bool take_b = comp(b.first, a.first);
+      node_ptr const n = take_b ? b.first : a.first;
+      if(take_b != from_b){
+         NodeTraits::set_next(tail, n);
+         from_b = take_b;
+      }
+      tail = n;
+   }
+}
+
+//Index of the run with the smallest head, the first one on ties to keep the sort stable
+template<class NodeTraits, class Compare>
+std::size_t select_run(const run<NodeTraits> *runs, std::size_t m, Compare &comp)
+{
+   std::size_t best = 0u;
+   for(std::size_t i = 1u; i != m; ++i){
+      if(comp(runs[i].first, runs[best].first))
+         best = i;
+   }
+   return best;
+}
+
+//Merges m runs (in their original order) in a single pass. Each node is selected
+//with m-1 comparisons of run heads.
+template<class NodeTraits, class Compare>
+run<NodeTraits> merge_runs(run<NodeTraits> *runs, std::size_t m, Compare &comp)
+{
+   typedef typename NodeTraits::node_ptr node_ptr;
+   if(m == 1u)
+      return runs[0];
+   else if(m == 2u)
+      return (merge_two)(runs[0], runs[1], comp);
+
+   run<NodeTraits> r;
+   std::size_t cur = (select_run)(runs, m, comp);
+   node_ptr tail = runs[cur].first;
+   r.first = tail;
+   while(true){
+      if(tail == runs[cur].last){
+         //Run exhausted, erase it keeping the order of the rest
+         for(std::size_t i = cur + 1u; i != m; ++i)
+            runs[i - 1u] = runs[i];
+         if(--m == 2u){
+            const run<NodeTraits> rest = (merge_two)(runs[0], runs[1], comp);
+            NodeTraits::set_next(tail, rest.first);
+            r.last = rest.last;
+            return r;
+         }
+         cur = m;
+      }
+      else{
+         runs[cur].first = NodeTraits::get_next(tail);
+      }
+      const std::size_t next = (select_run)(runs, m, comp);
+      if(next != cur){
+         NodeTraits::set_next(tail, runs[next].first);
+         cur = next;
+      }
+      tail = runs[cur].first;
+   }
+}
+
+//Bottom-up merge sort of [first, last). Level l holds up to K-1 runs of K^l nodes,
+//when it gets K runs they are merged into a run of the next level, so each node is
+//visited log_K(n) times.
+template<class NodeTraits, std::size_t K, class Compare>
+run<NodeTraits> sort_runs(typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr const last, Compare &comp)
+{
+   BOOST_MOVE_STATIC_ASSERT(K >= 2u);
+   static const std::size_t max_levels = (sizeof(std::size_t)*CHAR_BIT)/log2_floor<K>::value + 1u;
+
+   run<NodeTraits> levels[max_levels][K];
+   std::size_t counts[max_levels] = {};
+   std::size_t used = 0u;
+
+   while(first != last){
+      run<NodeTraits> carry;
+      carry.first = carry.last = first;
+      first = NodeTraits::get_next(first);
+      std::size_t l = 0u;
+      for(; counts[l] == K - 1u; ++l){
+         levels[l][K - 1u] = carry;
+         carry = (merge_runs)(levels[l], K, comp);
+         counts[l] = 0u;
+      }
+      levels[l][counts[l]++] = carry;
+      if(l == used)
+         ++used;
+   }
+
+   //Lower levels hold the latest nodes, merge them after the runs of each level
+   run<NodeTraits> r;
+   bool merged = false;
+   for(std::size_t l = 0u; l != used; ++l){
+      if(merged)
+         levels[l][counts[l]++] = r;
+      if(counts[l]){
+         r = (merge_runs)(levels[l], counts[l], comp);
+         merged = true;
+      }
+   }
+   return r;
+}
+
+template<class NodeTraits, std::size_t K, class Compare>
+typename NodeTraits::node_ptr slist_sort
+   (typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr last, Compare &comp)
+{
+   if(first == last)
+      return first;
+   const run<NodeTraits> r = (sort_runs<NodeTraits, K>)(first, last, comp);
+   NodeTraits::set_next(r.last, last);
+   return r.first;
+}
+
+template<class NodeTraits, std::size_t K, class Compare>
+typename NodeTraits::node_ptr list_sort
+   (typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr last, Compare &comp)
+{
+   typedef typename NodeTraits::node_ptr node_ptr;
+   if(first == last)
+      return first;
+   node_ptr const prev = NodeTraits::get_previous(first);
+   const run<NodeTraits> r = (sort_runs<NodeTraits, K>)(first, last, comp);
+   //Merges only maintain next pointers, fix previous ones in a single pass
+   node_ptr p = prev;
+   for(node_ptr n = r.first; ; n = NodeTraits::get_next(n)){
+      NodeTraits::set_previous(n, p);
+      if(n == r.last)
+         break;
+      p = n;
+   }
+   NodeTraits::set_next(r.last, last);
+   if(last != node_ptr())
+      NodeTraits::set_previous(last, r.last);
+   if(prev != node_ptr())
+      NodeTraits::set_next(prev, r.first);
+   return r.first;
+}
+
+}  //namespace detail_list_sort {
+
+///@endcond
+
+//! <b>Effects</b>: Sorts the nodes of the singly linked list [first, last) using comp, preserving
+//!   the relative order of equivalent nodes. Nodes are relinked, values are never moved or copied,
+//!   so it's well suited to lists of big or non-movable elements. After the call the last sorted
+//!   node is linked to last.
+//!
+//! <b>Requires</b>: NodeTraits shall define a `node_ptr` type and static functions
+//!   `node_ptr get_next(node_ptr n)` and `void set_next(node_ptr n, node_ptr next)`
+//!   (e.g. the node traits of Boost.Intrusive's slist). last shall be reachable from first.
+//!   comp(a, b) is called with two node_ptr.
+//!
+//! <b>Returns</b>: The first node of the sorted sequence. The caller shall link the node
+//!   that preceded first (if any) to it.
+//!
+//! <b>Complexity</b>: At most N*log2(N) comparisons and no allocation. It's a bottom-up merge
+//!   sort and only the links between nodes coming from different merged runs are rewritten.
+template<class NodeTraits, class Compare>
+typename NodeTraits::node_ptr slist_sort
+   (typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr last, Compare comp)
+{
+   return detail_list_sort::slist_sort<NodeTraits, 2u>(first, last, comp);
+}
+
+//! <b>Effects</b>: Same as slist_sort(first, last, comp) but it merges K runs at once, so
+//!   each node is visited log_K(N) times instead of log2(N) times at the cost of K-1 comparisons
+//!   per node and pass. For nodes much bigger than a cache line this reduces the number of cache
+//!   misses, as each pass loads every node.
+//!
+//! <b>Requires</b>: K >= 2.
+template<class NodeTraits, std::size_t K, class Compare>
+typename NodeTraits::node_ptr slist_sort
+   (typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr last, Compare comp)
+{
+   return detail_list_sort::slist_sort<NodeTraits, K>(first, last, comp);
+}
+
+//! <b>Effects</b>: Sorts the nodes of the doubly linked list [first, last) using comp, preserving
+//!   the relative order of equivalent nodes. Nodes are relinked, values are never moved or copied.
+//!   Both links of the sorted nodes are updated, and so are the next pointer of the node that
+//!   preceded first and the previous pointer of last, if they are not null. This makes it
+//!   suitable for circular lists with a header node (like Boost.Intrusive's list, passing the
+//!   first node and the header) and for null-terminated lists.
+//!
+//! <b>Requires</b>: NodeTraits shall define a `node_ptr` type, whose value initialized
+//!   object is a null pointer, and static functions `node_ptr get_next(node_ptr n)`,
+//!   `void set_next(node_ptr n, node_ptr next)`, `node_ptr get_previous(node_ptr n)` and
+//!   `void set_previous(node_ptr n, node_ptr prev)` (e.g. the node traits of Boost.Intrusive's list).
+//!   last shall be reachable from first. comp(a, b) is called with two node_ptr.
+//!
+//! <b>Returns</b>: The first node of the sorted sequence.
+//!
+//! <b>Complexity</b>: At most N*log2(N) comparisons and no allocation.
+template<class NodeTraits, class Compare>
+typename NodeTraits::node_ptr list_sort
+   (typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr last, Compare comp)
+{
+   return detail_list_sort::list_sort<NodeTraits, 2u>(first, last, comp);
+}
+
+//! <b>Effects</b>: Same as list_sort(first, last, comp) but it merges K runs at once
+//!   (see the K-way version of slist_sort).
+//!
+//! <b>Requires</b>: K >= 2.
+template<class NodeTraits, std::size_t K, class Compare>
+typename NodeTraits::node_ptr list_sort
+   (typename NodeTraits::node_ptr first, typename NodeTraits::node_ptr last, Compare comp)
+{
+   return detail_list_sort::list_sort<NodeTraits, K>(first, last, comp);
+}
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif //#ifndef BOOST_MOVE_ALGO_LIST_SORT_HPP
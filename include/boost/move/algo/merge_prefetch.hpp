@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Software prefetching of the input and output streams of merge kernels.
+
+#ifndef BOOST_MOVE_ALGO_MERGE_PREFETCH_HPP
+#define BOOST_MOVE_ALGO_MERGE_PREFETCH_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/detail/iterator_to_raw_pointer.hpp>
+#include <boost/move/algo/move.hpp>
+#include <cstddef>
+
+//! Merge kernels prefetch the elements this number of bytes ahead of each cursor.
+#if !defined(BOOST_MOVE_MERGE_PREFETCH_DISTANCE)
+#  define BOOST_MOVE_MERGE_PREFETCH_DISTANCE 1024
+#endif
+
+//! By default, elements of at least this size are prefetched by merge kernels
+//! (see [classref boost::movelib::merge_prefetch merge_prefetch]).
+#if !defined(BOOST_MOVE_MERGE_PREFETCH_MIN_SIZE)
+#  define BOOST_MOVE_MERGE_PREFETCH_MIN_SIZE 64
+#endif
+
+///@cond
+
+#if defined(BOOST_MOVE_NO_MERGE_PREFETCH)
+   //Prefetching disabled
+#elif defined(BOOST_GCC) || defined(BOOST_CLANG) || defined(__GNUC__)
+#  define BOOST_MOVE_DETAIL_PREFETCH_READ(P)  __builtin_prefetch((P), 0, 3)
+#  define BOOST_MOVE_DETAIL_PREFETCH_WRITE(P) __builtin_prefetch((P), 1, 3)
+#elif defined(BOOST_MSVC) && (defined(_M_IX86) || defined(_M_X64) || defined(_M_AMD64))
+#  include <xmmintrin.h>
+#  define BOOST_MOVE_DETAIL_PREFETCH_READ(P)  _mm_prefetch(static_cast<const char*>(P), _MM_HINT_T0)
+#  define BOOST_MOVE_DETAIL_PREFETCH_WRITE(P) _mm_prefetch(static_cast<const char*>(P), _MM_HINT_T0)
+#endif
+
+///@endcond
+
+namespace boost {
+namespace movelib {
+
+//! Merge kernels of merge_sort, adaptive_sort and adaptive_merge (and the
+//! algorithms built on them) issue prefetch hints ahead of their cursors when
+//! sorting contiguous ranges of T if this trait is true. Large elements defeat
+//! hardware prefetchers earlier, as each cursor advances several cache lines
+//! per step. By default it's true if sizeof(T) >= BOOST_MOVE_MERGE_PREFETCH_MIN_SIZE.
+//!
+//! Users can specialize it to enable or disable prefetching for their types.
+//! Defining BOOST_MOVE_NO_MERGE_PREFETCH disables it for all types.
+template<class T>
+struct merge_prefetch
+{
+   static const bool value = sizeof(T) >= std::size_t(BOOST_MOVE_MERGE_PREFETCH_MIN_SIZE);
+};
+
+///@cond
+
+namespace detail_prefetch {
+
+template<class It>
+struct enabled
+{
+   static const bool value =
+   #if defined(BOOST_MOVE_DETAIL_PREFETCH_READ)
+      ::boost::move_detail::is_contiguous_iterator<It>::value &&
+      merge_prefetch<typename ::boost::movelib::iter_value<It>::type>::value;
+   #else
+      false;
+   #endif
+};
+
+//The address is computed with integers as it might be outside the range
+template<class It>
+BOOST_MOVE_FORCEINLINE const void *address(const It &it, bool forward)
+{
+   const std::size_t p = reinterpret_cast<std::size_t>(::boost::movelib::iterator_to_raw_pointer(it));
+   return reinterpret_cast<const void*>
+      (forward ? p + std::size_t(BOOST_MOVE_MERGE_PREFETCH_DISTANCE) : p - std::size_t(BOOST_MOVE_MERGE_PREFETCH_DISTANCE));
+}
+
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void read(const It &it, bool forward, ::boost::move_detail::true_)
+{
+   #if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+   if(BOOST_MOVE_IS_CONSTANT_EVALUATED())
+      return;
+   #endif
+   BOOST_MOVE_DETAIL_PREFETCH_READ((address)(it, forward));
+}
+
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void write(const It &it, bool forward, ::boost::move_detail::true_)
+{
+   #if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+   if(BOOST_MOVE_IS_CONSTANT_EVALUATED())
+      return;
+   #endif
+   BOOST_MOVE_DETAIL_PREFETCH_WRITE((address)(it, forward));
+}
+
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void read(const It &, bool, ::boost::move_detail::false_)
+{}
+
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void write(const It &, bool, ::boost::move_detail::false_)
+{}
+
+}  //namespace detail_prefetch {
+
+//Hints that a merge cursor reading forward (backward) will soon read the elements ahead of (behind) it
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void prefetch_read_forward(const It &it)
+{  detail_prefetch::read(it, true, ::boost::move_detail::bool_<detail_prefetch::enabled<It>::value>());  }
+
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void prefetch_read_backward(const It &it)
+{  detail_prefetch::read(it, false, ::boost::move_detail::bool_<detail_prefetch::enabled<It>::value>());  }
+
+//Hints that a merge cursor writing forward (backward) will soon write the elements ahead of (behind) it
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void prefetch_write_forward(const It &it)
+{  detail_prefetch::write(it, true, ::boost::move_detail::bool_<detail_prefetch::enabled<It>::value>());  }
+
+template<class It>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void prefetch_write_backward(const It &it)
+{  detail_prefetch::write(it, false, ::boost::move_detail::bool_<detail_prefetch::enabled<It>::value>());  }
+
+///@endcond
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif //#ifndef BOOST_MOVE_ALGO_MERGE_PREFETCH_HPP
@@ -25,15 +25,26 @@
 #include <boost/move/detail/config_begin.hpp>
 
 #include <boost/move/utility_core.hpp>
+#include <boost/move/iterator.hpp>
 #include <boost/move/detail/iterator_traits.hpp>
 #include <boost/move/detail/iterator_to_raw_pointer.hpp>
 #include <boost/move/detail/addressof.hpp>
+#include <boost/move/detail/type_traits.hpp>
 #if defined(BOOST_MOVE_USE_STANDARD_LIBRARY_MOVE)
 #include <algorithm>
 #endif
 
 namespace boost {
 
+/// @cond
+namespace container {
+
+template <class Pointer, bool IsConst>
+class vec_iterator;
+
+}  //namespace container {
+/// @endcond
+
 //////////////////////////////////////////////////////////////////////////////
 //
 //                               move
@@ -53,7 +64,7 @@ namespace boost {
    //! <b>Complexity</b>: Exactly last - first move assignments.
    template <typename I, // I models InputIterator
             typename O> // O models OutputIterator
-   O move(I f, I l, O result)
+   BOOST_MOVE_CONSTEXPR20 O move(I f, I l, O result)
    {
       while (f != l) {
          *result = ::boost::move(*f);
@@ -80,7 +91,7 @@ namespace boost {
    //! <b>Complexity</b>: Exactly last - first assignments.
    template <typename I, // I models BidirectionalIterator
    typename O> // O models BidirectionalIterator
-   O move_backward(I f, I l, O result)
+   BOOST_MOVE_CONSTEXPR20 O move_backward(I f, I l, O result)
    {
       while (f != l) {
          --l; --result;
@@ -95,6 +106,196 @@ namespace boost {
 
 #endif   //!defined(BOOST_MOVE_USE_STANDARD_LIBRARY_MOVE)
 
+//////////////////////////////////////////////////////////////////////////////
+//
+//                        move to move insert iterators
+//
+//////////////////////////////////////////////////////////////////////////////
+
+/// @cond
+namespace move_detail {
+
+//Only the standard multi-pass categories are detected, any other
+//category conservatively falls back to element by element insertion
+template<class It>
+struct is_multipass_iterator
+{
+   typedef typename ::boost::movelib::iter_category<It>::type category;
+   static const bool value = is_same<category, std::forward_iterator_tag>::value
+                          || is_same<category, std::bidirectional_iterator_tag>::value
+                          || is_same<category, std::random_access_iterator_tag>::value
+                          #if defined(BOOST_MOVE_CONTIGUOUS_ITERATOR_TAG)
+                          || is_same<category, std::contiguous_iterator_tag>::value
+                          #endif
+                          ;
+};
+
+template<class It>
+struct is_random_access_iterator
+{
+   typedef typename ::boost::movelib::iter_category<It>::type category;
+   static const bool value = is_same<category, std::random_access_iterator_tag>::value
+                          #if defined(BOOST_MOVE_CONTIGUOUS_ITERATOR_TAG)
+                          || is_same<category, std::contiguous_iterator_tag>::value
+                          #endif
+                          ;
+};
+
+#if defined(BOOST_MOVE_CONTIGUOUS_ITERATOR_TAG)
+
+template<class It>
+struct has_iterator_concept
+{
+   template<class U> static yes_type test(typename U::iterator_concept*);
+   template<class U> static no_type  test(...);
+
+   static const bool value = sizeof(test<It>(0)) == sizeof(yes_type);
+};
+
+//Standard library iterators keep random_access_iterator_tag as category
+//and only announce contiguity through the C++20 iterator_concept
+template<class It, bool = has_iterator_concept<It>::value>
+struct has_contiguous_concept
+{
+   static const bool value = false;
+};
+
+template<class It>
+struct has_contiguous_concept<It, true>
+{
+   static const bool value = is_same<typename It::iterator_concept, std::contiguous_iterator_tag>::value;
+};
+
+#endif   //BOOST_MOVE_CONTIGUOUS_ITERATOR_TAG
+
+template<class It>
+struct is_known_contiguous_iterator
+{
+   static const bool value = false;
+};
+
+//Boost.Container vector iterators only announce random access
+template<class Pointer, bool IsConst>
+struct is_known_contiguous_iterator< ::boost::container::vec_iterator<Pointer, IsConst> >
+{
+   static const bool value = is_pointer<Pointer>::value;
+};
+
+//Pointers and iterators over contiguous elements that yield raw pointers with
+//operator->: contiguous iterators (by category or, in C++20, by iterator_concept)
+//and Boost.Container vector iterators
+template<class It, bool = is_pointer<It>::value>
+struct is_contiguous_iterator
+{
+   static const bool value = is_pointer<typename ::boost::movelib::iterator_traits<It>::pointer>::value &&
+                           ( is_known_contiguous_iterator<It>::value
+                           #if defined(BOOST_MOVE_CONTIGUOUS_ITERATOR_TAG)
+                           || is_same<typename ::boost::movelib::iter_category<It>::type, std::contiguous_iterator_tag>::value
+                           || has_contiguous_concept<It>::value
+                           #endif
+                           );
+};
+
+template<class It>
+struct is_contiguous_iterator<It, true>
+{
+   static const bool value = true;
+};
+
+template<class It>
+inline ::boost::move_iterator<It> as_move_iterator(It i)
+{  return ::boost::move_iterator<It>(i);  }
+
+template<class It>
+inline ::boost::move_iterator<It> as_move_iterator(::boost::move_iterator<It> i)
+{  return i;  }
+
+//Detects c.insert(c.end(), first, last) callable with the move iterators built
+//from I. Containers without range insertion are filled element by element.
+template<class C, class I>
+struct has_range_insert_member
+{
+   template<class T> static T &lvalue();
+
+   #if !defined(BOOST_NO_SFINAE_EXPR)
+   template<class U> static yes_type test
+      (char (*)[sizeof(((void)lvalue<U>().insert(lvalue<U>().end(), (as_move_iterator)(lvalue<I>()), (as_move_iterator)(lvalue<I>())), 0))]);
+   #endif
+   template<class U> static no_type  test(...);
+
+   static const bool value = sizeof(test<C>(0)) == sizeof(yes_type);
+};
+
+template <class I, class O>
+inline O move_one_by_one(I f, I l, O r)
+{
+   while (f != l) {
+      *r = ::boost::move(*f);
+      ++f; ++r;
+   }
+   return r;
+}
+
+template <class I, class C>
+inline back_move_insert_iterator<C> move_to_inserter
+   (I f, I l, back_move_insert_iterator<C> r, bool_<true>)
+{
+   C &c = r.container();
+   c.insert(c.end(), (as_move_iterator)(f), (as_move_iterator)(l));
+   return r;
+}
+
+template <class I, class C>
+inline move_insert_iterator<C> move_to_inserter
+   (I f, I l, move_insert_iterator<C> r, bool_<true>)
+{
+   //The insertion position is recomputed as range insertion might invalidate it
+   C &c = r.container();
+   typedef typename C::difference_type difference_type;
+   const typename C::size_type old_size = c.size();
+   const difference_type off = r.position() - c.begin();
+   c.insert(r.position(), (as_move_iterator)(f), (as_move_iterator)(l));
+   return move_insert_iterator<C>(c, c.begin() + (off + difference_type(c.size() - old_size)));
+}
+
+template <class I, class O>
+inline O move_to_inserter(I f, I l, O r, bool_<false>)
+{  return (move_one_by_one)(f, l, r);  }
+
+}  //namespace move_detail {
+/// @endcond
+
+//! <b>Effects</b>: Moves elements in the range [first,last) to the back of r.container().
+//!   If I is a forward iterator and C has a range insertion member (c.insert(pos, first, last)),
+//!   the elements are inserted with a single range insertion, so that the container can compute
+//!   the final size and grow at most once. Otherwise it behaves as the generic move overload.
+//!
+//! <b>Returns</b>: r.
+template <typename I, // I models InputIterator
+          typename C> // C models Container
+inline back_move_insert_iterator<C> move(I f, I l, back_move_insert_iterator<C> r)
+{
+   return ::boost::move_detail::move_to_inserter
+      (f, l, r, ::boost::move_detail::bool_< ::boost::move_detail::is_multipass_iterator<I>::value &&
+                    ::boost::move_detail::has_range_insert_member<C, I>::value>());
+}
+
+//! <b>Effects</b>: Moves elements in the range [first,last) into r.container() before r.position().
+//!   If I is a forward iterator, C's iterators are random-access and C has a range insertion
+//!   member, the elements are inserted with a single range insertion. Otherwise it behaves
+//!   as the generic move overload.
+//!
+//! <b>Returns</b>: An iterator that inserts after the last moved element.
+template <typename I, // I models InputIterator
+          typename C> // C models Container
+inline move_insert_iterator<C> move(I f, I l, move_insert_iterator<C> r)
+{
+   return ::boost::move_detail::move_to_inserter
+      (f, l, r, ::boost::move_detail::bool_< ::boost::move_detail::is_multipass_iterator<I>::value &&
+                    ::boost::move_detail::is_random_access_iterator<typename C::iterator>::value &&
+                    ::boost::move_detail::has_range_insert_member<C, I>::value>());
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 //                               uninitialized_move
@@ -0,0 +1,491 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Multithreaded move, move_backward and uninitialized_move for big contiguous ranges.
+
+#ifndef BOOST_MOVE_ALGO_PARALLEL_MOVE_HPP
+#define BOOST_MOVE_ALGO_PARALLEL_MOVE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/algo/move.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/detail/iterator_to_raw_pointer.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <cstddef>
+
+///@cond
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_EXCEPTION) && \
+    !defined(BOOST_NO_EXCEPTIONS) && !defined(BOOST_MOVE_NO_PARALLEL_MOVE)
+#  define BOOST_MOVE_DETAIL_HAS_PARALLEL_MOVE
+#  include <cstdint>
+#  include <exception>
+#  include <thread>
+#  include <vector>
+#endif
+
+///@endcond
+
+namespace boost {
+namespace movelib {
+
+//! Execution policy for the multithreaded overloads of
+//! [funcref boost::move move], [funcref boost::move_backward move_backward] and
+//! [funcref boost::uninitialized_move uninitialized_move].
+//!
+//! Ranges are split in chunks of at least min_chunk_bytes() bytes whose boundaries
+//! are aligned to pages of the destination, so that no page is written by two threads.
+//! Chunks are processed by up to max_threads() threads, including the calling one.
+//! Threads are launched on each call, so the policy only pays off for ranges of several
+//! megabytes, smaller ranges are processed by the calling thread.
+//!
+//! Only contiguous ranges (pointers, Boost.Container vector iterators and, in C++20, contiguous
+//! iterators such as those of std::vector) are processed in parallel. If the standard library
+//! lacks <tt>&lt;thread&gt;</tt>, exceptions are disabled or BOOST_MOVE_NO_PARALLEL_MOVE is
+//! defined, all ranges are processed serially.
+class parallel_policy
+{
+   public:
+   //! Minimum number of bytes moved by each thread by default
+   static const std::size_t default_min_chunk_bytes = std::size_t(1u) << 20u;
+
+   //! <b>Effects</b>: Constructs a policy that uses up to max_threads threads (if zero,
+   //!   the number of hardware threads) and moves at least min_chunk_bytes per thread.
+   explicit parallel_policy(std::size_t max_threads = 0u, std::size_t min_chunk_bytes = default_min_chunk_bytes)
+      : m_max_threads(max_threads), m_min_chunk_bytes(min_chunk_bytes ? min_chunk_bytes : 1u)
+   {}
+
+   //! <b>Returns</b>: The maximum number of threads, zero meaning the number of hardware threads.
+   std::size_t max_threads() const
+   {  return m_max_threads;  }
+
+   //! <b>Returns</b>: The minimum number of bytes moved by each thread.
+   std::size_t min_chunk_bytes() const
+   {  return m_min_chunk_bytes;  }
+
+   private:
+   std::size_t m_max_threads;
+   std::size_t m_min_chunk_bytes;
+};
+
+//! Default parallel policy
+static const parallel_policy par = parallel_policy();
+
+///@cond
+
+namespace detail_parallel_move {
+
+//Chunk boundaries are aligned to this size in the destination
+static const std::size_t page_size = 4096u;
+
+template<class I, class O>
+struct has_raw_pointers
+{
+   typedef typename ::boost::movelib::iter_value<I>::type value_type;
+   static const bool value = ::boost::move_detail::is_contiguous_iterator<I>::value && ::boost::move_detail::is_contiguous_iterator<O>::value &&
+      ::boost::move_detail::is_same<typename ::boost::movelib::iterator_traits<I>::pointer, value_type*>::value &&
+      ::boost::move_detail::is_same<typename ::boost::movelib::iterator_traits<O>::pointer, value_type*>::value;
+};
+
+#if defined(BOOST_MOVE_DETAIL_HAS_PARALLEL_MOVE)
+
+inline std::size_t gcd(std::size_t a, std::size_t b)
+{
+   while(b){
+      const std::size_t t = a % b;
+      a = b;
+      b = t;
+   }
+   return a;
+}
+
+//Splits [0, n) in chunks whose boundaries are page aligned in the destination
+//("dst" points to the first destination element). Chunk i is [bound(i), bound(i+1)).
+class chunk_plan
+{
+   public:
+   chunk_plan(const parallel_policy &pol, const void *dst, std::size_t n, std::size_t elem_size)
+      : m_n(n), m_head(0u), m_len(n), m_chunks(1u)
+   {
+      //Smallest number of elements that fills a whole number of pages
+      const std::size_t granule = page_size/gcd(page_size, elem_size);
+      std::size_t min_len = pol.min_chunk_bytes()/elem_size;
+      min_len = (min_len + granule - 1u)/granule*granule;
+      if(min_len < granule)
+         min_len = granule;
+      std::size_t threads = pol.max_threads();
+      if(!threads)
+         threads = std::thread::hardware_concurrency();
+      if(threads < 2u || n/min_len < 2u)
+         return;
+      //Elements until the first page boundary, if elements don't straddle pages
+      const std::size_t addr = std::size_t(reinterpret_cast<std::uintptr_t>(dst));
+      if(granule*elem_size == page_size && addr % elem_size == 0u){
+         m_head = ((page_size - addr % page_size) % page_size)/elem_size;
+      }
+      std::size_t chunks = n/min_len;
+      if(chunks > threads)
+         chunks = threads;
+      m_len = ((n - m_head)/chunks + granule - 1u)/granule*granule;
+      m_chunks = (n - m_head + m_len - 1u)/m_len;
+   }
+
+   std::size_t chunks() const
+   {  return m_chunks;  }
+
+   std::size_t bound(std::size_t i) const
+   {
+      if(!i)
+         return 0u;
+      const std::size_t b = m_head + i*m_len;
+      return b < m_n ? b : m_n;
+   }
+
+   private:
+   std::size_t m_n;
+   std::size_t m_head;
+   std::size_t m_len;
+   std::size_t m_chunks;
+};
+
+template<class Task>
+class chunk_runner
+{
+   public:
+   chunk_runner(const Task &task, std::size_t i, std::exception_ptr &error)
+      : m_task(&task), m_i(i), m_error(&error)
+   {}
+
+   void operator()() const
+   {
+      try{
+         (*m_task)(m_i);
+      }
+      catch(...){
+         *m_error = std::current_exception();
+      }
+   }
+
+   private:
+   const Task *m_task;
+   std::size_t m_i;
+   std::exception_ptr *m_error;
+};
+
+//Runs task(i) for every chunk i, the calling thread runs chunk 0. Returns after all
+//chunks have finished, leaving in errors[i] the exception thrown by chunk i, if any.
+template<class Task>
+void run_chunks(const Task &task, std::size_t chunks, std::vector<std::exception_ptr> &errors)
+{
+   errors.assign(chunks, std::exception_ptr());
+   std::vector<std::thread> threads;
+   std::size_t i = 1u;
+   try{
+      threads.reserve(chunks - 1u);
+      for(; i != chunks; ++i){
+         threads.push_back(std::thread(chunk_runner<Task>(task, i, errors[i])));
+      }
+   }
+   catch(...){
+      //Couldn't launch more threads: the remaining chunks are run by this thread
+   }
+   for(std::size_t j = i; j != chunks; ++j){
+      chunk_runner<Task>(task, j, errors[j])();
+   }
+   chunk_runner<Task>(task, 0u, errors[0])();
+   for(std::size_t j = 0; j != threads.size(); ++j){
+      threads[j].join();
+   }
+}
+
+inline void rethrow_first(const std::vector<std::exception_ptr> &errors)
+{
+   for(std::size_t i = 0; i != errors.size(); ++i){
+      if(errors[i])
+         std::rethrow_exception(errors[i]);
+   }
+}
+
+template<class T>
+class move_task
+{
+   public:
+   move_task(const chunk_plan &plan, T *src, T *dst)
+      : m_plan(&plan), m_src(src), m_dst(dst)
+   {}
+
+   void operator()(std::size_t i) const
+   {
+      const std::size_t b = m_plan->bound(i), e = m_plan->bound(i+1u);
+      ::boost::move(m_src + b, m_src + e, m_dst + b);
+   }
+
+   private:
+   const chunk_plan *m_plan;
+   T *m_src;
+   T *m_dst;
+};
+
+template<class T>
+class uninitialized_move_task
+{
+   public:
+   uninitialized_move_task(const chunk_plan &plan, T *src, T *dst)
+      : m_plan(&plan), m_src(src), m_dst(dst)
+   {}
+
+   void operator()(std::size_t i) const
+   {
+      const std::size_t b = m_plan->bound(i), e = m_plan->bound(i+1u);
+      ::boost::uninitialized_move(m_src + b, m_src + e, m_dst + b);
+   }
+
+   private:
+   const chunk_plan *m_plan;
+   T *m_src;
+   T *m_dst;
+};
+
+//Moves [src, src + n) to the non-overlapping [dst, dst + n)
+template<class T>
+void move_disjoint(const parallel_policy &pol, T *src, T *dst, std::size_t n)
+{
+   const chunk_plan plan(pol, dst, n, sizeof(T));
+   if(plan.chunks() < 2u){
+      ::boost::move(src, src + n, dst);
+      return;
+   }
+   std::vector<std::exception_ptr> errors;
+   (run_chunks)(move_task<T>(plan, src, dst), plan.chunks(), errors);
+   (rethrow_first)(errors);
+}
+
+//Moves [src, src + n) to [dst, dst + n), dst < src
+template<class T>
+void move_overlapping_forward(const parallel_policy &pol, T *src, T *dst, std::size_t n)
+{
+   const std::size_t d = std::size_t(src - dst);
+   if(d >= n){
+      (move_disjoint)(pol, src, dst, n);
+   }
+   else if(chunk_plan(pol, dst, d, sizeof(T)).chunks() < 2u){
+      ::boost::move(src, src + n, dst);
+   }
+   else{
+      //Overlapping: blocks of d elements are moved in parallel from front to back.
+      //The destination of each block was the source of the previous one.
+      for(std::size_t x = 0; x < n; x += d){
+         const std::size_t len = (n - x) < d ? (n - x) : d;
+         (move_disjoint)(pol, src + x, dst + x, len);
+      }
+   }
+}
+
+//Moves [src, src + n) to [dst, dst + n), dst > src
+template<class T>
+void move_overlapping_backward(const parallel_policy &pol, T *src, T *dst, std::size_t n)
+{
+   const std::size_t d = std::size_t(dst - src);
+   if(d >= n){
+      (move_disjoint)(pol, src, dst, n);
+   }
+   else if(chunk_plan(pol, dst, d, sizeof(T)).chunks() < 2u){
+      ::boost::move_backward(src, src + n, dst + n);
+   }
+   else{
+      //Overlapping: blocks of d elements are moved in parallel from back to front.
+      //The destination of each block was the source of the previous one.
+      for(std::size_t x = n; x > 0u; ){
+         const std::size_t len = x < d ? x : d;
+         x -= len;
+         (move_disjoint)(pol, src + x, dst + x, len);
+      }
+   }
+}
+
+template<class T>
+void uninitialized_move_disjoint(const parallel_policy &pol, T *src, T *dst, std::size_t n)
+{
+   const chunk_plan plan(pol, dst, n, sizeof(T));
+   if(plan.chunks() < 2u){
+      ::boost::uninitialized_move(src, src + n, dst);
+      return;
+   }
+   std::vector<std::exception_ptr> errors;
+   (run_chunks)(uninitialized_move_task<T>(plan, src, dst), plan.chunks(), errors);
+   bool failed = false;
+   for(std::size_t i = 0; i != errors.size(); ++i){
+      failed = failed || errors[i];
+   }
+   if(failed){
+      //Failed chunks have already destroyed their elements, destroy the rest
+      for(std::size_t i = 0; i != errors.size(); ++i){
+         if(!errors[i]){
+            for(std::size_t j = plan.bound(i), e = plan.bound(i+1u); j != e; ++j){
+               dst[j].~T();
+            }
+         }
+      }
+      (rethrow_first)(errors);
+   }
+}
+
+#endif   //#if defined(BOOST_MOVE_DETAIL_HAS_PARALLEL_MOVE)
+
+template<class I, class O>
+inline O parallel_move(const parallel_policy &, I f, I l, O r, ::boost::move_detail::false_type)
+{  return ::boost::move(f, l, r);  }
+
+template<class I, class O>
+inline O parallel_move_backward(const parallel_policy &, I f, I l, O r, ::boost::move_detail::false_type)
+{  return ::boost::move_backward(f, l, r);  }
+
+template<class I, class F>
+inline F parallel_uninitialized_move(const parallel_policy &, I f, I l, F r, ::boost::move_detail::false_type)
+{  return ::boost::uninitialized_move(f, l, r);  }
+
+#if defined(BOOST_MOVE_DETAIL_HAS_PARALLEL_MOVE)
+
+template<class I, class O>
+O parallel_move(const parallel_policy &pol, I f, I l, O r, ::boost::move_detail::true_type)
+{
+   const std::size_t n = std::size_t(l - f);
+   if(n){
+      typedef typename ::boost::movelib::iter_value<I>::type value_type;
+      value_type *const src = ::boost::movelib::iterator_to_raw_pointer(f);
+      value_type *const dst = ::boost::movelib::iterator_to_raw_pointer(r);
+      if(dst < src){
+         (move_overlapping_forward)(pol, src, dst, n);
+      }
+      else if(dst != src){
+         (move_disjoint)(pol, src, dst, n);
+      }
+   }
+   return r + typename ::boost::movelib::iter_difference<O>::type(n);
+}
+
+template<class I, class O>
+O parallel_move_backward(const parallel_policy &pol, I f, I l, O r, ::boost::move_detail::true_type)
+{
+   const std::size_t n = std::size_t(l - f);
+   O const first = r - typename ::boost::movelib::iter_difference<O>::type(n);
+   if(n){
+      typedef typename ::boost::movelib::iter_value<I>::type value_type;
+      value_type *const src = ::boost::movelib::iterator_to_raw_pointer(f);
+      value_type *const dst = ::boost::movelib::iterator_to_raw_pointer(first);
+      if(dst > src){
+         (move_overlapping_backward)(pol, src, dst, n);
+      }
+      else if(dst != src){
+         (move_disjoint)(pol, src, dst, n);
+      }
+   }
+   return first;
+}
+
+template<class I, class F>
+F parallel_uninitialized_move(const parallel_policy &pol, I f, I l, F r, ::boost::move_detail::true_type)
+{
+   const std::size_t n = std::size_t(l - f);
+   if(n){
+      (uninitialized_move_disjoint)
+         (pol, ::boost::movelib::iterator_to_raw_pointer(f), ::boost::movelib::iterator_to_raw_pointer(r), n);
+   }
+   return r + typename ::boost::movelib::iter_difference<F>::type(n);
+}
+
+#endif   //#if defined(BOOST_MOVE_DETAIL_HAS_PARALLEL_MOVE)
+
+template<class I, class O>
+struct use_parallel
+   : ::boost::move_detail::bool_
+      <
+      #if defined(BOOST_MOVE_DETAIL_HAS_PARALLEL_MOVE)
+      has_raw_pointers<I, O>::value
+      #else
+      false
+      #endif
+      >
+{};
+
+}  //namespace detail_parallel_move {
+
+///@endcond
+
+}  //namespace movelib {
+
+//! <b>Effects</b>: Same as boost::move(first, last, result), but big contiguous ranges are moved
+//!   by several threads as specified by "pol".
+//!
+//! <b>Requires</b>: result shall not be in the range [first,last). Overlapping ranges with
+//!   result < first are moved correctly: blocks that don't overlap their destination are moved
+//!   in parallel, one block after another.
+//!
+//! <b>Returns</b>: result + (last - first).
+//!
+//! <b>Throws</b>: If a move assignment throws, the first exception is rethrown after all threads have
+//!   finished. Elements might have been moved in any order.
+template <typename I, // I models RandomAccessIterator
+          typename O> // O models RandomAccessIterator
+inline O move(const movelib::parallel_policy &pol, I f, I l, O result)
+{
+   return movelib::detail_parallel_move::parallel_move
+      (pol, f, l, result, movelib::detail_parallel_move::use_parallel<I, O>());
+}
+
+//! <b>Effects</b>: Same as boost::move_backward(first, last, result), but big contiguous ranges are
+//!   moved by several threads as specified by "pol".
+//!
+//! <b>Requires</b>: result shall not be in the range (first,last]. Overlapping ranges with
+//!   result > last are moved correctly: blocks that don't overlap their destination are moved
+//!   in parallel, one block after another.
+//!
+//! <b>Returns</b>: result - (last - first).
+//!
+//! <b>Throws</b>: If a move assignment throws, the first exception is rethrown after all threads have
+//!   finished. Elements might have been moved in any order.
+template <typename I, // I models RandomAccessIterator
+          typename O> // O models RandomAccessIterator
+inline O move_backward(const movelib::parallel_policy &pol, I f, I l, O result)
+{
+   return movelib::detail_parallel_move::parallel_move_backward
+      (pol, f, l, result, movelib::detail_parallel_move::use_parallel<I, O>());
+}
+
+//! <b>Effects</b>: Same as boost::uninitialized_move(first, last, result), but big contiguous ranges are
+//!   constructed by several threads as specified by "pol".
+//!
+//! <b>Returns</b>: result + (last - first).
+//!
+//! <b>Throws</b>: If a move constructor throws, all elements constructed by any thread are destroyed and
+//!   the first exception is rethrown after all threads have finished.
+template <typename I, // I models RandomAccessIterator
+          typename F> // F models RandomAccessIterator
+inline F uninitialized_move(const movelib::parallel_policy &pol, I f, I l, F result)
+{
+   return movelib::detail_parallel_move::parallel_uninitialized_move
+      (pol, f, l, result, movelib::detail_parallel_move::use_parallel<I, F>());
+}
+
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif //#ifndef BOOST_MOVE_ALGO_PARALLEL_MOVE_HPP
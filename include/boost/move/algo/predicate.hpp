@@ -24,19 +24,19 @@ namespace movelib {
 template<class Comp>
 struct antistable
 {
-   inline explicit antistable(Comp &comp)
+   inline BOOST_MOVE_CONSTEXPR20 explicit antistable(Comp &comp)
       : m_comp(comp)
    {}
 
-   inline antistable(const antistable & other)
+   inline BOOST_MOVE_CONSTEXPR20 antistable(const antistable & other)
       : m_comp(other.m_comp)
    {}
 
    template<class U, class V>
-   inline bool operator()(const U &u, const V & v)
+   inline BOOST_MOVE_CONSTEXPR20 bool operator()(const U &u, const V & v)
    {  return !m_comp(v, u);  }
 
-   inline const Comp &get() const
+   inline BOOST_MOVE_CONSTEXPR20 const Comp &get() const
    {  return m_comp; }
 
    private:
@@ -45,26 +45,26 @@ struct antistable
 };
 
 template<class Comp>
-Comp unantistable(Comp comp)
+BOOST_MOVE_CONSTEXPR20 Comp unantistable(Comp comp)
 {   return comp;  }
 
 template<class Comp>
-Comp unantistable(antistable<Comp> comp)
+BOOST_MOVE_CONSTEXPR20 Comp unantistable(antistable<Comp> comp)
 {   return comp.get();  }
 
 template <class Comp>
 class negate
 {
    public:
-   inline negate()
+   inline BOOST_MOVE_CONSTEXPR20 negate()
    {}
 
-   inline explicit negate(Comp comp)
+   inline BOOST_MOVE_CONSTEXPR20 explicit negate(Comp comp)
       : m_comp(comp)
    {}
 
    template <class T1, class T2>
-   inline bool operator()(const T1& l, const T2& r)
+   inline BOOST_MOVE_CONSTEXPR20 bool operator()(const T1& l, const T2& r)
    {
       return !m_comp(l, r);
    }
@@ -78,15 +78,15 @@ template <class Comp>
 class inverse
 {
    public:
-   inline inverse()
+   inline BOOST_MOVE_CONSTEXPR20 inverse()
    {}
 
-   inline explicit inverse(Comp comp)
+   inline BOOST_MOVE_CONSTEXPR20 explicit inverse(Comp comp)
       : m_comp(comp)
    {}
 
    template <class T1, class T2>
-   inline bool operator()(const T1& l, const T2& r)
+   inline BOOST_MOVE_CONSTEXPR20 bool operator()(const T1& l, const T2& r)
    {
       return m_comp(r, l);
    }
@@ -0,0 +1,289 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Reusable scratch memory for the buffered sorting and merging algorithms.
+
+#ifndef BOOST_MOVE_ALGO_SCRATCH_ARENA_HPP
+#define BOOST_MOVE_ALGO_SCRATCH_ARENA_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <cstddef>
+#include <new>
+
+namespace boost {
+namespace movelib {
+
+//! Usage counters of a [classref boost::movelib::scratch_arena scratch_arena].
+struct scratch_arena_stats
+{
+   //! Requests served with the memory already owned by the arena
+   std::size_t hits;
+   //! Requests that needed a (bigger) block to be allocated
+   std::size_t misses;
+   //! Requests that could not be served: allocation failed or the arena was in use
+   std::size_t failures;
+   //! Biggest request served, in bytes
+   std::size_t peak_bytes;
+};
+
+//! A single block of raw memory reused by successive sorting and merging calls,
+//! so that buffered algorithms don't allocate and deallocate a temporary buffer
+//! on each call.
+//!
+//! The block grows geometrically (at least doubling its size) when a bigger request arrives
+//! and it's only released by trim() or on destruction. Only one request can be served at
+//! a time: requests made while the block is in use fail, so algorithms called recursively
+//! (e.g. from a comparison function) degrade to their unbuffered versions.
+//!
+//! The block is aligned for any fundamental type and its capacity is a multiple of that
+//! alignment, so the trailing part of a buffer of elements can store integral keys.
+//!
+//! A scratch_arena is not thread-safe. Use one per thread, e.g. thread_instance().
+class scratch_arena
+{
+   scratch_arena(const scratch_arena &);
+   scratch_arena & operator=(const scratch_arena &);
+
+   public:
+   //! Alignment of the memory returned by acquire()
+   static const std::size_t alignment = ::boost::move_detail::alignment_of< ::boost::move_detail::max_align_t>::value;
+
+   //! <b>Effects</b>: Constructs an arena that owns no memory.
+   scratch_arena()
+      : m_ptr(), m_capacity(), m_in_use(false)
+   {  this->clear_stats();  }
+
+   //! <b>Effects</b>: Deallocates the owned block.
+   //!
+   //! <b>Requires</b>: The arena is not in use.
+   ~scratch_arena()
+   {  ::operator delete(m_ptr);  }
+
+   //! <b>Effects</b>: Marks the arena as in use and returns a block of at least "bytes" bytes.
+   //!   If the owned block is smaller, it's replaced by a block of max(bytes, 2*capacity()) bytes
+   //!   (or exactly "bytes" if that fails).
+   //!
+   //! <b>Returns</b>: The block or null if the arena is already in use or allocation failed.
+   //!   Requests of zero bytes return null and don't mark the arena as in use nor update stats().
+   //!
+   //! <b>Throws</b>: Nothing.
+   void *acquire(std::size_t bytes)
+   {
+      if(!bytes){
+         return 0;
+      }
+      if(m_in_use){
+         ++m_stats.failures;
+         return 0;
+      }
+      if(bytes > m_capacity){
+         std::size_t const rounded = round_to_alignment(bytes);
+         if(rounded < bytes){ //overflow
+            ++m_stats.failures;
+            return 0;
+         }
+         std::size_t next = m_capacity <= std::size_t(-1)/2u ? m_capacity*2u : rounded;
+         next = next < rounded ? rounded : next;
+         ::operator delete(m_ptr);
+         m_ptr = ::operator new(next, std::nothrow);
+         if(!m_ptr && next != rounded){
+            next = rounded;
+            m_ptr = ::operator new(next, std::nothrow);
+         }
+         m_capacity = m_ptr ? next : 0u;
+         if(!m_ptr){
+            ++m_stats.failures;
+            return 0;
+         }
+         ++m_stats.misses;
+      }
+      else{
+         ++m_stats.hits;
+      }
+      if(bytes > m_stats.peak_bytes)
+         m_stats.peak_bytes = bytes;
+      m_in_use = true;
+      return m_ptr;
+   }
+
+   //! <b>Effects</b>: Marks the arena as not in use. The block is kept for later requests.
+   void release()
+   {  m_in_use = false;  }
+
+   //! <b>Effects</b>: If the arena is not in use and its capacity is bigger than "max_bytes",
+   //!   the block is deallocated. The next request will allocate a block of the requested size.
+   void trim(std::size_t max_bytes = 0u)
+   {
+      if(!m_in_use && m_capacity > max_bytes){
+         ::operator delete(m_ptr);
+         m_ptr = 0;
+         m_capacity = 0u;
+      }
+   }
+
+   //! <b>Returns</b>: Size in bytes of the owned block.
+   std::size_t capacity() const
+   {  return m_capacity;  }
+
+   //! <b>Returns</b>: True if a request is being served.
+   bool in_use() const
+   {  return m_in_use;  }
+
+   //! <b>Returns</b>: Usage counters since construction or the last call to clear_stats().
+   const scratch_arena_stats &stats() const
+   {  return m_stats;  }
+
+   //! <b>Effects</b>: Zeroes usage counters.
+   void clear_stats()
+   {
+      m_stats.hits = m_stats.misses = m_stats.failures = m_stats.peak_bytes = 0u;
+   }
+
+   #if !defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_MOVE_DOXYGEN_INVOKED)
+   //! <b>Returns</b>: An arena owned by the calling thread, destroyed when the thread exits.
+   //!
+   //! <b>Note</b>: Only available if the compiler supports thread_local.
+   static scratch_arena &thread_instance()
+   {
+      static thread_local scratch_arena arena;
+      return arena;
+   }
+   #endif
+
+   private:
+   static std::size_t round_to_alignment(std::size_t bytes)
+   {  return (bytes + (alignment - 1u)) / alignment * alignment;  }
+
+   void *m_ptr;
+   std::size_t m_capacity;
+   bool m_in_use;
+   scratch_arena_stats m_stats;
+};
+
+//! Allocator that serves requests from a [classref boost::movelib::scratch_arena scratch_arena].
+//! It can be passed to the allocator overloads of [funcref boost::movelib::adaptive_sort adaptive_sort]
+//! and [funcref boost::movelib::adaptive_merge adaptive_merge].
+//!
+//! Only one allocation per arena can be alive. allocate() returns null instead of
+//! throwing when the arena can't serve the request, so this allocator is not suitable
+//! for containers.
+template<class T>
+class scratch_arena_allocator
+{
+   template<class U>
+   friend class scratch_arena_allocator;
+
+   public:
+   typedef T value_type;
+
+   //! <b>Effects</b>: Constructs an allocator that uses "arena".
+   explicit scratch_arena_allocator(scratch_arena &arena)
+      : m_arena(&arena)
+   {}
+
+   #if !defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_MOVE_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Constructs an allocator that uses scratch_arena::thread_instance().
+   scratch_arena_allocator()
+      : m_arena(&scratch_arena::thread_instance())
+   {}
+   #endif
+
+   //! <b>Effects</b>: Constructs an allocator that uses the arena of "other".
+   template<class U>
+   scratch_arena_allocator(const scratch_arena_allocator<U> &other)
+      : m_arena(other.m_arena)
+   {}
+
+   //! <b>Returns</b>: Storage for n elements or null if the arena can't serve the request.
+   T *allocate(std::size_t n)
+   {
+      if(n > std::size_t(-1)/sizeof(T)){
+         return 0;
+      }
+      return static_cast<T*>(m_arena->acquire(n*sizeof(T)));
+   }
+
+   //! <b>Effects</b>: Returns the storage to the arena. Null pointers (e.g. returned
+   //!   by allocate(0)) are ignored, as they don't hold the arena.
+   void deallocate(T *p, std::size_t)
+   {
+      if(p)
+         m_arena->release();
+   }
+
+   //! <b>Returns</b>: The arena used by this allocator.
+   scratch_arena &arena() const
+   {  return *m_arena;  }
+
+   friend bool operator==(const scratch_arena_allocator &l, const scratch_arena_allocator &r)
+   {  return l.m_arena == r.m_arena;  }
+
+   friend bool operator!=(const scratch_arena_allocator &l, const scratch_arena_allocator &r)
+   {  return l.m_arena != r.m_arena;  }
+
+   private:
+   scratch_arena *m_arena;
+};
+
+//! Raw storage for "n" elements of type T obtained from a [classref boost::movelib::scratch_arena scratch_arena]
+//! and returned to it on destruction. Useful to pass the storage to algorithms taking raw memory
+//! (e.g. merge_sort or stable_sort_adaptive_ONlogN2).
+template<class T>
+class scratch_buffer
+{
+   scratch_buffer(const scratch_buffer &);
+   scratch_buffer & operator=(const scratch_buffer &);
+
+   public:
+   //! <b>Effects</b>: Requests storage for "n" elements from "arena".
+   //!
+   //! <b>Postcondition</b>: data() is null and size() is zero if the request failed.
+   scratch_buffer(scratch_arena &arena, std::size_t n)
+      : m_arena(arena)
+      , m_ptr(n && n <= std::size_t(-1)/sizeof(T) ? static_cast<T*>(arena.acquire(n*sizeof(T))) : (T*)0)
+      , m_size(m_ptr ? n : 0u)
+   {}
+
+   //! <b>Effects</b>: Returns the storage to the arena.
+   ~scratch_buffer()
+   {
+      if(m_ptr)
+         m_arena.release();
+   }
+
+   T *data() const
+   {  return m_ptr;  }
+
+   std::size_t size() const
+   {  return m_size;  }
+
+   private:
+   scratch_arena &m_arena;
+   T *m_ptr;
+   std::size_t m_size;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#define BOOST_MOVE_ALGO_SCRATCH_ARENA_HPP
@@ -0,0 +1,197 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Peak scratch memory and recursion depth accounting for sorting and merging algorithms.
+//!
+//! Accounting is only compiled in if BOOST_MOVE_SCRATCH_STATS is defined before including
+//! any Boost.Move algorithm header. Otherwise the hooks placed in the algorithms expand
+//! to nothing and scratch_stats objects record nothing.
+
+#ifndef BOOST_MOVE_ALGO_SCRATCH_STATS_HPP
+#define BOOST_MOVE_ALGO_SCRATCH_STATS_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace movelib {
+
+//! Peak scratch resources used by the algorithms while a
+//! [classref boost::movelib::scoped_scratch_stats scoped_scratch_stats]
+//! referring to this object is active in the calling thread.
+struct scratch_stats
+{
+   //! <b>Effects</b>: Zero-initializes all statistics.
+   scratch_stats()
+   {  this->clear();  }
+
+   //! <b>Effects</b>: Zero-initializes all statistics.
+   void clear()
+   {
+      peak_xbuf_elements = peak_xbuf_bytes = 0u;
+      peak_key_bytes = 0u;
+      max_recursion_depth = recursion_depth = 0u;
+   }
+
+   //! Maximum number of elements constructed at the same time in the external buffer
+   std::size_t peak_xbuf_elements;
+   //! peak_xbuf_elements multiplied by the size of the element
+   std::size_t peak_xbuf_bytes;
+   //! Maximum bytes of the external buffer borrowed after the constructed elements
+   //! to store integral keys.
+   std::size_t peak_key_bytes;
+   //! Maximum nesting of recursive calls (pdqsort, merge sort and
+   //! recursive merges). Zero if no recursive algorithm was used.
+   std::size_t max_recursion_depth;
+
+   ///@cond
+   std::size_t recursion_depth;
+
+   void record_xbuf(std::size_t n, std::size_t elem_size)
+   {
+      if(n > peak_xbuf_elements){
+         peak_xbuf_elements = n;
+         peak_xbuf_bytes = n*elem_size;
+      }
+   }
+
+   void record_key_bytes(std::size_t bytes)
+   {
+      if(bytes > peak_key_bytes)
+         peak_key_bytes = bytes;
+   }
+
+   void enter_recursion()
+   {
+      if(++recursion_depth > max_recursion_depth)
+         max_recursion_depth = recursion_depth;
+   }
+
+   void leave_recursion()
+   {  --recursion_depth;  }
+   ///@endcond
+};
+
+//! Makes a scratch_stats object the destination of the statistics recorded by the algorithms
+//! called from this thread during the lifetime of this object. The previous destination
+//! is restored on destruction, so scopes can be nested.
+//!
+//! Statistics are accumulated: call scratch_stats::clear() to obtain values for a single call.
+class scoped_scratch_stats
+{
+   scoped_scratch_stats(const scoped_scratch_stats &);
+   scoped_scratch_stats & operator=(const scoped_scratch_stats &);
+
+   public:
+   //! <b>Effects</b>: Installs stats as the destination of this thread's statistics.
+   explicit scoped_scratch_stats(scratch_stats &stats)
+      : m_prev(current())
+   {  current() = &stats;  }
+
+   //! <b>Effects</b>: Restores the previous destination.
+   ~scoped_scratch_stats()
+   {  current() = m_prev;  }
+
+   //! <b>Returns</b>: The current destination of this thread's statistics or null if none.
+   static scratch_stats *&current()
+   {
+      #if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+      static thread_local scratch_stats *p_current = 0;
+      #else
+      static scratch_stats *p_current = 0;
+      #endif
+      return p_current;
+   }
+
+   private:
+   scratch_stats *m_prev;
+};
+
+///@cond
+
+namespace detail_scratch {
+
+//Algorithms evaluated at compile time (see BOOST_MOVE_CONSTEXPR20) can't
+//reach the statistics of the current thread, so they are not recorded
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 scratch_stats *current_stats()
+{
+   #if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+   if(BOOST_MOVE_IS_CONSTANT_EVALUATED())
+      return 0;
+   #endif
+   return scoped_scratch_stats::current();
+}
+
+inline BOOST_MOVE_CONSTEXPR20 void record_xbuf(std::size_t n, std::size_t elem_size)
+{
+   if(scratch_stats *const s = (current_stats)())
+      s->record_xbuf(n, elem_size);
+}
+
+inline BOOST_MOVE_CONSTEXPR20 void record_key_bytes(std::size_t bytes)
+{
+   if(scratch_stats *const s = (current_stats)())
+      s->record_key_bytes(bytes);
+}
+
+class recursion_guard
+{
+   recursion_guard(const recursion_guard &);
+   recursion_guard & operator=(const recursion_guard &);
+
+   public:
+   BOOST_MOVE_CONSTEXPR20 recursion_guard()
+      : m_stats((current_stats)())
+   {
+      if(m_stats)
+         m_stats->enter_recursion();
+   }
+
+   BOOST_MOVE_CONSTEXPR20 ~recursion_guard()
+   {
+      if(m_stats)
+         m_stats->leave_recursion();
+   }
+
+   private:
+   scratch_stats *m_stats;
+};
+
+}  //namespace detail_scratch {
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#if defined(BOOST_MOVE_SCRATCH_STATS)
+   #define BOOST_MOVE_SCRATCH_RECORD_XBUF(N, T)    ::boost::movelib::detail_scratch::record_xbuf(std::size_t(N), sizeof(T))
+   #define BOOST_MOVE_SCRATCH_RECORD_KEY_BYTES(B)  ::boost::movelib::detail_scratch::record_key_bytes(std::size_t(B))
+   #define BOOST_MOVE_SCRATCH_RECURSION_GUARD      ::boost::movelib::detail_scratch::recursion_guard boost_move_scratch_recursion_guard
+#else
+   #define BOOST_MOVE_SCRATCH_RECORD_XBUF(N, T)
+   #define BOOST_MOVE_SCRATCH_RECORD_KEY_BYTES(B)
+   #define BOOST_MOVE_SCRATCH_RECURSION_GUARD
+#endif
+
+///@endcond
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#define BOOST_MOVE_ALGO_SCRATCH_STATS_HPP
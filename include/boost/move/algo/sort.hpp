@@ -0,0 +1,289 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+
+#ifndef BOOST_MOVE_ALGO_SORT_HPP
+#define BOOST_MOVE_ALGO_SORT_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/detail/insertion_sort.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <cstddef>
+#include <new>
+
+#include <boost/move/detail/std_ns_begin.hpp>
+BOOST_MOVE_STD_NS_BEG
+
+template<class T>
+struct less;
+
+template<class T>
+struct greater;
+
+BOOST_MOVE_STD_NS_END
+#include <boost/move/detail/std_ns_end.hpp>
+
+namespace boost {
+namespace movelib {
+
+//! Sorting engines [funcref boost::movelib::sort sort] and
+//! [funcref boost::movelib::stable_sort stable_sort] can dispatch to.
+enum sort_engine
+{
+   insertion_sort_engine,
+   pdqsort_engine,
+   merge_sort_engine,
+   adaptive_sort_engine
+};
+
+//! <b>Returns</b>: A null-terminated name for the engine, suitable for logging.
+inline const char *sort_engine_name(sort_engine e)
+{
+   switch(e){
+      case insertion_sort_engine:   return "insertion_sort";
+      case pdqsort_engine:          return "pdqsort";
+      case merge_sort_engine:       return "merge_sort";
+      case adaptive_sort_engine:    return "adaptive_sort";
+      default:                      return "unknown";
+   }
+}
+
+//! Memory budget meaning "as much auxiliary memory as the engine would ideally use".
+static const std::size_t unlimited_sort_memory = std::size_t(-1);
+
+//! Ranges with this many elements or less are always sorted with insertion sort.
+static const std::size_t SortInsertionSortThreshold = 16u;
+
+//! If this trait yields to true (<i>is_stability_irrelevant&lt;Compare, T&gt;::value == true</i>)
+//! elements of type T that are equivalent according to Compare are indistinguishable,
+//! so a stable sort can be implemented with an unstable engine.
+//!
+//! By default this trait is true for std::less and std::greater comparing integral
+//! or enumeration types. Floating point types are excluded as -0.0 and +0.0 are
+//! equivalent but distinguishable. Users can specialize this trait for their own comparators.
+template<class Compare, class T>
+struct is_stability_irrelevant
+{
+   static const bool value = false;
+};
+
+///@cond
+
+namespace detail_sort {
+
+template<class T>
+struct is_integral_or_enum
+{
+   static const bool value = ::boost::move_detail::is_integral<T>::value ||
+                             ::boost::move_detail::is_enum<T>::value;
+};
+
+}  //namespace detail_sort {
+
+template<class T>
+struct is_stability_irrelevant< ::std::less<T>, T>
+   : ::boost::move_detail::bool_<detail_sort::is_integral_or_enum<T>::value>
+{};
+
+template<class T>
+struct is_stability_irrelevant< ::std::greater<T>, T>
+   : ::boost::move_detail::bool_<detail_sort::is_integral_or_enum<T>::value>
+{};
+
+template<class T>
+struct is_stability_irrelevant< ::std::less<void>, T>
+   : ::boost::move_detail::bool_<detail_sort::is_integral_or_enum<T>::value>
+{};
+
+template<class T>
+struct is_stability_irrelevant< ::std::greater<void>, T>
+   : ::boost::move_detail::bool_<detail_sort::is_integral_or_enum<T>::value>
+{};
+
+namespace detail_sort {
+
+template<class T>
+class raw_buffer
+{
+   raw_buffer(const raw_buffer &);
+   raw_buffer & operator=(const raw_buffer &);
+
+   public:
+   explicit raw_buffer(std::size_t n)
+      : m_ptr(), m_size()
+   {
+      if(n && n <= std::size_t(-1)/sizeof(T)){
+         m_ptr = ::boost::move_detail::force_ptr<T*>(::operator new(n*sizeof(T), std::nothrow));
+         m_size = m_ptr ? n : 0u;
+      }
+   }
+
+   ~raw_buffer()
+   {  ::operator delete((void*)m_ptr);  }
+
+   T* data() const
+   {  return m_ptr;  }
+
+   std::size_t size() const
+   {  return m_size;  }
+
+   private:
+   T* m_ptr;
+   std::size_t m_size;
+};
+
+}  //namespace detail_sort {
+
+///@endcond
+
+//! <b>Returns</b>: The engine [funcref boost::movelib::sort sort] uses to sort
+//!   "n" elements of type iterator_traits<RandIt>::value_type with a Compare comparison.
+template<class RandIt, class Compare>
+sort_engine select_sort_engine(std::size_t n)
+{
+   return n <= SortInsertionSortThreshold ? insertion_sort_engine : pdqsort_engine;
+}
+
+//! <b>Returns</b>: The engine [funcref boost::movelib::stable_sort stable_sort] uses to sort
+//!   "n" elements of type iterator_traits<RandIt>::value_type with a Compare comparison
+//!   using at most "max_memory_bytes" bytes of auxiliary memory.
+//!
+//! <b>Note</b>: If is_stability_irrelevant<Compare, value_type>::value is true, stable_sort
+//!   dispatches to the same engine [funcref boost::movelib::sort sort] would choose.
+//!   Otherwise merge_sort is used if half of the range fits in the budget and adaptive_sort
+//!   (using whatever part of the budget is available as external buffer) otherwise.
+template<class RandIt, class Compare>
+sort_engine select_stable_sort_engine(std::size_t n, std::size_t max_memory_bytes = unlimited_sort_memory)
+{
+   typedef typename iterator_traits<RandIt>::value_type value_type;
+   if(n <= SortInsertionSortThreshold){
+      return insertion_sort_engine;
+   }
+   else if(is_stability_irrelevant<Compare, value_type>::value){
+      return select_sort_engine<RandIt, Compare>(n);
+   }
+   else if((max_memory_bytes/sizeof(value_type)) >= (n - n/2u)){
+      return merge_sort_engine;
+   }
+   else{
+      return adaptive_sort_engine;
+   }
+}
+
+//! <b>Effects</b>: Sorts the elements in the range [first, last) in ascending order according
+//!   to comparison functor "comp". The sort is not stable. The engine is chosen by
+//!   [funcref boost::movelib::select_sort_engine select_sort_engine].
+//!
+//! <b>Returns</b>: The engine used to sort the range.
+//!
+//! <b>Requires</b>:
+//!   - RandIt must meet the requirements of ValueSwappable and RandomAccessIterator.
+//!   - The type of dereferenced RandIt must meet the requirements of MoveAssignable and MoveConstructible.
+//!
+//! <b>Throws</b>: If comp throws or the move constructor, move assignment or swap of the type
+//!   of dereferenced RandIt throws.
+//!
+//! <b>Complexity</b>: O(Nxlog(N)) comparisons and moves/swaps in the worst case. No auxiliary memory
+//!   is allocated.
+template<class RandIt, class Compare>
+sort_engine sort(RandIt first, RandIt last, Compare comp)
+{
+   sort_engine const e = select_sort_engine<RandIt, Compare>(std::size_t(last - first));
+   if(e == insertion_sort_engine){
+      ::boost::movelib::insertion_sort(first, last, comp);
+   }
+   else{
+      ::boost::movelib::pdqsort(first, last, comp);
+   }
+   return e;
+}
+
+//! <b>Effects</b>: Sorts the elements in the range [first, last) in ascending order according
+//!   to comparison functor "comp". The sort is stable. The engine is chosen by
+//!   [funcref boost::movelib::select_stable_sort_engine select_stable_sort_engine].
+//!   If the auxiliary buffer can't be allocated, adaptive_sort is used without external memory.
+//!
+//! <b>Returns</b>: The engine used to sort the range.
+//!
+//! <b>Requires</b>:
+//!   - RandIt must meet the requirements of ValueSwappable and RandomAccessIterator.
+//!   - The type of dereferenced RandIt must meet the requirements of MoveAssignable and MoveConstructible.
+//!
+//! <b>Parameters</b>:
+//!   - first, last: the range of elements to sort
+//!   - comp: comparison function object which returns true if the first argument is is ordered before the second.
+//!   - max_memory_bytes: maximum number of bytes of auxiliary memory that can be allocated.
+//!
+//! <b>Throws</b>: If comp throws or the move constructor, move assignment or swap of the type
+//!   of dereferenced RandIt throws. Allocation failures are not propagated.
+//!
+//! <b>Complexity</b>: O(Nxlog(N)) comparisons and moves/swaps in the worst case.
+template<class RandIt, class Compare>
+sort_engine stable_sort(RandIt first, RandIt last, Compare comp, std::size_t max_memory_bytes = unlimited_sort_memory)
+{
+   typedef typename iterator_traits<RandIt>::value_type value_type;
+   typedef typename iter_size<RandIt>::type  size_type;
+
+   std::size_t const n = std::size_t(last - first);
+   sort_engine e = select_stable_sort_engine<RandIt, Compare>(n, max_memory_bytes);
+   switch(e){
+      case insertion_sort_engine:
+         ::boost::movelib::insertion_sort(first, last, comp);
+      break;
+      case pdqsort_engine:
+         ::boost::movelib::pdqsort(first, last, comp);
+      break;
+      case merge_sort_engine:
+      {
+         detail_sort::raw_buffer<value_type> buf(n - n/2u);
+         if(buf.size()){
+            ::boost::movelib::merge_sort(first, last, comp, buf.data());
+            break;
+         }
+         e = adaptive_sort_engine;
+         ::boost::movelib::adaptive_sort(first, last, comp);
+      }
+      break;
+      case adaptive_sort_engine:
+      default:
+      {
+         //Use half of the range at most, as adaptive_sort won't take advantage of more memory
+         std::size_t const max_elements = max_memory_bytes/sizeof(value_type);
+         detail_sort::raw_buffer<value_type> buf(max_elements < (n - n/2u) ? max_elements : (n - n/2u));
+         ::boost::movelib::adaptive_sort(first, last, comp, buf.data(), size_type(buf.size()));
+      }
+      break;
+   }
+   return e;
+}
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#define BOOST_MOVE_ALGO_SORT_HPP
@@ -0,0 +1,532 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Sorting networks for ranges whose size is known at compile time.
+
+#ifndef BOOST_MOVE_ALGO_STATIC_SORT_HPP
+#define BOOST_MOVE_ALGO_STATIC_SORT_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/algo/detail/insertion_sort.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <cstddef>
+
+//! Define it to sort small ranges (up to 16 elements) of trivially copyable types not bigger
+//! than two pointers with static_sort and static_stable_sort in the base cases of pdqsort and
+//! adaptive_sort, instead of insertion sort. Networks don't adapt to presorted input, so
+//! measure before enabling it.
+#if defined(BOOST_MOVE_DOXYGEN_INVOKED)
+#define BOOST_MOVE_SORTING_NETWORK_BASE_CASES
+#endif
+
+namespace boost {
+namespace movelib {
+
+///@cond
+
+namespace detail_static_sort {
+
+//Values that are cheap to copy are exchanged with conditional moves instead of branches
+template<class T>
+struct is_branchless
+{
+   static const bool value =
+      ::boost::move_detail::is_trivially_copy_constructible<T>::value &&
+      ::boost::move_detail::is_trivially_copy_assignable<T>::value &&
+      sizeof(T) <= 2*sizeof(void*);
+};
+
+template<class T, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void compare_exchange(T &a, T &b, Compare &comp, ::boost::move_detail::true_)
+{
+   const T x(a);
+   const T y(b);
+   const bool c = comp(y, x);
+   a = c ? y : x;
+   b = c ? x : y;
+}
+
+template<class T, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void compare_exchange(T &a, T &b, Compare &comp, ::boost::move_detail::false_)
+{
+   if(comp(b, a))
+      ::boost::adl_move_swap(a, b);
+}
+
+//Orders first[I] and first[J] (I < J). Comparators touching positions not smaller
+//than N are dropped: networks for bigger sizes sort N elements as if the missing
+//positions held values greater than any other.
+template<std::size_t N, std::size_t I, std::size_t J, bool = (J < N)>
+struct cx
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      typedef typename ::boost::movelib::iter_value<RandIt>::type       value_type;
+      typedef typename ::boost::movelib::iter_difference<RandIt>::type  difference_type;
+      (compare_exchange)(first[difference_type(I)], first[difference_type(J)], comp
+                        , ::boost::move_detail::bool_<is_branchless<value_type>::value>());
+   }
+};
+
+template<std::size_t N, std::size_t I, std::size_t J>
+struct cx<N, I, J, false>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt, Compare &)
+   {}
+};
+
+//////////////////////////////////////////
+//
+// Batcher's odd-even merge sort of [Lo, Lo+Len), Len a power of two
+//
+//////////////////////////////////////////
+
+template<std::size_t N, std::size_t I, std::size_t R, std::size_t M, std::size_t End, bool = (I + R < End)>
+struct odd_even_merge_step
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      cx<N, I, I + R>::apply(first, comp);
+      odd_even_merge_step<N, I + M, R, M, End>::apply(first, comp);
+   }
+};
+
+template<std::size_t N, std::size_t I, std::size_t R, std::size_t M, std::size_t End>
+struct odd_even_merge_step<N, I, R, M, End, false>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt, Compare &)
+   {}
+};
+
+template<std::size_t N, std::size_t Lo, std::size_t Len, std::size_t R, bool = (R*2u < Len)>
+struct odd_even_merge
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      odd_even_merge<N, Lo, Len, R*2u>::apply(first, comp);
+      odd_even_merge<N, Lo + R, Len, R*2u>::apply(first, comp);
+      odd_even_merge_step<N, Lo + R, R, R*2u, Lo + Len>::apply(first, comp);
+   }
+};
+
+template<std::size_t N, std::size_t Lo, std::size_t Len, std::size_t R>
+struct odd_even_merge<N, Lo, Len, R, false>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {  cx<N, Lo, Lo + R>::apply(first, comp);  }
+};
+
+template<std::size_t N, std::size_t Lo, std::size_t Len, bool = (Lo < N) && (Len > 1u)>
+struct odd_even_merge_sort
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      odd_even_merge_sort<N, Lo, Len/2u>::apply(first, comp);
+      odd_even_merge_sort<N, Lo + Len/2u, Len/2u>::apply(first, comp);
+      odd_even_merge<N, Lo, Len, 1u>::apply(first, comp);
+   }
+};
+
+template<std::size_t N, std::size_t Lo, std::size_t Len>
+struct odd_even_merge_sort<N, Lo, Len, false>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt, Compare &)
+   {}
+};
+
+template<std::size_t N, std::size_t P = 1u, bool = (P >= N)>
+struct next_pow2
+{  static const std::size_t value = next_pow2<N, P*2u>::value;  };
+
+template<std::size_t N, std::size_t P>
+struct next_pow2<N, P, true>
+{  static const std::size_t value = P;  };
+
+//////////////////////////////////////////
+//
+// Best known networks (size-optimal up to 8 elements)
+//
+//////////////////////////////////////////
+
+#define BOOST_MOVE_STATIC_SORT_CX(I, J) cx<N, I, J>::apply(first, comp);
+
+template<std::size_t N>
+struct network_size
+{
+   static const std::size_t value = N <= 1u ? 1u : N <= 8u ? N : N <= 16u ? 16u : 0u;
+};
+
+//Sel is the size of the hand-written network used for N elements, 0 if none
+template<std::size_t N, std::size_t Sel = network_size<N>::value>
+struct network
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {  odd_even_merge_sort<N, 0u, next_pow2<N>::value>::apply(first, comp);  }
+};
+
+template<std::size_t N>
+struct network<N, 1u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt, Compare &)
+   {}
+};
+
+template<std::size_t N>
+struct network<N, 2u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,1)
+   }
+};
+
+template<std::size_t N>
+struct network<N, 3u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,2)
+      BOOST_MOVE_STATIC_SORT_CX(0,1)
+      BOOST_MOVE_STATIC_SORT_CX(1,2)
+   }
+};
+
+template<std::size_t N>
+struct network<N, 4u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,2) BOOST_MOVE_STATIC_SORT_CX(1,3)
+      BOOST_MOVE_STATIC_SORT_CX(0,1) BOOST_MOVE_STATIC_SORT_CX(2,3)
+      BOOST_MOVE_STATIC_SORT_CX(1,2)
+   }
+};
+
+template<std::size_t N>
+struct network<N, 5u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,3) BOOST_MOVE_STATIC_SORT_CX(1,4)
+      BOOST_MOVE_STATIC_SORT_CX(0,2) BOOST_MOVE_STATIC_SORT_CX(1,3)
+      BOOST_MOVE_STATIC_SORT_CX(0,1) BOOST_MOVE_STATIC_SORT_CX(2,4)
+      BOOST_MOVE_STATIC_SORT_CX(1,2) BOOST_MOVE_STATIC_SORT_CX(3,4)
+      BOOST_MOVE_STATIC_SORT_CX(2,3)
+   }
+};
+
+template<std::size_t N>
+struct network<N, 6u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,5) BOOST_MOVE_STATIC_SORT_CX(1,3) BOOST_MOVE_STATIC_SORT_CX(2,4)
+      BOOST_MOVE_STATIC_SORT_CX(1,2) BOOST_MOVE_STATIC_SORT_CX(3,4)
+      BOOST_MOVE_STATIC_SORT_CX(0,3) BOOST_MOVE_STATIC_SORT_CX(2,5)
+      BOOST_MOVE_STATIC_SORT_CX(0,1) BOOST_MOVE_STATIC_SORT_CX(2,3) BOOST_MOVE_STATIC_SORT_CX(4,5)
+      BOOST_MOVE_STATIC_SORT_CX(1,2) BOOST_MOVE_STATIC_SORT_CX(3,4)
+   }
+};
+
+template<std::size_t N>
+struct network<N, 7u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,6) BOOST_MOVE_STATIC_SORT_CX(2,3) BOOST_MOVE_STATIC_SORT_CX(4,5)
+      BOOST_MOVE_STATIC_SORT_CX(0,2) BOOST_MOVE_STATIC_SORT_CX(1,4) BOOST_MOVE_STATIC_SORT_CX(3,6)
+      BOOST_MOVE_STATIC_SORT_CX(0,1) BOOST_MOVE_STATIC_SORT_CX(2,5) BOOST_MOVE_STATIC_SORT_CX(3,4)
+      BOOST_MOVE_STATIC_SORT_CX(1,2) BOOST_MOVE_STATIC_SORT_CX(4,6)
+      BOOST_MOVE_STATIC_SORT_CX(2,3) BOOST_MOVE_STATIC_SORT_CX(4,5)
+      BOOST_MOVE_STATIC_SORT_CX(1,2) BOOST_MOVE_STATIC_SORT_CX(3,4) BOOST_MOVE_STATIC_SORT_CX(5,6)
+   }
+};
+
+template<std::size_t N>
+struct network<N, 8u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,2) BOOST_MOVE_STATIC_SORT_CX(1,3) BOOST_MOVE_STATIC_SORT_CX(4,6) BOOST_MOVE_STATIC_SORT_CX(5,7)
+      BOOST_MOVE_STATIC_SORT_CX(0,4) BOOST_MOVE_STATIC_SORT_CX(1,5) BOOST_MOVE_STATIC_SORT_CX(2,6) BOOST_MOVE_STATIC_SORT_CX(3,7)
+      BOOST_MOVE_STATIC_SORT_CX(0,1) BOOST_MOVE_STATIC_SORT_CX(2,3) BOOST_MOVE_STATIC_SORT_CX(4,5) BOOST_MOVE_STATIC_SORT_CX(6,7)
+      BOOST_MOVE_STATIC_SORT_CX(2,4) BOOST_MOVE_STATIC_SORT_CX(3,5)
+      BOOST_MOVE_STATIC_SORT_CX(1,4) BOOST_MOVE_STATIC_SORT_CX(3,6)
+      BOOST_MOVE_STATIC_SORT_CX(1,2) BOOST_MOVE_STATIC_SORT_CX(3,4) BOOST_MOVE_STATIC_SORT_CX(5,6)
+   }
+};
+
+//Green's 60 comparator network. Pruned for 9 to 15 elements.
+template<std::size_t N>
+struct network<N, 16u>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      BOOST_MOVE_STATIC_SORT_CX(0,13) BOOST_MOVE_STATIC_SORT_CX(1,12) BOOST_MOVE_STATIC_SORT_CX(2,15) BOOST_MOVE_STATIC_SORT_CX(3,14)
+      BOOST_MOVE_STATIC_SORT_CX(4,8)  BOOST_MOVE_STATIC_SORT_CX(5,6)  BOOST_MOVE_STATIC_SORT_CX(7,11) BOOST_MOVE_STATIC_SORT_CX(9,10)
+
+      BOOST_MOVE_STATIC_SORT_CX(0,5)  BOOST_MOVE_STATIC_SORT_CX(1,7)  BOOST_MOVE_STATIC_SORT_CX(2,9)  BOOST_MOVE_STATIC_SORT_CX(3,4)
+      BOOST_MOVE_STATIC_SORT_CX(6,13) BOOST_MOVE_STATIC_SORT_CX(8,14) BOOST_MOVE_STATIC_SORT_CX(10,15) BOOST_MOVE_STATIC_SORT_CX(11,12)
+
+      BOOST_MOVE_STATIC_SORT_CX(0,1)  BOOST_MOVE_STATIC_SORT_CX(2,3)  BOOST_MOVE_STATIC_SORT_CX(4,5)  BOOST_MOVE_STATIC_SORT_CX(6,8)
+      BOOST_MOVE_STATIC_SORT_CX(7,9)  BOOST_MOVE_STATIC_SORT_CX(10,11) BOOST_MOVE_STATIC_SORT_CX(12,13) BOOST_MOVE_STATIC_SORT_CX(14,15)
+
+      BOOST_MOVE_STATIC_SORT_CX(0,2)  BOOST_MOVE_STATIC_SORT_CX(1,3)  BOOST_MOVE_STATIC_SORT_CX(4,10) BOOST_MOVE_STATIC_SORT_CX(5,11)
+      BOOST_MOVE_STATIC_SORT_CX(6,7)  BOOST_MOVE_STATIC_SORT_CX(8,9)  BOOST_MOVE_STATIC_SORT_CX(12,14) BOOST_MOVE_STATIC_SORT_CX(13,15)
+
+      BOOST_MOVE_STATIC_SORT_CX(1,2)  BOOST_MOVE_STATIC_SORT_CX(3,12) BOOST_MOVE_STATIC_SORT_CX(4,6)  BOOST_MOVE_STATIC_SORT_CX(5,7)
+      BOOST_MOVE_STATIC_SORT_CX(8,10) BOOST_MOVE_STATIC_SORT_CX(9,11) BOOST_MOVE_STATIC_SORT_CX(13,14)
+
+      BOOST_MOVE_STATIC_SORT_CX(1,4)  BOOST_MOVE_STATIC_SORT_CX(2,6)  BOOST_MOVE_STATIC_SORT_CX(5,8)  BOOST_MOVE_STATIC_SORT_CX(7,10)
+      BOOST_MOVE_STATIC_SORT_CX(9,13) BOOST_MOVE_STATIC_SORT_CX(11,14)
+
+      BOOST_MOVE_STATIC_SORT_CX(2,4)  BOOST_MOVE_STATIC_SORT_CX(3,6)  BOOST_MOVE_STATIC_SORT_CX(9,12) BOOST_MOVE_STATIC_SORT_CX(11,13)
+
+      BOOST_MOVE_STATIC_SORT_CX(3,5)  BOOST_MOVE_STATIC_SORT_CX(6,8)  BOOST_MOVE_STATIC_SORT_CX(7,9)  BOOST_MOVE_STATIC_SORT_CX(10,12)
+
+      BOOST_MOVE_STATIC_SORT_CX(3,4)  BOOST_MOVE_STATIC_SORT_CX(5,6)  BOOST_MOVE_STATIC_SORT_CX(7,8)  BOOST_MOVE_STATIC_SORT_CX(9,10)
+      BOOST_MOVE_STATIC_SORT_CX(11,12)
+
+      BOOST_MOVE_STATIC_SORT_CX(6,7)  BOOST_MOVE_STATIC_SORT_CX(8,9)
+   }
+};
+
+#undef BOOST_MOVE_STATIC_SORT_CX
+
+//////////////////////////////////////////
+//
+// Stable network: odd-even transposition sort
+//
+//////////////////////////////////////////
+
+//Compare-exchanges (I, I+1), (I+2, I+3)... of a round
+template<std::size_t N, std::size_t I, bool = (I + 1u < N)>
+struct transposition_round
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      cx<N, I, I + 1u>::apply(first, comp);
+      transposition_round<N, I + 2u>::apply(first, comp);
+   }
+};
+
+template<std::size_t N, std::size_t I>
+struct transposition_round<N, I, false>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt, Compare &)
+   {}
+};
+
+template<std::size_t N, std::size_t Round = 0u, bool = (Round < N)>
+struct transposition_network
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt first, Compare &comp)
+   {
+      transposition_round<N, Round % 2u>::apply(first, comp);
+      transposition_network<N, Round + 1u>::apply(first, comp);
+   }
+};
+
+template<std::size_t N, std::size_t Round>
+struct transposition_network<N, Round, false>
+{
+   template<class RandIt, class Compare>
+   BOOST_MOVE_FORCEINLINE static BOOST_MOVE_CONSTEXPR20 void apply(RandIt, Compare &)
+   {}
+};
+
+}  //namespace detail_static_sort {
+
+///@endcond
+
+//! <b>Effects</b>: Sorts the N elements starting at first using comp. It's expanded at compile time
+//!   to a sorting network: a fixed sequence of compare-exchange operations. Networks are
+//!   size-optimal up to 8 elements and the best known ones up to 16, Batcher's odd-even merge
+//!   sort networks are used for bigger N. Elements that are trivially copyable and not bigger than
+//!   two pointers are exchanged with conditional moves, other elements are swapped with boost::adl_move_swap.
+//!
+//! <b>Requires</b>: RandIt shall be a random access iterator. The type of dereferenced RandIt
+//!   shall be MoveConstructible and MoveAssignable.
+//!
+//! <b>Complexity</b>: A fixed number of comparisons: 19 for 8 elements, 60 for 16
+//!   and 191 for 32, with no data dependent branches for trivially copyable elements.
+//!
+//! <b>Note</b>: The sort is not stable. The code size grows with N, it's intended for small sizes.
+template<std::size_t N, class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void static_sort(RandIt first, Compare comp)
+{
+   detail_static_sort::network<N>::apply(first, comp);
+}
+
+//! <b>Effects</b>: Sorts the N elements starting at first using comp, preserving the relative order
+//!   of equivalent elements. It's expanded at compile time to an odd-even transposition network:
+//!   N rounds of compare-exchange operations of adjacent elements.
+//!
+//! <b>Requires</b>: RandIt shall be a random access iterator. The type of dereferenced RandIt
+//!   shall be MoveConstructible and MoveAssignable.
+//!
+//! <b>Complexity</b>: Exactly N*(N-1)/2 comparisons.
+template<std::size_t N, class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void static_stable_sort(RandIt first, Compare comp)
+{
+   detail_static_sort::transposition_network<N>::apply(first, comp);
+}
+
+///@cond
+
+namespace detail_static_sort {
+
+//Sorts ranges with up to 16 elements with static_sort.
+//Returns false (and does nothing) for bigger ranges.
+template<class RandIt, class Compare>
+BOOST_MOVE_CONSTEXPR20 bool static_sort_small(RandIt first, std::size_t n, Compare comp)
+{
+   switch(n){
+      case 0u: case 1u:                             break;
+      case 2u:  (static_sort<2u>)(first, comp);     break;
+      case 3u:  (static_sort<3u>)(first, comp);     break;
+      case 4u:  (static_sort<4u>)(first, comp);     break;
+      case 5u:  (static_sort<5u>)(first, comp);     break;
+      case 6u:  (static_sort<6u>)(first, comp);     break;
+      case 7u:  (static_sort<7u>)(first, comp);     break;
+      case 8u:  (static_sort<8u>)(first, comp);     break;
+      case 9u:  (static_sort<9u>)(first, comp);     break;
+      case 10u: (static_sort<10u>)(first, comp);    break;
+      case 11u: (static_sort<11u>)(first, comp);    break;
+      case 12u: (static_sort<12u>)(first, comp);    break;
+      case 13u: (static_sort<13u>)(first, comp);    break;
+      case 14u: (static_sort<14u>)(first, comp);    break;
+      case 15u: (static_sort<15u>)(first, comp);    break;
+      case 16u: (static_sort<16u>)(first, comp);    break;
+      default: return false;
+   }
+   return true;
+}
+
+//Same as static_sort_small, with static_stable_sort
+template<class RandIt, class Compare>
+BOOST_MOVE_CONSTEXPR20 bool static_stable_sort_small(RandIt first, std::size_t n, Compare comp)
+{
+   switch(n){
+      case 0u: case 1u:                                   break;
+      case 2u:  (static_stable_sort<2u>)(first, comp);    break;
+      case 3u:  (static_stable_sort<3u>)(first, comp);    break;
+      case 4u:  (static_stable_sort<4u>)(first, comp);    break;
+      case 5u:  (static_stable_sort<5u>)(first, comp);    break;
+      case 6u:  (static_stable_sort<6u>)(first, comp);    break;
+      case 7u:  (static_stable_sort<7u>)(first, comp);    break;
+      case 8u:  (static_stable_sort<8u>)(first, comp);    break;
+      case 9u:  (static_stable_sort<9u>)(first, comp);    break;
+      case 10u: (static_stable_sort<10u>)(first, comp);   break;
+      case 11u: (static_stable_sort<11u>)(first, comp);   break;
+      case 12u: (static_stable_sort<12u>)(first, comp);   break;
+      case 13u: (static_stable_sort<13u>)(first, comp);   break;
+      case 14u: (static_stable_sort<14u>)(first, comp);   break;
+      case 15u: (static_stable_sort<15u>)(first, comp);   break;
+      case 16u: (static_stable_sort<16u>)(first, comp);   break;
+      default: return false;
+   }
+   return true;
+}
+
+template<class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void small_sort(RandIt first, RandIt last, Compare comp, ::boost::move_detail::true_)
+{
+   if(!(static_sort_small)(first, std::size_t(last - first), comp))
+      ::boost::movelib::insertion_sort(first, last, comp);
+}
+
+template<class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void small_sort(RandIt first, RandIt last, Compare comp, ::boost::move_detail::false_)
+{  ::boost::movelib::insertion_sort(first, last, comp);  }
+
+template<class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void small_stable_sort(RandIt first, RandIt last, Compare comp, ::boost::move_detail::true_)
+{
+   if(!(static_stable_sort_small)(first, std::size_t(last - first), comp))
+      ::boost::movelib::insertion_sort(first, last, comp);
+}
+
+template<class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void small_stable_sort(RandIt first, RandIt last, Compare comp, ::boost::move_detail::false_)
+{  ::boost::movelib::insertion_sort(first, last, comp);  }
+
+template<class RandIt>
+struct use_network_base_case
+{
+   static const bool value =
+   #if defined(BOOST_MOVE_SORTING_NETWORK_BASE_CASES)
+      is_branchless<typename ::boost::movelib::iter_value<RandIt>::type>::value;
+   #else
+      false;
+   #endif
+};
+
+}  //namespace detail_static_sort {
+
+//Base case of pdqsort: insertion sort or, if enabled, sorting networks
+template<class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void small_sort(RandIt first, RandIt last, Compare comp)
+{
+   detail_static_sort::small_sort(first, last, comp
+      , ::boost::move_detail::bool_<detail_static_sort::use_network_base_case<RandIt>::value>());
+}
+
+//Base case of adaptive_sort: stable version of small_sort
+template<class RandIt, class Compare>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 void small_stable_sort(RandIt first, RandIt last, Compare comp)
+{
+   detail_static_sort::small_stable_sort(first, last, comp
+      , ::boost::move_detail::bool_<detail_static_sort::use_network_base_case<RandIt>::value>());
+}
+
+///@endcond
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif //#ifndef BOOST_MOVE_ALGO_STATIC_SORT_HPP
@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Bulk moves that bypass the cache using non-temporal stores.
+
+#ifndef BOOST_MOVE_ALGO_STREAMING_MOVE_HPP
+#define BOOST_MOVE_ALGO_STREAMING_MOVE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/algo/move.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/detail/iterator_to_raw_pointer.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <cstddef>
+#include <cstring>
+
+///@cond
+
+#if (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) \
+    && !defined(BOOST_MOVE_NO_STREAMING_STORES)
+#  define BOOST_MOVE_DETAIL_HAS_SSE2_STREAMING_STORES
+#  include <emmintrin.h>
+#endif
+
+///@endcond
+
+//! Ranges of at least this number of bytes are moved with non-temporal stores by
+//! streaming_move and streaming_uninitialized_move when no threshold is passed.
+//! It should be at least the size of the last level cache, the default is 8 MiB.
+#if !defined(BOOST_MOVE_STREAMING_THRESHOLD)
+#  define BOOST_MOVE_STREAMING_THRESHOLD (std::size_t(8u) << 20u)
+#endif
+
+namespace boost {
+namespace movelib {
+
+//! Is true if the target supports non-temporal stores. Otherwise
+//! streaming_move and streaming_uninitialized_move copy memory normally.
+static const bool has_streaming_stores =
+#if defined(BOOST_MOVE_DETAIL_HAS_SSE2_STREAMING_STORES)
+   true;
+#else
+   false;
+#endif
+
+///@cond
+
+namespace detail_streaming {
+
+//Copies "bytes" bytes with stores that don't allocate cache lines. The destination
+//shall not overlap the source. Stores are fenced so that they are visible to other
+//threads (e.g. after a mutex is released) as if they were normal stores.
+inline void stream_copy(void *dst, const void *src, std::size_t bytes)
+{
+   #if defined(BOOST_MOVE_DETAIL_HAS_SSE2_STREAMING_STORES)
+   char *d = static_cast<char*>(dst);
+   const char *s = static_cast<const char*>(src);
+   //Non-temporal stores need a 16 byte aligned destination
+   std::size_t head = std::size_t(16u - (reinterpret_cast<std::size_t>(d) & 15u)) & 15u;
+   if(head > bytes)
+      head = bytes;
+   std::memcpy(d, s, head);
+   d += head; s += head; bytes -= head;
+   //A cache line per iteration
+   for(; bytes >= 64u; d += 64, s += 64, bytes -= 64u){
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+      const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16));
+      const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32));
+      const __m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48));
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d), a);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), b);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), c);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), e);
+   }
+   for(; bytes >= 16u; d += 16, s += 16, bytes -= 16u){
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d), _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+   }
+   _mm_sfence();
+   std::memcpy(d, s, bytes);
+   #else
+   std::memcpy(dst, src, bytes);
+   #endif
+}
+
+//Elements can be streamed if both ranges are contiguous arrays of the same
+//type and moving (Construct == true: move constructing) an element copies its bytes
+template<class I, class O, bool Construct>
+struct can_stream
+{
+   typedef typename ::boost::movelib::iter_value<I>::type value_type;
+   static const bool value = ::boost::move_detail::is_contiguous_iterator<I>::value && ::boost::move_detail::is_contiguous_iterator<O>::value &&
+      ::boost::move_detail::is_same<value_type, typename ::boost::movelib::iter_value<O>::type>::value &&
+      (Construct ? ::boost::move_detail::is_trivially_move_constructible<value_type>::value
+                 : ::boost::move_detail::is_trivially_move_assignable<value_type>::value);
+};
+
+template<class I, class O>
+inline O stream(I f, I l, O r, std::size_t threshold)
+{
+   typedef typename ::boost::movelib::iter_value<I>::type value_type;
+   const std::size_t n = std::size_t(l - f);
+   if(n){
+      const std::size_t bytes = n*sizeof(value_type);
+      void *const dst = ::boost::movelib::iterator_to_raw_pointer(r);
+      const void *const src = ::boost::movelib::iterator_to_raw_pointer(f);
+      if(bytes >= threshold)
+         (stream_copy)(dst, src, bytes);
+      else
+         std::memcpy(dst, src, bytes);
+   }
+   return r + typename ::boost::movelib::iter_difference<O>::type(n);
+}
+
+template<class I, class O>
+inline O streaming_move(I f, I l, O r, std::size_t threshold, ::boost::move_detail::true_type)
+{  return (stream)(f, l, r, threshold);  }
+
+template<class I, class O>
+inline O streaming_move(I f, I l, O r, std::size_t, ::boost::move_detail::false_type)
+{  return ::boost::move(f, l, r);  }
+
+template<class I, class F>
+inline F streaming_uninitialized_move(I f, I l, F r, std::size_t threshold, ::boost::move_detail::true_type)
+{  return (stream)(f, l, r, threshold);  }
+
+template<class I, class F>
+inline F streaming_uninitialized_move(I f, I l, F r, std::size_t, ::boost::move_detail::false_type)
+{  return ::boost::uninitialized_move(f, l, r);  }
+
+}  //namespace detail_streaming {
+
+///@endcond
+
+//! <b>Effects</b>: Same as boost::move(first, last, result). If the elements are trivially move assignable,
+//!   both ranges are contiguous and at least "threshold" bytes are moved, the elements are written
+//!   with non-temporal stores: the destination is not brought into the cache, which keeps the cache
+//!   contents of other threads or processes running in the same cores. Pass a zero threshold to always
+//!   use non-temporal stores for such ranges.
+//!
+//! <b>Requires</b>: The ranges shall not overlap.
+//!
+//! <b>Returns</b>: result + (last - first).
+//!
+//! <b>Note</b>: Use it when the destination won't be read again soon, otherwise its
+//!   first reads will miss the cache.
+template <typename I, // I models InputIterator
+          typename O> // O models OutputIterator
+inline O streaming_move(I f, I l, O result, std::size_t threshold = BOOST_MOVE_STREAMING_THRESHOLD)
+{
+   return detail_streaming::streaming_move(f, l, result, threshold,
+      ::boost::move_detail::bool_<detail_streaming::can_stream<I, O, false>::value>());
+}
+
+//! <b>Effects</b>: Same as boost::uninitialized_move(first, last, result). If the elements are
+//!   trivially move constructible, both ranges are contiguous and at least "threshold" bytes
+//!   are moved, the elements are written with non-temporal stores as in streaming_move.
+//!
+//! <b>Requires</b>: The ranges shall not overlap.
+//!
+//! <b>Returns</b>: result + (last - first).
+template <typename I, // I models InputIterator
+          typename F> // F models ForwardIterator
+inline F streaming_uninitialized_move(I f, I l, F result, std::size_t threshold = BOOST_MOVE_STREAMING_THRESHOLD)
+{
+   return detail_streaming::streaming_uninitialized_move(f, l, result, threshold,
+      ::boost::move_detail::bool_<detail_streaming::can_stream<I, F, true>::value>());
+}
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif //#ifndef BOOST_MOVE_ALGO_STREAMING_MOVE_HPP
@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+//! Adaptors to use three-way comparators with the sorting, merging and set algorithms.
+
+#ifndef BOOST_MOVE_ALGO_THREE_WAY_COMPARE_HPP
+#define BOOST_MOVE_ALGO_THREE_WAY_COMPARE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/algo/detail/search.hpp>
+
+namespace boost {
+namespace movelib {
+
+///@cond
+
+namespace detail_three_way {
+
+//Works with integers and with C++20 comparison categories
+template<class R>
+inline int sign(const R &r)
+{  return int(r > 0) - int(r < 0);  }
+
+}  //namespace detail_three_way {
+
+///@endcond
+
+//! Adapts a three-way comparator to the Compare argument taken by all algorithms. Comp3(a, b)
+//! shall return a value that compares less than, equal to or greater than zero if a is ordered before,
+//! equivalent to or after b: an integer (like std::strcmp) or, in C++20, std::strong_ordering or
+//! std::weak_ordering (like operator<=>). It shall induce a strict weak ordering.
+//!
+//! It's a model of Compare, so it can be used with any algorithm, but algorithms that must know if
+//! two elements are equivalent (the set_difference and set_unique_difference families, the key collection
+//! of adaptive_sort and adaptive_merge, and the equivalence predicate) call Comp3 once where two calls
+//! to a boolean Compare are needed.
+template<class Comp3>
+class three_way_compare
+{
+   public:
+   inline three_way_compare()
+      : m_comp()
+   {}
+
+   inline explicit three_way_compare(Comp3 comp)
+      : m_comp(comp)
+   {}
+
+   //! <b>Returns</b>: true if t is ordered before u.
+   template<class T, class U>
+   inline bool operator()(const T &t, const U &u)
+   {  return m_comp(t, u) < 0;  }
+
+   //! <b>Returns</b>: A negative value, zero or a positive value if t is ordered before,
+   //!   equivalent to or after u.
+   template<class T, class U>
+   inline int compare(const T &t, const U &u)
+   {  return detail_three_way::sign(m_comp(t, u));  }
+
+   inline const Comp3 &get() const
+   {  return m_comp; }
+
+   private:
+   Comp3 m_comp;
+};
+
+//! <b>Returns</b>: three_way_compare<Comp3>(comp).
+template<class Comp3>
+inline three_way_compare<Comp3> make_three_way_compare(Comp3 comp)
+{  return three_way_compare<Comp3>(comp);  }
+
+///@cond
+
+namespace detail_three_way {
+
+//Boolean comparators need a second call to tell equivalent elements apart
+template<class Compare, class T, class U>
+inline int compare(Compare &comp, const T &t, const U &u)
+{  return comp(t, u) ? -1 : int(comp(u, t));  }
+
+template<class Comp3, class T, class U>
+inline int compare(three_way_compare<Comp3> &comp, const T &t, const U &u)
+{  return comp.compare(t, u);  }
+
+//Searches key in the sorted range of unique elements [first, last). Returns its position
+//and sets found to true or, if it's not found, the position where it should be inserted.
+template<class RandIt, class T, class Compare>
+RandIt search_unique(RandIt first, RandIt const last, const T &key, Compare &comp, bool &found)
+{
+   RandIt const r = ::boost::movelib::lower_bound(first, last, key, comp);
+   found = r != last && !comp(key, *r);
+   return r;
+}
+
+//Three-way comparators can stop the binary search when key is found
+template<class RandIt, class T, class Comp3>
+RandIt search_unique(RandIt first, RandIt const last, const T &key, three_way_compare<Comp3> &comp, bool &found)
+{
+   typedef typename iter_size<RandIt>::type size_type;
+   size_type len = size_type(last - first);
+   while (len) {
+      size_type const step = size_type(len >> 1);
+      RandIt middle = first;
+      middle += step;
+      const int c = comp.compare(*middle, key);
+      if (c < 0) {
+         first = ++middle;
+         len = size_type(len - (step + 1));
+      }
+      else if (c > 0) {
+         len = step;
+      }
+      else {
+         found = true;
+         return middle;
+      }
+   }
+   found = false;
+   return first;
+}
+
+}  //namespace detail_three_way {
+
+///@endcond
+
+//! A BinaryPredicate that is true if two elements are equivalent according to comp,
+//! to be used with unique and similar algorithms. If Compare is a three_way_compare,
+//! comp is called once, otherwise twice.
+template<class Compare>
+class equivalence
+{
+   public:
+   inline equivalence()
+      : m_comp()
+   {}
+
+   inline explicit equivalence(Compare comp)
+      : m_comp(comp)
+   {}
+
+   template<class T, class U>
+   inline bool operator()(const T &t, const U &u)
+   {  return detail_three_way::compare(m_comp, t, u) == 0;  }
+
+   private:
+   Compare m_comp;
+};
+
+//! <b>Returns</b>: equivalence<Compare>(comp).
+template<class Compare>
+inline equivalence<Compare> make_equivalence(Compare comp)
+{  return equivalence<Compare>(comp);  }
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#define BOOST_MOVE_ALGO_THREE_WAY_COMPARE_HPP
@@ -13,6 +13,7 @@
 #define BOOST_MOVE_ALGO_UNIQUE_HPP
 
 #include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
 #include <boost/move/utility_core.hpp>
 
 namespace boost {
@@ -29,7 +30,7 @@ namespace movelib {
 //!
 //! <b>Complexity</b>: For nonempty ranges, exactly (last - first) - 1 applications of the corresponding predicate.
 template<class ForwardIterator, class BinaryPredicate>
-ForwardIterator unique(ForwardIterator first, ForwardIterator last, BinaryPredicate pred)
+BOOST_MOVE_CONSTEXPR20 ForwardIterator unique(ForwardIterator first, ForwardIterator last, BinaryPredicate pred)
 {
     if (first != last) {
       ForwardIterator next(first);
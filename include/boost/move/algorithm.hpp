@@ -50,6 +50,24 @@ inline F uninitialized_move_move_iterator(I f, I l, F r
 {
    return ::boost::uninitialized_move(f, l, r);
 }
+
+//Move insert iterators construct elements in the container, so
+//there is no uninitialized memory to construct into
+template
+<typename I,   // I models InputIterator
+typename C>   // C models Container
+inline back_move_insert_iterator<C> uninitialized_move_move_iterator(I f, I l, back_move_insert_iterator<C> r)
+{
+   return ::boost::move(f, l, r);
+}
+
+template
+<typename I,   // I models InputIterator
+typename C>   // C models Container
+inline move_insert_iterator<C> uninitialized_move_move_iterator(I f, I l, move_insert_iterator<C> r)
+{
+   return ::boost::move(f, l, r);
+}
 /*
 template
 <typename I,   // I models InputIterator
@@ -0,0 +1,405 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_ALLOCATE_UNIQUE_HPP_INCLUDED
+#define BOOST_MOVE_ALLOCATE_UNIQUE_HPP_INCLUDED
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/unique_ptr_meta_utils.hpp>
+#include <boost/move/detail/placement_new.hpp>
+#include <boost/move/detail/destruct_n.hpp>
+#include <cstddef>   //for std::size_t
+#ifdef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+#  include <boost/move/detail/fwd_macros.hpp>
+#endif
+
+//!\file
+//! Defines "allocate_unique" functions, which are factories to create instances
+//! of unique_ptr whose memory is obtained from an allocator, and <tt>allocator_delete</tt>,
+//! the deleter that destroys those objects and returns the memory to the allocator.
+
+namespace boost{
+// @cond
+namespace move_alu {
+
+namespace bmupmu = ::boost::move_upmu;
+
+//////////////////////////////////////
+//             rebind_alloc
+//////////////////////////////////////
+
+template<class A, class U>
+struct has_rebind
+{
+   template<class X> static char test(int, typename X::template rebind<U>::other*);
+   template<class X> static int test(...);
+   static const bool value = (1 == sizeof(test<A>(0, 0)));
+};
+
+template<class A, class U, bool = has_rebind<A, U>::value>
+struct rebind_alloc_impl
+{  typedef typename A::template rebind<U>::other type;  };
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+template<template<class, class...> class A, class T, class... Args, class U>
+struct rebind_alloc_impl<A<T, Args...>, U, false>
+{  typedef A<U, Args...> type;  };
+
+#else
+
+template<template<class> class A, class T, class U>
+struct rebind_alloc_impl<A<T>, U, false>
+{  typedef A<U> type;  };
+
+#endif
+
+template<class A, class U>
+struct rebind_alloc
+   : rebind_alloc_impl<A, U>
+{};
+
+template<class A, class U>
+struct rebind_alloc<A, const U>
+   : rebind_alloc_impl<A, U>
+{};
+
+//////////////////////////////////////
+//          dealloc_guard
+//////////////////////////////////////
+
+//Returns the memory to the allocator unless released
+template<class A, class T>
+class dealloc_guard
+{
+   dealloc_guard(const dealloc_guard &);
+   dealloc_guard &operator=(const dealloc_guard &);
+
+   public:
+   dealloc_guard(A &a, T *p, std::size_t n)
+      : m_a(a), m_p(p), m_n(n)
+   {}
+
+   ~dealloc_guard()
+   {
+      if(m_p)
+         m_a.deallocate(m_p, m_n);
+   }
+
+   void release()
+   {  m_p = 0;  }
+
+   private:
+   A &m_a;
+   T *m_p;
+   std::size_t m_n;
+};
+
+}  //namespace move_alu {
+// @endcond
+
+namespace movelib {
+
+//!The class template <tt>allocator_delete</tt> is the deleter (destruction policy) of the
+//!unique_ptrs returned by <tt>allocate_unique</tt>: it destroys the object and
+//!deallocates its memory using a copy of the allocator (rebound to the element type).
+//!
+//!The allocator is stored using the empty base optimization, so a unique_ptr
+//!using this deleter has the size of a pointer if the allocator is stateless.
+//!
+//! \tparam T The type to be deleted, possibly an array of unknown bound.
+//! \tparam Allocator The allocator type. The memory is deallocated with
+//!   a copy of Allocator rebound to remove_extent<T>::type
+template<class T, class Allocator>
+class allocator_delete
+   : private ::boost::move_alu::rebind_alloc<Allocator, T>::type
+{
+   public:
+   //! Allocator type used to deallocate memory.
+   typedef typename ::boost::move_alu::rebind_alloc<Allocator, T>::type allocator_type;
+
+   //! <b>Effects</b>: Default constructs the allocator.
+   allocator_delete()
+      : allocator_type()
+   {}
+
+   //! <b>Effects</b>: Stores a copy of "a" rebound to T.
+   template<class A>
+   explicit allocator_delete(const A &a)
+      : allocator_type(a)
+   {}
+
+   //! <b>Returns</b>: A reference to the stored allocator.
+   allocator_type &get_allocator() BOOST_NOEXCEPT
+   {  return *this;  }
+
+   //! <b>Returns</b>: A reference to the stored allocator.
+   const allocator_type &get_allocator() const BOOST_NOEXCEPT
+   {  return *this;  }
+
+   //! <b>Effects</b>: Destroys *p and deallocates its memory with the stored allocator.
+   void operator()(T *p)
+   {
+      BOOST_MOVE_STATIC_ASSERT(sizeof(T) > 0);
+      if(p){
+         p->~T();
+         this->get_allocator().deallocate(p, 1u);
+      }
+   }
+};
+
+//!Specialization of allocator_delete for arrays. It stores the number
+//!of elements, needed to destroy them and to deallocate the memory.
+template<class T, class Allocator>
+class allocator_delete<T[], Allocator>
+   : private ::boost::move_alu::rebind_alloc<Allocator, T>::type
+{
+   public:
+   //! Allocator type used to deallocate memory.
+   typedef typename ::boost::move_alu::rebind_alloc<Allocator, T>::type allocator_type;
+
+   //! <b>Effects</b>: Default constructs the allocator. size() is zero.
+   allocator_delete()
+      : allocator_type(), m_size(0u)
+   {}
+
+   //! <b>Effects</b>: Stores a copy of "a" rebound to T and the number of elements.
+   template<class A>
+   allocator_delete(const A &a, std::size_t n)
+      : allocator_type(a), m_size(n)
+   {}
+
+   //! <b>Returns</b>: A reference to the stored allocator.
+   allocator_type &get_allocator() BOOST_NOEXCEPT
+   {  return *this;  }
+
+   //! <b>Returns</b>: A reference to the stored allocator.
+   const allocator_type &get_allocator() const BOOST_NOEXCEPT
+   {  return *this;  }
+
+   //! <b>Returns</b>: The number of elements of the array.
+   std::size_t size() const BOOST_NOEXCEPT
+   {  return m_size;  }
+
+   //! <b>Effects</b>: Destroys the elements of p in reverse order
+   //!   and deallocates its memory with the stored allocator.
+   void operator()(T *p)
+   {
+      BOOST_MOVE_STATIC_ASSERT(sizeof(T) > 0);
+      if(p){
+         for(std::size_t n = m_size; n; ){
+            p[--n].~T();
+         }
+         this->get_allocator().deallocate(p, m_size);
+      }
+   }
+
+   private:
+   std::size_t m_size;
+};
+
+}  //namespace movelib {
+
+// @cond
+namespace move_alu {
+
+template<class T, class A>
+struct alloc_unique_if
+{
+   typedef ::boost::movelib::allocator_delete<T, A> deleter_type;
+   typedef ::boost::movelib::unique_ptr<T, deleter_type> t_is_not_array;
+};
+
+template<class T, class A>
+struct alloc_unique_if<T[], A>
+{
+   typedef ::boost::movelib::allocator_delete<T[], A> deleter_type;
+   typedef ::boost::movelib::unique_ptr<T[], deleter_type> t_is_array_of_unknown_bound;
+};
+
+template<class T, std::size_t N, class A>
+struct alloc_unique_if<T[N], A>
+{
+   typedef void t_is_array_of_known_bound;
+};
+
+template<class T, class A>
+struct alloc_unique_types
+{
+   typedef typename bmupmu::remove_extent<T>::type value_type;
+   typedef typename rebind_alloc<A, value_type>::type allocator_type;
+   typedef dealloc_guard<allocator_type, value_type> guard_type;
+};
+
+template<class T, class A, bool ValueInit>
+typename alloc_unique_if<T, A>::t_is_array_of_unknown_bound
+   allocate_unique_array(const A &a, std::size_t n)
+{
+   typedef alloc_unique_types<T, A> types;
+   typedef typename types::value_type U;
+   typedef typename alloc_unique_if<T, A>::deleter_type deleter_type;
+   typedef typename alloc_unique_if<T, A>::t_is_array_of_unknown_bound return_type;
+
+   deleter_type d(a, n);
+   U *const p = d.get_allocator().allocate(n);
+   if(p){
+      typename types::guard_type guard(d.get_allocator(), p, n);
+      ::boost::movelib::destruct_n<U, U*> destroyer(p);
+      for(std::size_t i = 0; i != n; ++i){
+         if(ValueInit)
+            ::new((void*)(p + i), boost_move_new_t()) U();
+         else
+            ::new((void*)(p + i), boost_move_new_t()) U;
+         destroyer.incr();
+      }
+      destroyer.release();
+      guard.release();
+   }
+   return return_type(p, ::boost::move(d));
+}
+
+}  //namespace move_alu {
+// @endcond
+
+namespace movelib {
+
+#if defined(BOOST_MOVE_DOXYGEN_INVOKED) || !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is not an array.
+//!
+//! <b>Effects</b>: Allocates memory for a T with a copy of "a" rebound to T and constructs
+//!   the object with <tt>::new(p) T(std::forward<Args>(args)...)</tt>. If the constructor throws,
+//!   the memory is deallocated.
+//!
+//! <b>Returns</b>: A unique_ptr owning the object or an empty unique_ptr if the allocator returned null.
+template<class T, class Allocator, class... Args>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I allocator_delete<T BOOST_MOVE_I Allocator> >,
+   typename ::boost::move_alu::alloc_unique_if<T BOOST_MOVE_I Allocator>::t_is_not_array)
+      allocate_unique(const Allocator &a, BOOST_FWD_REF(Args)... args)
+{
+   typedef ::boost::move_alu::alloc_unique_types<T, Allocator> types;
+   typedef typename ::boost::move_alu::alloc_unique_if<T, Allocator>::t_is_not_array return_type;
+   allocator_delete<T, Allocator> d(a);
+   T *const p = d.get_allocator().allocate(1u);
+   if(p){
+      typename types::guard_type guard(d.get_allocator(), p, 1u);
+      ::new((void*)p, boost_move_new_t()) T(::boost::forward<Args>(args)...);
+      guard.release();
+   }
+   return return_type(p, ::boost::move(d));
+}
+
+#else
+   #define BOOST_MOVE_ALLOCATE_UNIQUE_CODE(N)\
+      template<class T, class Allocator BOOST_MOVE_I##N BOOST_MOVE_CLASS##N>\
+      typename ::boost::move_alu::alloc_unique_if<T, Allocator>::t_is_not_array\
+         allocate_unique(const Allocator &a BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+      {\
+         typedef ::boost::move_alu::alloc_unique_types<T, Allocator> types;\
+         typedef typename ::boost::move_alu::alloc_unique_if<T, Allocator>::t_is_not_array return_type;\
+         allocator_delete<T, Allocator> d(a);\
+         T *const p = d.get_allocator().allocate(1u);\
+         if(p){\
+            typename types::guard_type guard(d.get_allocator(), p, 1u);\
+            ::new((void*)p, boost_move_new_t()) T( BOOST_MOVE_FWD##N );\
+            guard.release();\
+         }\
+         return return_type(p, ::boost::move(d));\
+      }\
+      //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_MOVE_ALLOCATE_UNIQUE_CODE)
+   #undef BOOST_MOVE_ALLOCATE_UNIQUE_CODE
+
+#endif
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is not an array.
+//!
+//! <b>Effects</b>: Same as allocate_unique, but the object is default initialized (<tt>::new(p) T</tt>).
+//!
+//! <b>Returns</b>: A unique_ptr owning the object or an empty unique_ptr if the allocator returned null.
+template<class T, class Allocator>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I allocator_delete<T BOOST_MOVE_I Allocator> >,
+   typename ::boost::move_alu::alloc_unique_if<T BOOST_MOVE_I Allocator>::t_is_not_array)
+      allocate_unique_definit(const Allocator &a)
+{
+   typedef ::boost::move_alu::alloc_unique_types<T, Allocator> types;
+   typedef typename ::boost::move_alu::alloc_unique_if<T, Allocator>::t_is_not_array return_type;
+   allocator_delete<T, Allocator> d(a);
+   T *const p = d.get_allocator().allocate(1u);
+   if(p){
+      typename types::guard_type guard(d.get_allocator(), p, 1u);
+      ::new((void*)p, boost_move_new_t()) T;
+      guard.release();
+   }
+   return return_type(p, ::boost::move(d));
+}
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is an array of
+//!   unknown bound.
+//!
+//! <b>Effects</b>: Allocates memory for n elements with a copy of "a" rebound to remove_extent_t<T>
+//!   and value initializes them. If a constructor throws, constructed elements are destroyed
+//!   and the memory is deallocated.
+//!
+//! <b>Returns</b>: A unique_ptr owning the array or an empty unique_ptr if the allocator returned null.
+template<class T, class Allocator>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I allocator_delete<T BOOST_MOVE_I Allocator> >,
+   typename ::boost::move_alu::alloc_unique_if<T BOOST_MOVE_I Allocator>::t_is_array_of_unknown_bound)
+      allocate_unique(const Allocator &a, std::size_t n)
+{  return ::boost::move_alu::allocate_unique_array<T, Allocator, true>(a, n);  }
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is an array of
+//!   unknown bound.
+//!
+//! <b>Effects</b>: Same as allocate_unique, but elements are default initialized.
+//!
+//! <b>Returns</b>: A unique_ptr owning the array or an empty unique_ptr if the allocator returned null.
+template<class T, class Allocator>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I allocator_delete<T BOOST_MOVE_I Allocator> >,
+   typename ::boost::move_alu::alloc_unique_if<T BOOST_MOVE_I Allocator>::t_is_array_of_unknown_bound)
+      allocate_unique_definit(const Allocator &a, std::size_t n)
+{  return ::boost::move_alu::allocate_unique_array<T, Allocator, false>(a, n);  }
+
+#if !defined(BOOST_NO_CXX11_DELETED_FUNCTIONS)
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is
+//!   an array of known bound.
+template<class T, class Allocator, class... Args>
+inline BOOST_MOVE_DOC1ST(unspecified,
+   typename ::boost::move_alu::alloc_unique_if<T BOOST_MOVE_I Allocator>::t_is_array_of_known_bound)
+      allocate_unique(const Allocator &, BOOST_FWD_REF(Args) ...) = delete;
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is
+//!   an array of known bound.
+template<class T, class Allocator, class... Args>
+inline BOOST_MOVE_DOC1ST(unspecified,
+   typename ::boost::move_alu::alloc_unique_if<T BOOST_MOVE_I Allocator>::t_is_array_of_known_bound)
+      allocate_unique_definit(const Allocator &, BOOST_FWD_REF(Args) ...) = delete;
+
+#endif
+
+}  //namespace movelib {
+}  //namespace boost{
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_MOVE_ALLOCATE_UNIQUE_HPP_INCLUDED
@@ -0,0 +1,49 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_DETAIL_CONSTRUCT_AT_HPP
+#define BOOST_MOVE_DETAIL_CONSTRUCT_AT_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/detail/placement_new.hpp>
+
+#if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+#include <memory>
+#endif
+
+namespace boost {
+namespace movelib {
+
+//Constructs a T at p from u. Placement new can't be used in constant
+//expressions so std::construct_at is used when algorithms are constexpr.
+template<class T, class U>
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 T* construct_at(T *p, BOOST_FWD_REF(U) u)
+{
+   #if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR) && defined(__cpp_lib_constexpr_dynamic_alloc)
+   return ::std::construct_at(p, ::boost::forward<U>(u));
+   #else
+   return ::new((void*)p, boost_move_new_t()) T(::boost::forward<U>(u));
+   #endif
+}
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#endif   //BOOST_MOVE_DETAIL_CONSTRUCT_AT_HPP
@@ -22,6 +22,7 @@
 #  pragma once
 #endif
 
+#include <boost/move/detail/workaround.hpp>
 #include <cstddef>
 
 namespace boost {
@@ -31,26 +32,26 @@ template<class T, class RandItUninit>
 class destruct_n
 {
    public:
-   explicit destruct_n(RandItUninit raw)
+   BOOST_MOVE_CONSTEXPR20 explicit destruct_n(RandItUninit raw)
       : m_ptr(raw), m_size()
    {}
 
-   void incr()
+   BOOST_MOVE_CONSTEXPR20 void incr()
    {
       ++m_size;
    }
 
-   void incr(std::size_t n)
+   BOOST_MOVE_CONSTEXPR20 void incr(std::size_t n)
    {
       m_size += n;
    }
 
-   void release()
+   BOOST_MOVE_CONSTEXPR20 void release()
    {
       m_size = 0u;
    }
 
-   ~destruct_n()
+   BOOST_MOVE_CONSTEXPR20 ~destruct_n()
    {
       while(m_size--){
          m_ptr[m_size].~T();
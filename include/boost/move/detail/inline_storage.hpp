@@ -0,0 +1,91 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! \file
+
+#ifndef BOOST_MOVE_DETAIL_INLINE_STORAGE_HPP
+#define BOOST_MOVE_DETAIL_INLINE_STORAGE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/traits.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <cstddef>
+#include <new>
+
+//Utilities for type-erased owners (polymorphic_value, unique_function)
+//that store small objects in an inline buffer
+
+namespace boost {
+namespace move_detail {
+
+//Objects that can be relocated copying their bytes
+template<class T>
+struct is_bitwise_relocatable
+{
+   static const bool value = is_trivially_copy_constructible<T>::value &&
+                             is_trivially_destructible<T>::value;
+};
+
+//boost::has_nothrow_move is only checked (it's the C++03 customization point)
+//if the move constructor is not known to be nothrow
+template<class T, bool = is_nothrow_move_constructible<T>::value || is_bitwise_relocatable<T>::value>
+struct is_nothrow_relocatable
+{
+   static const bool value = true;
+};
+
+template<class T>
+struct is_nothrow_relocatable<T, false>
+{
+   static const bool value = ::boost::has_nothrow_move<T>::value;
+};
+
+//T can be stored in a buffer of "Size" bytes aligned to "Align" and moved
+//between buffers without throwing
+template<class T, std::size_t Size, std::size_t Align>
+struct fits_inline
+{
+   static const bool value = sizeof(T) <= Size && Align % alignment_of<T>::value == 0u &&
+      is_nothrow_relocatable<T>::value;
+};
+
+//Deallocates memory obtained from operator new unless released
+class heap_guard
+{
+   heap_guard(const heap_guard &);
+   heap_guard &operator=(const heap_guard &);
+
+   public:
+   explicit heap_guard(void *p)
+      : m_p(p)
+   {}
+
+   ~heap_guard()
+   {  ::operator delete(m_p);  }
+
+   void release()
+   {  m_p = 0;  }
+
+   private:
+   void *m_p;
+};
+
+}  //namespace move_detail {
+}  //namespace boost {
+
+#endif   //#ifndef BOOST_MOVE_DETAIL_INLINE_STORAGE_HPP
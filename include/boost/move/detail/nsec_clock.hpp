@@ -178,26 +178,194 @@ BOOST_MOVE_FORCEINLINE boost::uint64_t nsec_clock() BOOST_NOEXCEPT
 
 #endif  // POSIX
 
+//----------------------------------------------------------------------------//
+//                     Hardware counters (Linux perf_event)                   //
+//----------------------------------------------------------------------------//
+
+#if defined(__linux__) && !defined(BOOST_MOVE_DETAIL_NO_PERF_EVENT)
+#  define BOOST_MOVE_DETAIL_HAS_PERF_EVENT
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <cstring>
+#endif
+
 namespace boost { namespace move_detail {
 
 typedef boost::uint64_t nanosecond_type;
 
+enum hw_counter_id
+{
+   hw_instructions,
+   hw_cycles,
+   hw_branch_misses,
+   hw_l1d_misses,
+   hw_llc_misses,
+   hw_counter_count
+};
+
+inline const char *hw_counter_name(std::size_t id)
+{
+   static const char *const names[] = { "Ins", "Cyc", "BrM", "L1M", "LLM" };
+   return id < hw_counter_count ? names[id] : "";
+}
+
+//Counters of the calling thread, opened as a single perf_event group so that they
+//are scheduled together and scaled by the time the group was really counting when
+//the PMU is multiplexed. Each thread uses its own group (C++03 compilers without
+//thread_local only get counters in the thread that first used them). Counters that
+//can't be opened (no permission, virtualized PMU, non-Linux systems...) are just
+//not reported.
+class hw_counter_group
+{
+   hw_counter_group(const hw_counter_group &);
+   hw_counter_group & operator=(const hw_counter_group &);
+
+   public:
+   hw_counter_group() BOOST_NOEXCEPT
+      : m_leader(-1), m_count(0u), m_mask(0u)
+   {
+      for(std::size_t i = 0; i != hw_counter_count; ++i){
+         m_fd[i] = -1;
+         m_ids[i] = 0u;
+      }
+      #if defined(BOOST_MOVE_DETAIL_HAS_PERF_EVENT)
+      #if defined(BOOST_NO_CXX11_THREAD_LOCAL)
+      m_owner = long(::syscall(SYS_gettid));
+      #endif
+      const boost::uint32_t types[hw_counter_count] =
+         { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE };
+      const boost::uint64_t configs[hw_counter_count] =
+         { PERF_COUNT_HW_INSTRUCTIONS
+         , PERF_COUNT_HW_CPU_CYCLES
+         , PERF_COUNT_HW_BRANCH_MISSES
+         , PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+         , PERF_COUNT_HW_CACHE_LL  | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+         };
+      for(std::size_t i = 0; i != hw_counter_count; ++i){
+         struct perf_event_attr attr;
+         std::memset(&attr, 0, sizeof(attr));
+         attr.type = types[i];
+         attr.size = sizeof(attr);
+         attr.config = configs[i];
+         attr.exclude_kernel = 1;
+         attr.exclude_hv = 1;
+         attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+         //The first counter that can be opened leads the group
+         m_fd[i] = int(::syscall(__NR_perf_event_open, &attr, 0, -1, m_leader, 0));
+         if(m_fd[i] >= 0){
+            if(m_leader < 0)
+               m_leader = m_fd[i];
+            m_ids[m_count++] = i;
+            m_mask |= 1u << i;
+         }
+      }
+      #endif
+   }
+
+   ~hw_counter_group()
+   {
+      #if defined(BOOST_MOVE_DETAIL_HAS_PERF_EVENT)
+      for(std::size_t i = 0; i != hw_counter_count; ++i){
+         if(m_fd[i] >= 0)
+            ::close(m_fd[i]);
+      }
+      #endif
+   }
+
+   //Reads the counters of the group, scaled if they were multiplexed with other
+   //events. Returns a mask where bit "i" is set if values[i] was read.
+   unsigned read(boost::uint64_t (&values)[hw_counter_count]) const BOOST_NOEXCEPT
+   {
+      for(std::size_t i = 0; i != hw_counter_count; ++i){
+         values[i] = 0u;
+      }
+      #if defined(BOOST_MOVE_DETAIL_HAS_PERF_EVENT)
+      #if defined(BOOST_NO_CXX11_THREAD_LOCAL)
+      if(m_owner != long(::syscall(SYS_gettid)))
+         return 0u;
+      #endif
+      if(m_leader < 0)
+         return 0u;
+      //{ nr, time_enabled, time_running, value[nr] }
+      boost::uint64_t data[3u + hw_counter_count];
+      const ssize_t expected = ssize_t((3u + m_count)*sizeof(boost::uint64_t));
+      if(::read(m_leader, data, sizeof(data)) != expected || data[0] != m_count || !data[2])
+         return 0u;
+      const double scale = data[2] < data[1] ? double(data[1])/double(data[2]) : 1.0;
+      for(std::size_t i = 0; i != m_count; ++i){
+         values[m_ids[i]] = boost::uint64_t(double(data[3u + i])*scale);
+      }
+      return m_mask;
+      #else
+      return 0u;
+      #endif
+   }
+
+   static hw_counter_group &get() BOOST_NOEXCEPT
+   {
+      #if defined(BOOST_NO_CXX11_THREAD_LOCAL)
+      static hw_counter_group group;
+      #else
+      static thread_local hw_counter_group group;
+      #endif
+      return group;
+   }
+
+   private:
+   int m_fd[hw_counter_count];
+   //Counter of each value of a group read
+   std::size_t m_ids[hw_counter_count];
+   int m_leader;
+   std::size_t m_count;
+   unsigned m_mask;
+   #if defined(BOOST_MOVE_DETAIL_HAS_PERF_EVENT) && defined(BOOST_NO_CXX11_THREAD_LOCAL)
+   long m_owner;
+   #endif
+};
+
 struct cpu_times
 {
    nanosecond_type wall;
    nanosecond_type user;
    nanosecond_type system;
+   //Hardware counters, only meaningful if the corresponding bit of hw_mask is set
+   boost::uint64_t hw[hw_counter_count];
+   unsigned hw_mask;
 
-   void clear() { wall = user = system = 0; }
+   void clear()
+   {
+      wall = user = system = 0;
+      for(std::size_t i = 0; i != hw_counter_count; ++i){
+         hw[i] = 0;
+      }
+      hw_mask = 0u;
+   }
+
+   bool has_hw(std::size_t id) const
+   {  return 0 != (hw_mask & (1u << id));  }
+
+   void subtract(const cpu_times &other)
+   {
+      wall   -= other.wall;
+      user   -= other.user;
+      system -= other.system;
+      for(std::size_t i = 0; i != hw_counter_count; ++i){
+         hw[i] -= other.hw[i];
+      }
+   }
 
    cpu_times()
    {  this->clear(); }
 };
 
 
-inline void get_cpu_times(boost::move_detail::cpu_times& current)
+inline void get_cpu_times(boost::move_detail::cpu_times& current, bool hw_counters = false)
 {
-    current.wall = nsec_clock();
+   if(hw_counters){
+      current.hw_mask = hw_counter_group::get().read(current.hw);
+   }
+   current.wall = nsec_clock();
 }
 
 
@@ -206,7 +374,11 @@ class cpu_timer
    public:
 
       //  constructor
-      cpu_timer() BOOST_NOEXCEPT : m_is_stopped(true) {}
+      cpu_timer() BOOST_NOEXCEPT : m_is_stopped(true), m_hw_counters(false) {}
+
+      //  If hw_counters is true, hardware counters available in the system are
+      //  also measured for the calling thread. Check cpu_times::hw_mask to know which ones.
+      explicit cpu_timer(bool hw_counters) BOOST_NOEXCEPT : m_is_stopped(true), m_hw_counters(hw_counters) {}
 
       //  observers
       bool          is_stopped() const BOOST_NOEXCEPT              { return m_is_stopped; }
@@ -220,6 +392,7 @@ class cpu_timer
    private:
       cpu_times     m_times;
       bool          m_is_stopped;
+      bool          m_hw_counters;
 };
 
 
@@ -228,7 +401,7 @@ class cpu_timer
 inline void cpu_timer::start() BOOST_NOEXCEPT
 {
    m_is_stopped = false;
-   get_cpu_times(m_times);
+   get_cpu_times(m_times, m_hw_counters);
 }
 
 inline void cpu_timer::stop() BOOST_NOEXCEPT
@@ -238,10 +411,9 @@ inline void cpu_timer::stop() BOOST_NOEXCEPT
    m_is_stopped = true;
       
    cpu_times current;
-   get_cpu_times(current);
-   m_times.wall = (current.wall - m_times.wall);
-   m_times.user = (current.user - m_times.user);
-   m_times.system = (current.system - m_times.system);
+   get_cpu_times(current, m_hw_counters);
+   current.subtract(m_times);
+   m_times = current;
 }
 
 inline cpu_times cpu_timer::elapsed() const BOOST_NOEXCEPT
@@ -249,10 +421,8 @@ inline cpu_times cpu_timer::elapsed() const BOOST_NOEXCEPT
    if (is_stopped())
       return m_times;
    cpu_times current;
-   get_cpu_times(current);
-   current.wall -= m_times.wall;
-   current.user -= m_times.user;
-   current.system -= m_times.system;
+   get_cpu_times(current, m_hw_counters);
+   current.subtract(m_times);
    return current;
 }
 
@@ -262,9 +432,7 @@ inline void cpu_timer::resume() BOOST_NOEXCEPT
    {
       cpu_times current (m_times);
       start();
-      m_times.wall   -= current.wall;
-      m_times.user   -= current.user;
-      m_times.system -= current.system;
+      m_times.subtract(current);
    }
 }
 
@@ -0,0 +1,44 @@
+#ifndef BOOST_MOVE_DETAIL_THROW_BAD_ALLOC_HPP
+#define BOOST_MOVE_DETAIL_THROW_BAD_ALLOC_HPP
+///////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if !defined(BOOST_NO_EXCEPTIONS)
+#  include <new>     //std::bad_alloc
+#else
+#  include <cstdlib> //std::abort
+#endif
+
+namespace boost {
+namespace move_detail {
+
+//Reports an allocation failure: throws std::bad_alloc or, if exceptions
+//are disabled (BOOST_NO_EXCEPTIONS), aborts the program.
+BOOST_NORETURN inline void throw_bad_alloc()
+{
+   #if !defined(BOOST_NO_EXCEPTIONS)
+   throw std::bad_alloc();
+   #else
+   std::abort();
+   #endif
+}
+
+}  //namespace move_detail {
+}  //namespace boost {
+
+#endif   //BOOST_MOVE_DETAIL_THROW_BAD_ALLOC_HPP
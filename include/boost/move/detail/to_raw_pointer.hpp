@@ -29,11 +29,11 @@ namespace boost {
 namespace movelib {
 
 template <class T>
-BOOST_MOVE_FORCEINLINE T* to_raw_pointer(T* p)
+BOOST_MOVE_FORCEINLINE BOOST_MOVE_CONSTEXPR20 T* to_raw_pointer(T* p)
 {  return p; }
 
 template <class Pointer>
-inline typename boost::movelib::pointer_element<Pointer>::type*
+inline BOOST_MOVE_CONSTEXPR20 typename boost::movelib::pointer_element<Pointer>::type*
 to_raw_pointer(const Pointer &p)
 {  return ::boost::movelib::to_raw_pointer(p.operator->());  }
 
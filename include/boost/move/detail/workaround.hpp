@@ -147,6 +147,16 @@ template<unsigned> struct static_assert_test {};
 #define BOOST_MOVE_INTRINSIC_CAST BOOST_MOVE_FORCEINLINE
 #endif
 
+//Algorithms that can be evaluated at compile time since C++20 (which allows
+//uninitialized variables, try blocks and trivial default initialization in constexpr functions)
+#if defined(__cpp_constexpr) && (__cpp_constexpr >= 201907L) && !defined(BOOST_MOVE_NO_CXX20_CONSTEXPR)
+   #define BOOST_MOVE_HAS_CXX20_CONSTEXPR
+   #define BOOST_MOVE_CONSTEXPR20 constexpr
+   #define BOOST_MOVE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+   #define BOOST_MOVE_CONSTEXPR20
+#endif
+
 #if defined(__has_builtin)
 #if __has_builtin(__builtin_launder)
    #define BOOST_MOVE_HAS_BUILTIN_LAUNDER
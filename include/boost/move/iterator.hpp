@@ -179,6 +179,31 @@ inline move_iterator<It> make_move_iterator(const It &it)
 //
 //////////////////////////////////////////////////////////////////////////////
 
+/// @cond
+namespace move_detail {
+
+template<class C>
+struct has_reserve_member
+{
+   template<class U, void (U::*)(typename U::size_type)> struct tester;
+
+   template<class U> static yes_type test(tester<U, &U::reserve>*);
+   template<class U> static no_type  test(...);
+
+   static const bool value = sizeof(test<C>(0)) == sizeof(yes_type);
+};
+
+template<class C>
+inline void reserve_back(C &c, typename C::size_type n, bool_<true>)
+{  c.reserve(c.size() + n);  }
+
+template<class C>
+inline void reserve_back(C &, typename C::size_type, bool_<false>)
+{}
+
+}  //namespace move_detail {
+/// @endcond
+
 
 //! A move insert iterator that move constructs elements at the
 //! back of a container
@@ -197,6 +222,19 @@ class back_move_insert_iterator
 
    explicit back_move_insert_iterator(C& x) : container_m(&x) { }
 
+   //! <b>Effects</b>: Constructs an iterator that inserts at the back of x and, if C has
+   //!   a reserve(size_type) member, calls x.reserve(x.size() + size_hint) so that the next
+   //!   size_hint insertions don't reallocate.
+   back_move_insert_iterator(C& x, typename C::size_type size_hint)
+      : container_m(&x)
+   {
+      ::boost::move_detail::reserve_back
+         (x, size_hint, ::boost::move_detail::bool_< ::boost::move_detail::has_reserve_member<C>::value>());
+   }
+
+   //! <b>Returns</b>: The container this iterator inserts into.
+   C& container() const { return *container_m; }
+
    back_move_insert_iterator& operator=(reference x)
    { container_m->push_back(boost::move(x)); return *this; }
 
@@ -216,6 +254,14 @@ inline back_move_insert_iterator<C> back_move_inserter(C& x)
    return back_move_insert_iterator<C>(x);
 }
 
+//!
+//! <b>Returns</b>: back_move_insert_iterator<C>(x, size_hint).
+template <typename C> // C models Container
+inline back_move_insert_iterator<C> back_move_inserter(C& x, typename C::size_type size_hint)
+{
+   return back_move_insert_iterator<C>(x, size_hint);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 //                         front_move_insert_iterator
@@ -281,6 +327,12 @@ class move_insert_iterator
       : container_m(&x), pos_(pos)
    {}
 
+   //! <b>Returns</b>: The container this iterator inserts into.
+   C& container() const { return *container_m; }
+
+   //! <b>Returns</b>: The position before which the next element will be inserted.
+   typename C::iterator position() const { return pos_; }
+
    move_insert_iterator& operator=(reference x)
    {
       pos_ = container_m->insert(pos_, ::boost::move(x));
@@ -0,0 +1,367 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_MAKE_UNIQUE_ALIGNED_HPP_INCLUDED
+#define BOOST_MOVE_MAKE_UNIQUE_ALIGNED_HPP_INCLUDED
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/unique_ptr_meta_utils.hpp>
+#include <boost/move/detail/placement_new.hpp>
+#include <boost/move/detail/destruct_n.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <boost/move/detail/throw_bad_alloc.hpp>
+#include <cstddef>   //for std::size_t
+#include <cassert>
+#include <cstdlib>   //for posix_memalign, malloc, free
+#if defined(BOOST_WINDOWS)
+#  include <malloc.h>   //for _aligned_malloc
+#endif
+#ifdef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+#  include <boost/move/detail/fwd_macros.hpp>
+#endif
+
+//!\file
+//! Defines "make_unique_aligned" functions, which are factories to create instances
+//! of unique_ptr whose objects are placed in memory with a user-specified alignment
+//! (e.g. a cache line, to avoid false sharing, or the width of SIMD registers),
+//! <tt>aligned_delete</tt>, their deleter, and <tt>cache_padded</tt>, a wrapper
+//! that makes each element of an array occupy whole cache lines.
+
+#if !defined(BOOST_MOVE_CACHE_LINE_SIZE) || defined(BOOST_MOVE_DOXYGEN_INVOKED)
+//! Size in bytes of a cache line, used as the default alignment of cache_padded.
+//! Can be defined by the user before including this header.
+#  define BOOST_MOVE_CACHE_LINE_SIZE 64
+#endif
+
+namespace boost{
+// @cond
+namespace move_ua {
+
+namespace bmupmu = ::boost::move_upmu;
+
+//Returns memory aligned to "alignment" (a power of two) or null
+inline void *aligned_allocate(std::size_t alignment, std::size_t bytes)
+{
+   if(alignment < sizeof(void*))
+      alignment = sizeof(void*);
+   if(!bytes)
+      bytes = 1u;
+   #if defined(BOOST_WINDOWS)
+   return ::_aligned_malloc(bytes, alignment);
+   #elif defined(__unix__) || defined(__APPLE__)
+   void *p = 0;
+   return ::posix_memalign(&p, alignment, bytes) == 0 ? p : 0;
+   #else
+   //Store the original pointer before the aligned block
+   if(bytes > std::size_t(-1) - alignment - sizeof(void*))
+      return 0;
+   void *const raw = std::malloc(bytes + alignment + sizeof(void*));
+   if(!raw)
+      return 0;
+   std::size_t const addr = reinterpret_cast<std::size_t>(static_cast<char*>(raw) + sizeof(void*));
+   void **const aligned = reinterpret_cast<void**>((addr + alignment - 1u) & ~(alignment - 1u));
+   aligned[-1] = raw;
+   return aligned;
+   #endif
+}
+
+inline void aligned_deallocate(void *p)
+{
+   #if defined(BOOST_WINDOWS)
+   ::_aligned_free(p);
+   #elif defined(__unix__) || defined(__APPLE__)
+   std::free(p);
+   #else
+   if(p)
+      std::free(static_cast<void**>(p)[-1]);
+   #endif
+}
+
+inline bool is_power_of_two(std::size_t n)
+{  return n && !(n & (n - 1u));  }
+
+//Deallocates unless released
+class aligned_guard
+{
+   aligned_guard(const aligned_guard &);
+   aligned_guard &operator=(const aligned_guard &);
+
+   public:
+   explicit aligned_guard(void *p)
+      : m_p(p)
+   {}
+
+   ~aligned_guard()
+   {  aligned_deallocate(m_p);  }
+
+   void release()
+   {  m_p = 0;  }
+
+   private:
+   void *m_p;
+};
+
+template<class T>
+void *allocate_for(std::size_t alignment, std::size_t n)
+{
+   std::size_t const min_align = ::boost::move_detail::alignment_of<T>::value;
+   assert(is_power_of_two(alignment));
+   if(alignment < min_align)
+      alignment = min_align;
+   if(n > std::size_t(-1)/sizeof(T))
+      ::boost::move_detail::throw_bad_alloc();
+   void *const p = aligned_allocate(alignment, n*sizeof(T));
+   if(!p)
+      ::boost::move_detail::throw_bad_alloc();
+   return p;
+}
+
+}  //namespace move_ua {
+// @endcond
+
+namespace movelib {
+
+//!The class template <tt>aligned_delete</tt> is the deleter (destruction policy) of the
+//!unique_ptrs returned by <tt>make_unique_aligned</tt>. It destroys the object and
+//!returns the memory to the aligned allocation function of the system
+//!(<tt>posix_memalign</tt>/<tt>free</tt> or <tt>_aligned_malloc</tt>/<tt>_aligned_free</tt>).
+//!
+//!The alignment is not needed to deallocate, so the deleter is stateless and
+//!unique_ptr keeps the size of a pointer.
+//!
+//! \tparam T The type to be deleted, possibly an array of unknown bound.
+template<class T>
+struct aligned_delete
+{
+   //! <b>Effects</b>: Destroys *p and deallocates its memory.
+   void operator()(T *p) const BOOST_NOEXCEPT
+   {
+      BOOST_MOVE_STATIC_ASSERT(sizeof(T) > 0);
+      if(p){
+         p->~T();
+         ::boost::move_ua::aligned_deallocate(p);
+      }
+   }
+};
+
+//!Specialization of aligned_delete for arrays. It stores the number of elements,
+//!needed to destroy them.
+template<class T>
+class aligned_delete<T[]>
+{
+   public:
+   //! <b>Effects</b>: Constructs a deleter for arrays of "n" elements.
+   explicit aligned_delete(std::size_t n = 0u) BOOST_NOEXCEPT
+      : m_size(n)
+   {}
+
+   //! <b>Returns</b>: The number of elements of the array.
+   std::size_t size() const BOOST_NOEXCEPT
+   {  return m_size;  }
+
+   //! <b>Effects</b>: Destroys the elements of p in reverse order and deallocates its memory.
+   void operator()(T *p) const BOOST_NOEXCEPT
+   {
+      BOOST_MOVE_STATIC_ASSERT(sizeof(T) > 0);
+      if(p){
+         for(std::size_t n = m_size; n; ){
+            p[--n].~T();
+         }
+         ::boost::move_ua::aligned_deallocate(p);
+      }
+   }
+
+   private:
+   std::size_t m_size;
+};
+
+#if !defined(BOOST_NO_ALIGNMENT) && (!defined(BOOST_MSVC) || !defined(BOOST_NO_CXX11_ALIGNAS)) \
+    || defined(BOOST_MOVE_DOXYGEN_INVOKED)
+
+//!An aggregate holding a T aligned to "Alignment" bytes. Its size is a multiple of
+//!"Alignment", so each element of an array of cache_padded objects occupies whole cache lines
+//!and no two elements share a line (e.g. per-thread counters).
+//!
+//!Use <tt>make_unique_aligned<cache_padded<T>[]>(BOOST_MOVE_CACHE_LINE_SIZE, n)</tt> to
+//!allocate such an array.
+template<class T, std::size_t Alignment = BOOST_MOVE_CACHE_LINE_SIZE>
+struct BOOST_ALIGNMENT(Alignment) cache_padded
+{
+   T value;
+};
+
+#endif
+
+}  //namespace movelib {
+
+// @cond
+namespace move_ua {
+
+template<class T>
+struct unique_ptr_if
+{
+   typedef ::boost::movelib::unique_ptr<T, ::boost::movelib::aligned_delete<T> > t_is_not_array;
+};
+
+template<class T>
+struct unique_ptr_if<T[]>
+{
+   typedef ::boost::movelib::unique_ptr<T[], ::boost::movelib::aligned_delete<T[]> > t_is_array_of_unknown_bound;
+};
+
+template<class T, std::size_t N>
+struct unique_ptr_if<T[N]>
+{
+   typedef void t_is_array_of_known_bound;
+};
+
+template<class T, bool ValueInit>
+typename unique_ptr_if<T>::t_is_array_of_unknown_bound
+   make_unique_aligned_array(std::size_t alignment, std::size_t n)
+{
+   typedef typename bmupmu::remove_extent<T>::type U;
+   typedef typename unique_ptr_if<T>::t_is_array_of_unknown_bound return_type;
+   U *const p = static_cast<U*>(allocate_for<U>(alignment, n));
+   aligned_guard guard(p);
+   ::boost::movelib::destruct_n<U, U*> destroyer(p);
+   for(std::size_t i = 0; i != n; ++i){
+      if(ValueInit)
+         ::new((void*)(p + i), boost_move_new_t()) U();
+      else
+         ::new((void*)(p + i), boost_move_new_t()) U;
+      destroyer.incr();
+   }
+   destroyer.release();
+   guard.release();
+   return return_type(p, ::boost::movelib::aligned_delete<T>(n));
+}
+
+}  //namespace move_ua {
+// @endcond
+
+namespace movelib {
+
+#if defined(BOOST_MOVE_DOXYGEN_INVOKED) || !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is not an array.
+//!
+//! <b>Requires</b>: "alignment" is a power of two. If it's smaller than the alignment of T,
+//!   the alignment of T is used.
+//!
+//! <b>Returns</b>: <tt>unique_ptr<T, aligned_delete<T> >(::new(p) T(std::forward<Args>(args)...))</tt>,
+//!   where p points to memory aligned to "alignment" bytes.
+//!
+//! <b>Throws</b>: std::bad_alloc if memory can't be allocated or any exception thrown by the constructor.
+template<class T, class... Args>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I aligned_delete<T> >,
+   typename ::boost::move_ua::unique_ptr_if<T>::t_is_not_array)
+      make_unique_aligned(std::size_t alignment, BOOST_FWD_REF(Args)... args)
+{
+   T *const p = static_cast<T*>(::boost::move_ua::allocate_for<T>(alignment, 1u));
+   ::boost::move_ua::aligned_guard guard(p);
+   ::new((void*)p, boost_move_new_t()) T(::boost::forward<Args>(args)...);
+   guard.release();
+   return unique_ptr<T, aligned_delete<T> >(p);
+}
+
+#else
+   #define BOOST_MOVE_MAKE_UNIQUE_ALIGNED_CODE(N)\
+      template<class T BOOST_MOVE_I##N BOOST_MOVE_CLASS##N>\
+      typename ::boost::move_ua::unique_ptr_if<T>::t_is_not_array\
+         make_unique_aligned(std::size_t alignment BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+      {\
+         T *const p = static_cast<T*>(::boost::move_ua::allocate_for<T>(alignment, 1u));\
+         ::boost::move_ua::aligned_guard guard(p);\
+         ::new((void*)p, boost_move_new_t()) T( BOOST_MOVE_FWD##N );\
+         guard.release();\
+         return unique_ptr<T, aligned_delete<T> >(p);\
+      }\
+      //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_MOVE_MAKE_UNIQUE_ALIGNED_CODE)
+   #undef BOOST_MOVE_MAKE_UNIQUE_ALIGNED_CODE
+
+#endif
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is not an array.
+//!
+//! <b>Effects</b>: Same as make_unique_aligned, but the object is default initialized (<tt>::new(p) T</tt>).
+template<class T>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I aligned_delete<T> >,
+   typename ::boost::move_ua::unique_ptr_if<T>::t_is_not_array)
+      make_unique_aligned_definit(std::size_t alignment)
+{
+   T *const p = static_cast<T*>(::boost::move_ua::allocate_for<T>(alignment, 1u));
+   ::boost::move_ua::aligned_guard guard(p);
+   ::new((void*)p, boost_move_new_t()) T;
+   guard.release();
+   return unique_ptr<T, aligned_delete<T> >(p);
+}
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is an array of
+//!   unknown bound.
+//!
+//! <b>Requires</b>: "alignment" is a power of two.
+//!
+//! <b>Returns</b>: A unique_ptr owning "n" value initialized elements. The first element is aligned
+//!   to "alignment" bytes (use cache_padded elements to align all of them).
+//!
+//! <b>Throws</b>: std::bad_alloc if memory can't be allocated or any exception thrown by a constructor.
+template<class T>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I aligned_delete<T> >,
+   typename ::boost::move_ua::unique_ptr_if<T>::t_is_array_of_unknown_bound)
+      make_unique_aligned(std::size_t alignment, std::size_t n)
+{  return ::boost::move_ua::make_unique_aligned_array<T, true>(alignment, n);  }
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is an array of
+//!   unknown bound.
+//!
+//! <b>Effects</b>: Same as make_unique_aligned, but elements are default initialized.
+template<class T>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I aligned_delete<T> >,
+   typename ::boost::move_ua::unique_ptr_if<T>::t_is_array_of_unknown_bound)
+      make_unique_aligned_definit(std::size_t alignment, std::size_t n)
+{  return ::boost::move_ua::make_unique_aligned_array<T, false>(alignment, n);  }
+
+#if !defined(BOOST_NO_CXX11_DELETED_FUNCTIONS)
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is
+//!   an array of known bound.
+template<class T, class... Args>
+inline BOOST_MOVE_DOC1ST(unspecified,
+   typename ::boost::move_ua::unique_ptr_if<T>::t_is_array_of_known_bound)
+      make_unique_aligned(std::size_t, BOOST_FWD_REF(Args) ...) = delete;
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is
+//!   an array of known bound.
+template<class T, class... Args>
+inline BOOST_MOVE_DOC1ST(unspecified,
+   typename ::boost::move_ua::unique_ptr_if<T>::t_is_array_of_known_bound)
+      make_unique_aligned_definit(std::size_t, BOOST_FWD_REF(Args) ...) = delete;
+
+#endif
+
+}  //namespace movelib {
+}  //namespace boost{
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_MOVE_MAKE_UNIQUE_ALIGNED_HPP_INCLUDED
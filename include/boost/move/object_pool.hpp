@@ -0,0 +1,315 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_OBJECT_POOL_HPP_INCLUDED
+#define BOOST_MOVE_OBJECT_POOL_HPP_INCLUDED
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/unique_ptr_meta_utils.hpp>
+#include <boost/move/detail/placement_new.hpp>
+#include <cstddef>   //for std::size_t
+#include <new>       //for operator new
+#ifdef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+#  include <boost/move/detail/fwd_macros.hpp>
+#endif
+
+//!\file
+//! Describes <tt>object_pool</tt>, a free list that recycles the memory of objects owned by
+//! unique_ptr, <tt>pool_delete</tt>, the deleter that returns objects to the pool, and
+//! <tt>make_pooled</tt>, a factory similar to <tt>make_unique</tt>.
+
+namespace boost{
+namespace movelib {
+
+//! Usage counters of an [classref boost::movelib::object_pool object_pool].
+struct object_pool_stats
+{
+   //! Allocations served with a block from the free list
+   std::size_t hits;
+   //! Allocations that needed a new block
+   std::size_t misses;
+   //! Blocks deallocated because the free list was full
+   std::size_t discards;
+};
+
+//!A free list of memory blocks for objects of type T. Objects created with
+//!<tt>make_pooled</tt> and destroyed by <tt>pool_delete</tt> return their block to the pool,
+//!so that the next object reuses it (usually still in cache) without calling the global allocator.
+//!
+//!At most max_retained() free blocks are kept; the rest are deallocated. Blocks are allocated
+//!with <tt>operator new</tt>, so all pools of the same type share a block format.
+//!
+//!An object_pool is not thread-safe. Use one per thread, e.g. thread_instance(). Objects can be
+//!destroyed in a different thread only if their pool is not accessed concurrently.
+//!
+//! \tparam T The type of the objects. Over-aligned types are not supported.
+template<class T>
+class object_pool
+{
+   object_pool(const object_pool &);
+   object_pool & operator=(const object_pool &);
+
+   struct node
+   {  node *next;  };
+
+   public:
+   //! Size of each block
+   static const std::size_t block_size = sizeof(T) < sizeof(node) ? sizeof(node) : sizeof(T);
+
+   //! <b>Effects</b>: Constructs an empty pool that retains at most "max_retained" free blocks.
+   explicit object_pool(std::size_t max_retained = std::size_t(-1))
+      : m_free(), m_free_count(), m_max_retained(max_retained)
+   {  this->clear_stats();  }
+
+   //! <b>Effects</b>: Deallocates all free blocks.
+   //!
+   //! <b>Requires</b>: Objects allocated from the pool were destroyed.
+   ~object_pool()
+   {  this->trim();  }
+
+   //! <b>Returns</b>: A block for a T, from the free list if possible.
+   //!
+   //! <b>Throws</b>: std::bad_alloc if the free list is empty and a block can't be allocated.
+   void *allocate()
+   {
+      if(m_free){
+         node *const n = m_free;
+         m_free = n->next;
+         --m_free_count;
+         ++m_stats.hits;
+         return n;
+      }
+      void *const p = ::operator new(block_size);
+      ++m_stats.misses;
+      return p;
+   }
+
+   //! <b>Effects</b>: Pushes "p" to the free list or deallocates it if max_retained() blocks are already retained.
+   //!
+   //! <b>Requires</b>: "p" was returned by allocate() of a pool of the same type and the object was destroyed.
+   void deallocate(void *p) BOOST_NOEXCEPT
+   {
+      if(m_free_count < m_max_retained){
+         node *const n = ::new(p, boost_move_new_t()) node;
+         n->next = m_free;
+         m_free = n;
+         ++m_free_count;
+      }
+      else{
+         ::operator delete(p);
+         ++m_stats.discards;
+      }
+   }
+
+   //! <b>Effects</b>: Deallocates free blocks until at most "max_blocks" are retained.
+   void trim(std::size_t max_blocks = 0u) BOOST_NOEXCEPT
+   {
+      while(m_free_count > max_blocks){
+         node *const n = m_free;
+         m_free = n->next;
+         --m_free_count;
+         ::operator delete(n);
+      }
+   }
+
+   //! <b>Returns</b>: The number of free blocks.
+   std::size_t free_count() const BOOST_NOEXCEPT
+   {  return m_free_count;  }
+
+   //! <b>Returns</b>: The maximum number of free blocks.
+   std::size_t max_retained() const BOOST_NOEXCEPT
+   {  return m_max_retained;  }
+
+   //! <b>Effects</b>: Sets the maximum number of free blocks and deallocates the excess.
+   void max_retained(std::size_t max_blocks) BOOST_NOEXCEPT
+   {
+      m_max_retained = max_blocks;
+      this->trim(max_blocks);
+   }
+
+   //! <b>Returns</b>: Usage counters since construction or the last call to clear_stats().
+   const object_pool_stats &stats() const BOOST_NOEXCEPT
+   {  return m_stats;  }
+
+   //! <b>Effects</b>: Zeroes usage counters.
+   void clear_stats() BOOST_NOEXCEPT
+   {
+      m_stats.hits = m_stats.misses = m_stats.discards = 0u;
+   }
+
+   #if !defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_MOVE_DOXYGEN_INVOKED)
+   //! <b>Returns</b>: A pool owned by the calling thread, destroyed when the thread exits.
+   //!
+   //! <b>Note</b>: Only available if the compiler supports thread_local.
+   static object_pool &thread_instance()
+   {
+      static thread_local object_pool pool;
+      return pool;
+   }
+   #endif
+
+   private:
+   node *m_free;
+   std::size_t m_free_count;
+   std::size_t m_max_retained;
+   object_pool_stats m_stats;
+};
+
+//!The deleter of the unique_ptrs returned by <tt>make_pooled</tt>: it destroys
+//!the object and returns its memory to an [classref boost::movelib::object_pool object_pool].
+template<class T>
+class pool_delete
+{
+   public:
+   //! <b>Effects</b>: Constructs a deleter that can only delete null pointers.
+   pool_delete() BOOST_NOEXCEPT
+      : m_pool()
+   {}
+
+   //! <b>Effects</b>: Constructs a deleter that returns memory to "pool".
+   explicit pool_delete(object_pool<T> &pool) BOOST_NOEXCEPT
+      : m_pool(&pool)
+   {}
+
+   //! <b>Returns</b>: The pool used by this deleter or null.
+   object_pool<T> *pool() const BOOST_NOEXCEPT
+   {  return m_pool;  }
+
+   //! <b>Effects</b>: Destroys *p and returns its memory to the pool.
+   void operator()(T *p) const BOOST_NOEXCEPT
+   {
+      BOOST_MOVE_STATIC_ASSERT(sizeof(T) > 0);
+      if(p){
+         p->~T();
+         m_pool->deallocate(p);
+      }
+   }
+
+   private:
+   object_pool<T> *m_pool;
+};
+
+// @cond
+namespace detail_object_pool {
+
+template<class T>
+struct pooled_if
+{
+   typedef unique_ptr<T, pool_delete<T> > t_is_not_array;
+};
+
+template<class T>
+struct pooled_if<T[]>
+{};
+
+template<class T, std::size_t N>
+struct pooled_if<T[N]>
+{};
+
+//Returns the block to the pool unless released
+template<class T>
+class block_guard
+{
+   block_guard(const block_guard &);
+   block_guard &operator=(const block_guard &);
+
+   public:
+   block_guard(object_pool<T> &pool, void *p)
+      : m_pool(pool), m_p(p)
+   {}
+
+   ~block_guard()
+   {
+      if(m_p)
+         m_pool.deallocate(m_p);
+   }
+
+   void release()
+   {  m_p = 0;  }
+
+   private:
+   object_pool<T> &m_pool;
+   void *m_p;
+};
+
+}  //namespace detail_object_pool {
+// @endcond
+
+#if defined(BOOST_MOVE_DOXYGEN_INVOKED) || !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is not an array.
+//!
+//! <b>Effects</b>: Obtains a block from "pool" and constructs <tt>T(std::forward<Args>(args)...)</tt> in it.
+//!   If the constructor throws, the block is returned to the pool.
+//!
+//! <b>Returns</b>: <tt>unique_ptr<T, pool_delete<T> >(p, pool_delete<T>(pool))</tt>.
+template<class T, class... Args>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I pool_delete<T> >,
+   typename ::boost::movelib::detail_object_pool::pooled_if<T>::t_is_not_array)
+      make_pooled(object_pool<T> &pool, BOOST_FWD_REF(Args)... args)
+{
+   void *const mem = pool.allocate();
+   detail_object_pool::block_guard<T> guard(pool, mem);
+   T *const p = ::new(mem, boost_move_new_t()) T(::boost::forward<Args>(args)...);
+   guard.release();
+   return unique_ptr<T, pool_delete<T> >(p, pool_delete<T>(pool));
+}
+
+#else
+   #define BOOST_MOVE_MAKE_POOLED_CODE(N)\
+      template<class T BOOST_MOVE_I##N BOOST_MOVE_CLASS##N>\
+      typename ::boost::movelib::detail_object_pool::pooled_if<T>::t_is_not_array\
+         make_pooled(object_pool<T> &pool BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+      {\
+         void *const mem = pool.allocate();\
+         detail_object_pool::block_guard<T> guard(pool, mem);\
+         T *const p = ::new(mem, boost_move_new_t()) T( BOOST_MOVE_FWD##N );\
+         guard.release();\
+         return unique_ptr<T, pool_delete<T> >(p, pool_delete<T>(pool));\
+      }\
+      //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_MOVE_MAKE_POOLED_CODE)
+   #undef BOOST_MOVE_MAKE_POOLED_CODE
+
+#endif
+
+//! <b>Remarks</b>: This function shall not participate in overload resolution unless T is not an array.
+//!
+//! <b>Effects</b>: Same as make_pooled, but the object is default initialized (<tt>::new(p) T</tt>).
+template<class T>
+inline BOOST_MOVE_DOC1ST(unique_ptr<T BOOST_MOVE_I pool_delete<T> >,
+   typename ::boost::movelib::detail_object_pool::pooled_if<T>::t_is_not_array)
+      make_pooled_definit(object_pool<T> &pool)
+{
+   void *const mem = pool.allocate();
+   detail_object_pool::block_guard<T> guard(pool, mem);
+   T *const p = ::new(mem, boost_move_new_t()) T;
+   guard.release();
+   return unique_ptr<T, pool_delete<T> >(p, pool_delete<T>(pool));
+}
+
+}  //namespace movelib {
+}  //namespace boost{
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_MOVE_OBJECT_POOL_HPP_INCLUDED
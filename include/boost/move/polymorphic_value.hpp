@@ -0,0 +1,374 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_POLYMORPHIC_VALUE_HPP_INCLUDED
+#define BOOST_MOVE_POLYMORPHIC_VALUE_HPP_INCLUDED
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <boost/move/detail/inline_storage.hpp>
+#include <boost/move/detail/placement_new.hpp>
+#include <cstddef>   //for std::size_t
+#include <cstring>   //for std::memcpy
+#include <new>       //for operator new
+#ifdef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+#  include <boost/move/detail/fwd_macros.hpp>
+#endif
+
+//!\file
+//! Describes <tt>polymorphic_value</tt>, a copyable and movable owner of an object
+//! derived from a base class that stores small objects inline.
+
+namespace boost{
+namespace movelib {
+
+// @cond
+namespace detail_polymorphic_value {
+
+//Per-type operations, a manual vtable
+template<class Base>
+struct ops
+{
+   //The object is stored in the inline buffer
+   bool inline_storage;
+   //Copies the object stored in "src_buf" to "dst_buf"
+   Base *(*copy)(const void *src_buf, void *dst_buf);
+   //Moves the object stored in "src_buf" to "dst_buf" and destroys the source.
+   //Null if copying the buffer bytes is enough.
+   void (*relocate)(void *src_buf, void *dst_buf);
+   //Destroys the object stored in "buf"
+   void (*destroy)(void *buf);
+};
+
+template<class Base, class D, bool Inline>
+struct ops_impl;
+
+template<class Base, class D>
+struct ops_impl<Base, D, true>
+{
+   static Base *copy(const void *src_buf, void *dst_buf)
+   {  return ::new(dst_buf, boost_move_new_t()) D(*static_cast<const D*>(src_buf));  }
+
+   static void relocate(void *src_buf, void *dst_buf)
+   {
+      D *const src = static_cast<D*>(src_buf);
+      ::new(dst_buf, boost_move_new_t()) D(::boost::move(*src));
+      src->~D();
+   }
+
+   static void destroy(void *buf)
+   {  static_cast<D*>(buf)->~D();  }
+
+   static const ops<Base> table;
+};
+
+template<class Base, class D>
+const ops<Base> ops_impl<Base, D, true>::table =
+   { true, &ops_impl<Base, D, true>::copy
+   , ::boost::move_detail::is_bitwise_relocatable<D>::value ? 0 : &ops_impl<Base, D, true>::relocate
+   , &ops_impl<Base, D, true>::destroy };
+
+//Heap objects: the buffer stores a pointer to the object
+template<class Base, class D>
+struct ops_impl<Base, D, false>
+{
+   static D *object(const void *buf)
+   {  return static_cast<D*>(*static_cast<void* const*>(buf));  }
+
+   static Base *copy(const void *src_buf, void *dst_buf)
+   {
+      void *const mem = ::operator new(sizeof(D));
+      ::boost::move_detail::heap_guard guard(mem);
+      D *const p = ::new(mem, boost_move_new_t()) D(*object(src_buf));
+      guard.release();
+      *static_cast<void**>(dst_buf) = p;
+      return p;
+   }
+
+   static void destroy(void *buf)
+   {
+      D *const p = object(buf);
+      p->~D();
+      ::operator delete(p);
+   }
+
+   static const ops<Base> table;
+};
+
+template<class Base, class D>
+const ops<Base> ops_impl<Base, D, false>::table =
+   { false, &ops_impl<Base, D, false>::copy, 0, &ops_impl<Base, D, false>::destroy };
+
+}  //namespace detail_polymorphic_value {
+// @endcond
+
+//!A value-semantic owner of an object of a class derived from (or equal to) Base.
+//!Copying a polymorphic_value copies the owned object using the copy constructor of its
+//!dynamic type, so, unlike the classic clone_ptr, Base needs no virtual clone function.
+//!
+//!Objects of up to "InlineBytes" bytes whose move constructor does not throw
+//!(is_nothrow_move_constructible or boost::has_nothrow_move, which can be specialized in C++03)
+//!are stored inline, without heap allocation. Bigger objects are allocated with operator new.
+//!Moving never throws: heap objects are transferred by pointer and trivially copyable inline
+//!objects by copying the buffer, without calling any function of the dynamic type.
+//!
+//! \tparam Base The base class of the stored objects. It needs no virtual destructor.
+//! \tparam InlineBytes Size of the inline buffer.
+template<class Base, std::size_t InlineBytes = 3u*sizeof(void*)>
+class polymorphic_value
+{
+   #if defined(BOOST_MOVE_DOXYGEN_INVOKED)
+   public:
+   polymorphic_value(const polymorphic_value&);
+   polymorphic_value& operator=(const polymorphic_value&);
+   private:
+   #else
+   BOOST_COPYABLE_AND_MOVABLE(polymorphic_value)
+   #endif
+
+   typedef detail_polymorphic_value::ops<Base> ops_t;
+   static const std::size_t buffer_size = InlineBytes < sizeof(void*) ? sizeof(void*) : InlineBytes;
+   typedef typename ::boost::move_detail::aligned_storage<buffer_size>::type storage_t;
+   static const std::size_t buffer_alignment = ::boost::move_detail::alignment_of<storage_t>::value;
+
+   public:
+   typedef Base element_type;
+
+   //! <b>Effects</b>: Constructs an empty object.
+   polymorphic_value() BOOST_NOEXCEPT
+      : m_ops(), m_ptr()
+   {}
+
+   //! <b>Effects</b>: Stores a copy of "d".
+   //!
+   //! <b>Remarks</b>: This constructor shall not participate in overload resolution unless D* is convertible to Base*.
+   template<class D>
+   explicit polymorphic_value(const D &d
+      BOOST_MOVE_DOCIGN(BOOST_MOVE_I typename ::boost::move_detail::enable_if_c< ::boost::move_detail::is_convertible<D* BOOST_MOVE_I Base*>::value >::type* = 0))
+      : m_ops(), m_ptr()
+   {  this->emplace<D>(d);  }
+
+   //! <b>Effects</b>: Copies the object owned by "x" using the copy constructor of its dynamic type.
+   polymorphic_value(const polymorphic_value &x)
+      : m_ops(x.m_ops), m_ptr(x.m_ops ? x.m_ops->copy(&x.m_buf, &m_buf) : 0)
+   {}
+
+   //! <b>Effects</b>: Takes the object owned by "x", leaving it empty.
+   //!
+   //! <b>Throws</b>: Nothing.
+   polymorphic_value(BOOST_RV_REF(polymorphic_value) x) BOOST_NOEXCEPT
+      : m_ops(), m_ptr()
+   {  this->steal(x);  }
+
+   //! <b>Effects</b>: Destroys the owned object.
+   ~polymorphic_value()
+   {  this->reset();  }
+
+   //! <b>Effects</b>: Copies the object owned by "x". Strong exception guarantee.
+   polymorphic_value& operator=(BOOST_COPY_ASSIGN_REF(polymorphic_value) x)
+   {
+      if(this != &x){
+         polymorphic_value tmp(x);
+         this->reset();
+         this->steal(tmp);
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Destroys the owned object and takes the object owned by "x", leaving it empty.
+   polymorphic_value& operator=(BOOST_RV_REF(polymorphic_value) x) BOOST_NOEXCEPT
+   {
+      if(this != &x){
+         this->reset();
+         this->steal(x);
+      }
+      return *this;
+   }
+
+   #if defined(BOOST_MOVE_DOXYGEN_INVOKED) || !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //! <b>Effects</b>: Destroys the owned object and stores <tt>D(std::forward<Args>(args)...)</tt>,
+   //!   inline if it fits. If the constructor throws, *this is empty.
+   //!
+   //! <b>Returns</b>: A reference to the new object.
+   template<class D, class... Args>
+   D &emplace(BOOST_FWD_REF(Args)... args)
+   {
+      void *const mem = this->template begin_emplace<D>();
+      ::boost::move_detail::heap_guard guard(is_inline_type<D>() ? 0 : mem);
+      D *const p = ::new(mem, boost_move_new_t()) D(::boost::forward<Args>(args)...);
+      guard.release();
+      return this->end_emplace(p);
+   }
+
+   #else
+
+   #define BOOST_MOVE_POLYMORPHIC_VALUE_EMPLACE_CODE(N)\
+   template<class D BOOST_MOVE_I##N BOOST_MOVE_CLASS##N>\
+   D &emplace(BOOST_MOVE_UREF##N)\
+   {\
+      void *const mem = this->template begin_emplace<D>();\
+      ::boost::move_detail::heap_guard guard(is_inline_type<D>() ? 0 : mem);\
+      D *const p = ::new(mem, boost_move_new_t()) D( BOOST_MOVE_FWD##N );\
+      guard.release();\
+      return this->end_emplace(p);\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_MOVE_POLYMORPHIC_VALUE_EMPLACE_CODE)
+   #undef BOOST_MOVE_POLYMORPHIC_VALUE_EMPLACE_CODE
+
+   #endif
+
+   //! <b>Effects</b>: Destroys the owned object.
+   //!
+   //! <b>Postcondition</b>: !has_value().
+   void reset() BOOST_NOEXCEPT
+   {
+      if(m_ops){
+         m_ops->destroy(&m_buf);
+         m_ops = 0;
+         m_ptr = 0;
+      }
+   }
+
+   //! <b>Returns</b>: A pointer to the owned object or null.
+   Base *get() const BOOST_NOEXCEPT
+   {  return m_ptr;  }
+
+   //! <b>Requires</b>: has_value().
+   Base &operator*() const BOOST_NOEXCEPT
+   {  return *m_ptr;  }
+
+   //! <b>Requires</b>: has_value().
+   Base *operator->() const BOOST_NOEXCEPT
+   {  return m_ptr;  }
+
+   //! <b>Returns</b>: True if an object is owned.
+   bool has_value() const BOOST_NOEXCEPT
+   {  return m_ptr != 0;  }
+
+   //! <b>Returns</b>: True if the owned object is stored inline.
+   bool is_inline() const BOOST_NOEXCEPT
+   {  return m_ops && m_ops->inline_storage;  }
+
+   //! <b>Returns</b>: True if objects of type D are stored inline.
+   template<class D>
+   static bool is_inline_type() BOOST_NOEXCEPT
+   {  return ::boost::move_detail::fits_inline<D, buffer_size, buffer_alignment>::value;  }
+
+   //! <b>Effects</b>: Exchanges the owned objects.
+   //!
+   //! <b>Throws</b>: Nothing.
+   void swap(polymorphic_value &x) BOOST_NOEXCEPT
+   {
+      polymorphic_value tmp(::boost::move(x));
+      x.steal(*this);
+      this->steal(tmp);
+   }
+
+   //! <b>Effects</b>: l.swap(r).
+   friend void swap(polymorphic_value &l, polymorphic_value &r) BOOST_NOEXCEPT
+   {  l.swap(r);  }
+
+   private:
+   template<class D>
+   void *begin_emplace()
+   {
+      BOOST_MOVE_STATIC_ASSERT(( ::boost::move_detail::is_convertible<D*, Base*>::value ));
+      this->reset();
+      return is_inline_type<D>() ? static_cast<void*>(&m_buf) : ::operator new(sizeof(D));
+   }
+
+   template<class D>
+   D &end_emplace(D *p) BOOST_NOEXCEPT
+   {
+      const bool inl = ::boost::move_detail::fits_inline<D, buffer_size, buffer_alignment>::value;
+      if(!inl){
+         *static_cast<void**>(static_cast<void*>(&m_buf)) = p;
+      }
+      m_ops = &detail_polymorphic_value::ops_impl<Base, D, inl>::table;
+      m_ptr = p;
+      return *p;
+   }
+
+   //Precondition: *this is empty
+   void steal(polymorphic_value &x) BOOST_NOEXCEPT
+   {
+      if(x.m_ops){
+         if(x.m_ops->relocate){
+            x.m_ops->relocate(&x.m_buf, &m_buf);
+         }
+         else{
+            std::memcpy(static_cast<void*>(&m_buf), static_cast<const void*>(&x.m_buf), sizeof(m_buf));
+         }
+         if(x.m_ops->inline_storage){
+            //Base subobject is at the same offset in the new buffer
+            std::size_t const off = std::size_t(reinterpret_cast<char*>(x.m_ptr) - reinterpret_cast<char*>(&x.m_buf));
+            m_ptr = reinterpret_cast<Base*>(reinterpret_cast<char*>(&m_buf) + off);
+         }
+         else{
+            m_ptr = x.m_ptr;
+         }
+         m_ops = x.m_ops;
+         x.m_ops = 0;
+         x.m_ptr = 0;
+      }
+   }
+
+   const ops_t *m_ops;
+   Base *m_ptr;
+   storage_t m_buf;
+};
+
+#if defined(BOOST_MOVE_DOXYGEN_INVOKED) || !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+//! <b>Returns</b>: A polymorphic_value<Base> owning <tt>D(std::forward<Args>(args)...)</tt>.
+template<class Base, class D, class... Args>
+inline polymorphic_value<Base> make_polymorphic_value(BOOST_FWD_REF(Args)... args)
+{
+   polymorphic_value<Base> v;
+   v.template emplace<D>(::boost::forward<Args>(args)...);
+   return v;
+}
+
+#else
+
+#define BOOST_MOVE_MAKE_POLYMORPHIC_VALUE_CODE(N)\
+template<class Base, class D BOOST_MOVE_I##N BOOST_MOVE_CLASS##N>\
+inline polymorphic_value<Base> make_polymorphic_value(BOOST_MOVE_UREF##N)\
+{\
+   polymorphic_value<Base> v;\
+   v.template emplace<D>( BOOST_MOVE_FWD##N );\
+   return ::boost::move(v);\
+}\
+//
+BOOST_MOVE_ITERATE_0TO9(BOOST_MOVE_MAKE_POLYMORPHIC_VALUE_CODE)
+#undef BOOST_MOVE_MAKE_POLYMORPHIC_VALUE_CODE
+
+#endif
+
+}  //namespace movelib {
+}  //namespace boost{
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_MOVE_POLYMORPHIC_VALUE_HPP_INCLUDED
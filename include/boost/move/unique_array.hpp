@@ -0,0 +1,305 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_UNIQUE_ARRAY_HPP_INCLUDED
+#define BOOST_MOVE_UNIQUE_ARRAY_HPP_INCLUDED
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/detail/placement_new.hpp>
+#include <boost/move/detail/destruct_n.hpp>
+#include <boost/move/detail/throw_bad_alloc.hpp>
+#include <cstddef>   //for std::size_t
+#include <cassert>
+#include <new>       //for std::nothrow
+
+//!\file
+//! Describes <tt>unique_array</tt>, a move-only owner of a dynamically allocated array
+//! that knows its length, and the factories that create it.
+
+namespace boost{
+namespace movelib {
+
+//!A move-only owner of an array of T allocated with <tt>operator new</tt> that, unlike
+//!<tt>unique_ptr<T[]></tt>, knows its length.
+//!
+//!The storage can hold capacity() elements, but only the first size() elements are constructed.
+//!The remaining raw storage (spare_data(), spare_capacity()) can be used as the external
+//!buffer of buffered algorithms: unique_arrays created by <tt>make_unique_array_uninit</tt>
+//!can be directly passed as the scratch buffer of <tt>adaptive_sort</tt> and <tt>adaptive_merge</tt>.
+//!
+//! \tparam T The element type. It can't be an array.
+template<class T>
+class unique_array
+{
+   #if defined(BOOST_MOVE_DOXYGEN_INVOKED)
+   public:
+   unique_array(const unique_array&) = delete;
+   unique_array& operator=(const unique_array&) = delete;
+   private:
+   #else
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(unique_array)
+   #endif
+
+   public:
+   typedef T               value_type;
+   typedef T&              reference;
+   typedef const T&        const_reference;
+   typedef T*              pointer;
+   typedef const T*        const_pointer;
+   typedef T*              iterator;
+   typedef const T*        const_iterator;
+   typedef std::size_t     size_type;
+   typedef std::ptrdiff_t  difference_type;
+
+   //! <b>Effects</b>: Constructs an object that owns nothing.
+   //!
+   //! <b>Postcondition</b>: data() == 0, size() == 0 and capacity() == 0.
+   unique_array() BOOST_NOEXCEPT
+      : m_ptr(), m_size(), m_capacity()
+   {}
+
+   //! <b>Requires</b>: "p" was returned by <tt>operator new(capacity*sizeof(T))</tt>
+   //!   (or is null if "capacity" is zero) and holds "size" constructed elements.
+   //!
+   //! <b>Effects</b>: Takes ownership of the storage and the elements.
+   unique_array(T *p, size_type size, size_type capacity) BOOST_NOEXCEPT
+      : m_ptr(p), m_size(size), m_capacity(capacity)
+   {  assert(size <= capacity);  }
+
+   //! <b>Effects</b>: Transfers ownership from "other", leaving it empty.
+   unique_array(BOOST_RV_REF(unique_array) other) BOOST_NOEXCEPT
+      : m_ptr(other.m_ptr), m_size(other.m_size), m_capacity(other.m_capacity)
+   {
+      other.m_ptr = 0;
+      other.m_size = other.m_capacity = 0u;
+   }
+
+   //! <b>Effects</b>: Destroys the elements and deallocates the storage.
+   ~unique_array()
+   {  this->destroy_and_deallocate();  }
+
+   //! <b>Effects</b>: Destroys the owned elements and transfers ownership from "other", leaving it empty.
+   unique_array& operator=(BOOST_RV_REF(unique_array) other) BOOST_NOEXCEPT
+   {
+      if(this != &other){
+         this->destroy_and_deallocate();
+         m_ptr = other.m_ptr;
+         m_size = other.m_size;
+         m_capacity = other.m_capacity;
+         other.m_ptr = 0;
+         other.m_size = other.m_capacity = 0u;
+      }
+      return *this;
+   }
+
+   //! <b>Returns</b>: The storage, null if nothing is owned.
+   T *data() const BOOST_NOEXCEPT
+   {  return m_ptr;  }
+
+   //! <b>Returns</b>: The number of constructed elements.
+   size_type size() const BOOST_NOEXCEPT
+   {  return m_size;  }
+
+   //! <b>Returns</b>: The number of elements the storage can hold.
+   size_type capacity() const BOOST_NOEXCEPT
+   {  return m_capacity;  }
+
+   //! <b>Returns</b>: size() == 0.
+   bool empty() const BOOST_NOEXCEPT
+   {  return !m_size;  }
+
+   //! <b>Returns</b>: Raw storage after the constructed elements.
+   T *spare_data() const BOOST_NOEXCEPT
+   {  return m_ptr + m_size;  }
+
+   //! <b>Returns</b>: capacity() - size().
+   size_type spare_capacity() const BOOST_NOEXCEPT
+   {  return m_capacity - m_size;  }
+
+   //! <b>Requires</b>: i < size().
+   T &operator[](size_type i) const BOOST_NOEXCEPT
+   {
+      assert(i < m_size);
+      return m_ptr[i];
+   }
+
+   iterator begin() BOOST_NOEXCEPT
+   {  return m_ptr;  }
+
+   const_iterator begin() const BOOST_NOEXCEPT
+   {  return m_ptr;  }
+
+   iterator end() BOOST_NOEXCEPT
+   {  return m_ptr + m_size;  }
+
+   const_iterator end() const BOOST_NOEXCEPT
+   {  return m_ptr + m_size;  }
+
+   //! <b>Effects</b>: Destroys the elements in reverse order. The storage is kept,
+   //!   so it can be reused as a scratch buffer.
+   //!
+   //! <b>Postcondition</b>: size() == 0.
+   void clear() BOOST_NOEXCEPT
+   {
+      while(m_size){
+         m_ptr[--m_size].~T();
+      }
+   }
+
+   //! <b>Effects</b>: Destroys the elements and deallocates the storage.
+   //!
+   //! <b>Postcondition</b>: data() == 0, size() == 0 and capacity() == 0.
+   void reset() BOOST_NOEXCEPT
+   {
+      this->destroy_and_deallocate();
+      m_ptr = 0;
+      m_capacity = 0u;
+   }
+
+   //! <b>Effects</b>: Releases ownership of the storage and the elements.
+   //!   The caller must destroy size() elements and deallocate the storage with <tt>operator delete</tt>.
+   //!
+   //! <b>Returns</b>: data() before the call.
+   T *release() BOOST_NOEXCEPT
+   {
+      T *const p = m_ptr;
+      m_ptr = 0;
+      m_size = m_capacity = 0u;
+      return p;
+   }
+
+   //! <b>Effects</b>: Exchanges the contents of *this and "other".
+   void swap(unique_array &other) BOOST_NOEXCEPT
+   {
+      ::boost::adl_move_swap(m_ptr, other.m_ptr);
+      ::boost::adl_move_swap(m_size, other.m_size);
+      ::boost::adl_move_swap(m_capacity, other.m_capacity);
+   }
+
+   //! <b>Effects</b>: l.swap(r).
+   friend void swap(unique_array &l, unique_array &r) BOOST_NOEXCEPT
+   {  l.swap(r);  }
+
+   private:
+   void destroy_and_deallocate() BOOST_NOEXCEPT
+   {
+      this->clear();
+      ::operator delete(m_ptr);
+   }
+
+   T *m_ptr;
+   size_type m_size;
+   size_type m_capacity;
+};
+
+// @cond
+namespace detail_unique_array {
+
+template<class T>
+T *allocate(std::size_t n, bool nothrow)
+{
+   if(!n)
+      return 0;
+   if(n > std::size_t(-1)/sizeof(T)){
+      if(nothrow)
+         return 0;
+      ::boost::move_detail::throw_bad_alloc();
+   }
+   return static_cast<T*>(nothrow ? ::operator new(n*sizeof(T), std::nothrow) : ::operator new(n*sizeof(T)));
+}
+
+template<class T, bool ValueInit>
+unique_array<T> make(std::size_t n, bool nothrow)
+{
+   T *const p = allocate<T>(n, nothrow);
+   if(!p){
+      return unique_array<T>();
+   }
+   unique_array<T> ret(p, 0u, n);
+   ::boost::movelib::destruct_n<T, T*> destroyer(p);
+   for(std::size_t i = 0; i != n; ++i){
+      if(ValueInit)
+         ::new((void*)(p + i), boost_move_new_t()) T();
+      else
+         ::new((void*)(p + i), boost_move_new_t()) T;
+      destroyer.incr();
+   }
+   destroyer.release();
+   return unique_array<T>(ret.release(), n, n);
+}
+
+}  //namespace detail_unique_array {
+// @endcond
+
+//! <b>Returns</b>: A unique_array owning "n" value initialized elements.
+//!
+//! <b>Throws</b>: std::bad_alloc or any exception thrown by the constructor of T.
+template<class T>
+inline unique_array<T> make_unique_array(std::size_t n)
+{  return detail_unique_array::make<T, true>(n, false);  }
+
+//! <b>Returns</b>: A unique_array owning "n" default initialized elements.
+//!
+//! <b>Throws</b>: std::bad_alloc or any exception thrown by the constructor of T.
+template<class T>
+inline unique_array<T> make_unique_array_definit(std::size_t n)
+{  return detail_unique_array::make<T, false>(n, false);  }
+
+//! <b>Returns</b>: A unique_array owning "n" value initialized elements
+//!   or an empty unique_array if memory can't be allocated.
+//!
+//! <b>Throws</b>: Any exception thrown by the constructor of T.
+template<class T>
+inline unique_array<T> make_unique_array_nothrow(std::size_t n)
+{  return detail_unique_array::make<T, true>(n, true);  }
+
+//! <b>Returns</b>: A unique_array owning "n" default initialized elements
+//!   or an empty unique_array if memory can't be allocated.
+//!
+//! <b>Throws</b>: Any exception thrown by the constructor of T.
+template<class T>
+inline unique_array<T> make_unique_array_nothrow_definit(std::size_t n)
+{  return detail_unique_array::make<T, false>(n, true);  }
+
+//! <b>Returns</b>: A unique_array with storage for "n" elements and no constructed elements
+//!   (size() == 0, capacity() == n), e.g. to be used as a scratch buffer.
+//!
+//! <b>Throws</b>: std::bad_alloc.
+template<class T>
+inline unique_array<T> make_unique_array_uninit(std::size_t n)
+{  return unique_array<T>(detail_unique_array::allocate<T>(n, false), 0u, n);  }
+
+//! <b>Returns</b>: A unique_array with storage for "n" elements and no constructed elements
+//!   or an empty unique_array if memory can't be allocated.
+template<class T>
+inline unique_array<T> make_unique_array_nothrow_uninit(std::size_t n)
+{
+   T *const p = detail_unique_array::allocate<T>(n, true);
+   return unique_array<T>(p, 0u, p ? n : 0u);
+}
+
+}  //namespace movelib {
+}  //namespace boost{
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_MOVE_UNIQUE_ARRAY_HPP_INCLUDED
@@ -0,0 +1,483 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_UNIQUE_FUNCTION_HPP_INCLUDED
+#define BOOST_MOVE_UNIQUE_FUNCTION_HPP_INCLUDED
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+#
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/move/detail/config_begin.hpp>
+#include <boost/move/detail/workaround.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/default_delete.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/move/detail/type_traits.hpp>
+#include <boost/move/detail/placement_new.hpp>
+#include <boost/move/detail/inline_storage.hpp>
+#include <cstddef>   //for std::size_t
+#include <cstring>   //for std::memcpy
+#include <cassert>
+#include <new>       //for operator new
+#ifdef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+#  include <boost/move/detail/fwd_macros.hpp>
+#endif
+
+//!\file
+//! Describes <tt>unique_function</tt>, a move-only polymorphic function wrapper
+//! that can hold move-only callables and stores small ones inline.
+
+namespace boost{
+namespace movelib {
+
+// @cond
+namespace detail_unique_function {
+
+//Signature-independent operations of a stored callable
+struct manager_ops
+{
+   //Moves the callable stored in "src_buf" to "dst_buf" and destroys the source.
+   //Null if copying the buffer bytes is enough.
+   void (*relocate)(void *src_buf, void *dst_buf);
+   //Destroys the callable stored in "buf". Null if there is nothing to do.
+   void (*destroy)(void *buf);
+   //The callable is stored in the inline buffer
+   bool inline_storage;
+};
+
+template<class F, bool Inline>
+struct manager;
+
+template<class F>
+struct manager<F, true>
+{
+   static F &object(void *buf) BOOST_NOEXCEPT
+   {  return *static_cast<F*>(buf);  }
+
+   template<class G>
+   static void construct(void *buf, BOOST_FWD_REF(G) g)
+   {  ::new(buf, boost_move_new_t()) F(::boost::forward<G>(g));  }
+
+   static void relocate(void *src_buf, void *dst_buf)
+   {
+      F *const src = static_cast<F*>(src_buf);
+      ::new(dst_buf, boost_move_new_t()) F(::boost::move(*src));
+      src->~F();
+   }
+
+   static void destroy(void *buf)
+   {  static_cast<F*>(buf)->~F();  }
+
+   static const manager_ops table;
+};
+
+template<class F>
+const manager_ops manager<F, true>::table =
+   { ::boost::move_detail::is_bitwise_relocatable<F>::value ? 0 : &manager<F, true>::relocate
+   , ::boost::move_detail::is_trivially_destructible<F>::value ? 0 : &manager<F, true>::destroy
+   , true };
+
+//Heap callables: the buffer stores a pointer to the callable
+template<class F>
+struct manager<F, false>
+{
+   static F &object(void *buf) BOOST_NOEXCEPT
+   {  return **static_cast<F**>(buf);  }
+
+   template<class G>
+   static void construct(void *buf, BOOST_FWD_REF(G) g)
+   {
+      void *const mem = ::operator new(sizeof(F));
+      ::boost::move_detail::heap_guard guard(mem);
+      F *const p = ::new(mem, boost_move_new_t()) F(::boost::forward<G>(g));
+      guard.release();
+      *static_cast<F**>(buf) = p;
+   }
+
+   static void destroy(void *buf)
+   {
+      F *const p = &object(buf);
+      p->~F();
+      ::operator delete(p);
+   }
+
+   static const manager_ops table;
+};
+
+template<class F>
+const manager_ops manager<F, false>::table = { 0, &manager<F, false>::destroy, false };
+
+//The type stored for an argument of type F: references, cv-qualifiers and
+//the C++03 rvalue wrapper are removed, and functions decay to pointers
+template<class F>
+struct callable_type
+{
+   typedef typename ::boost::move_detail::remove_cvref
+      <typename ::boost::move_detail::remove_rvalue_reference<F>::type>::type plain_t;
+   typedef typename ::boost::move_detail::if_c
+      < ::boost::move_detail::is_function<plain_t>::value, plain_t*, plain_t>::type type;
+};
+
+//Inline buffer and the operations of the stored callable
+template<std::size_t InlineBytes>
+class function_storage
+{
+   function_storage(const function_storage &);
+   function_storage &operator=(const function_storage &);
+
+   static const std::size_t buffer_size = InlineBytes < sizeof(void*) ? sizeof(void*) : InlineBytes;
+   typedef typename ::boost::move_detail::aligned_storage<buffer_size>::type storage_t;
+
+   public:
+   static const std::size_t buffer_alignment = ::boost::move_detail::alignment_of<storage_t>::value;
+
+   template<class F>
+   struct fits
+      : ::boost::move_detail::fits_inline<F, buffer_size, buffer_alignment>
+   {};
+
+   template<class F>
+   struct manager_for
+   {
+      typedef manager<F, fits<F>::value> type;
+   };
+
+   function_storage() BOOST_NOEXCEPT
+      : m_ops()
+   {}
+
+   //Precondition: no callable is stored
+   template<class F, class G>
+   void construct(BOOST_FWD_REF(G) g)
+   {
+      typedef typename manager_for<F>::type manager_t;
+      manager_t::construct(&m_buf, ::boost::forward<G>(g));
+      m_ops = &manager_t::table;
+   }
+
+   void destroy() BOOST_NOEXCEPT
+   {
+      if(m_ops){
+         if(m_ops->destroy)
+            m_ops->destroy(&m_buf);
+         m_ops = 0;
+      }
+   }
+
+   //Precondition: no callable is stored
+   void steal(function_storage &x) BOOST_NOEXCEPT
+   {
+      if(x.m_ops){
+         if(x.m_ops->relocate){
+            x.m_ops->relocate(&x.m_buf, &m_buf);
+         }
+         else{
+            std::memcpy(static_cast<void*>(&m_buf), static_cast<const void*>(&x.m_buf), sizeof(m_buf));
+         }
+         m_ops = x.m_ops;
+         x.m_ops = 0;
+      }
+   }
+
+   void *buffer() BOOST_NOEXCEPT
+   {  return &m_buf;  }
+
+   bool is_inline() const BOOST_NOEXCEPT
+   {  return m_ops && m_ops->inline_storage;  }
+
+   private:
+   const manager_ops *m_ops;
+   storage_t m_buf;
+};
+
+//Call operator and invoker of each signature
+template<class Sig, std::size_t InlineBytes>
+class function_base;
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+template<class R, class... Args, std::size_t InlineBytes>
+class function_base<R(Args...), InlineBytes>
+{
+   public:
+   typedef R result_type;
+
+   R operator()(Args... args)
+   {
+      assert(m_invoke);
+      return m_invoke(m_storage.buffer(), ::boost::forward<Args>(args)...);
+   }
+
+   protected:
+   typedef R (*invoke_t)(void *, Args&&...);
+
+   function_base() BOOST_NOEXCEPT
+      : m_invoke(), m_storage()
+   {}
+
+   template<class Manager>
+   static R invoke(void *buf, Args&&... args)
+   {  return static_cast<R>(Manager::object(buf)(::boost::forward<Args>(args)...));  }
+
+   invoke_t m_invoke;
+   function_storage<InlineBytes> m_storage;
+};
+
+#else
+
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM0
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM1 P0 p0
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM2 BOOST_MOVE_UNIQUE_FUNCTION_PARAM1, P1 p1
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM3 BOOST_MOVE_UNIQUE_FUNCTION_PARAM2, P2 p2
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM4 BOOST_MOVE_UNIQUE_FUNCTION_PARAM3, P3 p3
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM5 BOOST_MOVE_UNIQUE_FUNCTION_PARAM4, P4 p4
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM6 BOOST_MOVE_UNIQUE_FUNCTION_PARAM5, P5 p5
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM7 BOOST_MOVE_UNIQUE_FUNCTION_PARAM6, P6 p6
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM8 BOOST_MOVE_UNIQUE_FUNCTION_PARAM7, P7 p7
+#define BOOST_MOVE_UNIQUE_FUNCTION_PARAM9 BOOST_MOVE_UNIQUE_FUNCTION_PARAM8, P8 p8
+
+//Arguments are received by value or reference, as declared in the signature,
+//so by-value arguments can be moved to the next call
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD0
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD1 ::boost::move_if_not_lvalue_reference<P0>(p0)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD2 BOOST_MOVE_UNIQUE_FUNCTION_FWD1, ::boost::move_if_not_lvalue_reference<P1>(p1)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD3 BOOST_MOVE_UNIQUE_FUNCTION_FWD2, ::boost::move_if_not_lvalue_reference<P2>(p2)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD4 BOOST_MOVE_UNIQUE_FUNCTION_FWD3, ::boost::move_if_not_lvalue_reference<P3>(p3)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD5 BOOST_MOVE_UNIQUE_FUNCTION_FWD4, ::boost::move_if_not_lvalue_reference<P4>(p4)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD6 BOOST_MOVE_UNIQUE_FUNCTION_FWD5, ::boost::move_if_not_lvalue_reference<P5>(p5)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD7 BOOST_MOVE_UNIQUE_FUNCTION_FWD6, ::boost::move_if_not_lvalue_reference<P6>(p6)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD8 BOOST_MOVE_UNIQUE_FUNCTION_FWD7, ::boost::move_if_not_lvalue_reference<P7>(p7)
+#define BOOST_MOVE_UNIQUE_FUNCTION_FWD9 BOOST_MOVE_UNIQUE_FUNCTION_FWD8, ::boost::move_if_not_lvalue_reference<P8>(p8)
+
+#define BOOST_MOVE_UNIQUE_FUNCTION_BASE_CODE(N)\
+template<class R BOOST_MOVE_I##N BOOST_MOVE_CLASS##N, std::size_t InlineBytes>\
+class function_base<R(BOOST_MOVE_TARG##N), InlineBytes>\
+{\
+   public:\
+   typedef R result_type;\
+   \
+   R operator()(BOOST_MOVE_UNIQUE_FUNCTION_PARAM##N)\
+   {\
+      assert(m_invoke);\
+      return m_invoke(m_storage.buffer() BOOST_MOVE_I##N BOOST_MOVE_UNIQUE_FUNCTION_FWD##N);\
+   }\
+   \
+   protected:\
+   typedef R (*invoke_t)(void * BOOST_MOVE_I##N BOOST_MOVE_TARG##N);\
+   \
+   function_base() BOOST_NOEXCEPT\
+      : m_invoke(), m_storage()\
+   {}\
+   \
+   template<class Manager>\
+   static R invoke(void *buf BOOST_MOVE_I##N BOOST_MOVE_UNIQUE_FUNCTION_PARAM##N)\
+   {  return static_cast<R>(Manager::object(buf)(BOOST_MOVE_UNIQUE_FUNCTION_FWD##N));  }\
+   \
+   invoke_t m_invoke;\
+   function_storage<InlineBytes> m_storage;\
+};\
+//
+BOOST_MOVE_ITERATE_0TO9(BOOST_MOVE_UNIQUE_FUNCTION_BASE_CODE)
+#undef BOOST_MOVE_UNIQUE_FUNCTION_BASE_CODE
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM0
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM1
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM2
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM3
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM4
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM5
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM6
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM7
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM8
+#undef BOOST_MOVE_UNIQUE_FUNCTION_PARAM9
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD0
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD1
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD2
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD3
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD4
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD5
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD6
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD7
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD8
+#undef BOOST_MOVE_UNIQUE_FUNCTION_FWD9
+
+#endif   //#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+}  //namespace detail_unique_function {
+// @endcond
+
+//!A move-only polymorphic function wrapper. Unlike <tt>std::function</tt>, it can store move-only
+//!callables (e.g. objects owning a unique_ptr or a file descriptor) and it never copies them.
+//!
+//!Sig is a function type <tt>R(Args...)</tt> with up to 9 arguments in compilers without variadic templates.
+//!<tt>R operator()(Args... args)</tt> calls the stored callable forwarding the arguments.
+//!Calling an empty unique_function is undefined.
+//!
+//!Callables of up to "InlineBytes" bytes whose move constructor does not throw
+//!(is_nothrow_move_constructible or boost::has_nothrow_move, which can be specialized in C++03)
+//!are stored inline, without heap allocation. Bigger callables are allocated with operator new.
+//!Moving never throws: heap callables are transferred by pointer and trivially copyable inline
+//!callables (function pointers, lambdas capturing pointers or integers...) by copying the buffer.
+//!
+//! \tparam Sig The call signature.
+//! \tparam InlineBytes Size of the inline buffer.
+template<class Sig, std::size_t InlineBytes = 3u*sizeof(void*)>
+class unique_function
+   : public detail_unique_function::function_base<Sig, InlineBytes>
+{
+   #if defined(BOOST_MOVE_DOXYGEN_INVOKED)
+   public:
+   unique_function(const unique_function&) = delete;
+   unique_function& operator=(const unique_function&) = delete;
+   private:
+   #else
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(unique_function)
+   #endif
+
+   typedef detail_unique_function::function_base<Sig, InlineBytes> base_t;
+
+   template<class F>
+   struct enable_callable
+      : ::boost::move_detail::enable_if_c
+         < !::boost::move_detail::is_same
+            <typename detail_unique_function::callable_type<F>::type, unique_function>::value >
+   {};
+
+   public:
+   //! <b>Effects</b>: Constructs an empty object.
+   unique_function() BOOST_NOEXCEPT
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Stores a callable move or copy constructed from "f".
+   //!   Functions are stored as function pointers.
+   //!
+   //! <b>Throws</b>: std::bad_alloc if the callable is not stored inline
+   //!   or any exception thrown by its constructor.
+   template<class F>
+   unique_function(BOOST_FWD_REF(F) f
+      BOOST_MOVE_DOCIGN(BOOST_MOVE_I typename enable_callable<F>::type* = 0))
+      : base_t()
+   {  this->assign(::boost::forward<F>(f));  }
+
+   //! <b>Effects</b>: Takes the callable stored in "x", leaving it empty.
+   //!
+   //! <b>Throws</b>: Nothing.
+   unique_function(BOOST_RV_REF(unique_function) x) BOOST_NOEXCEPT
+      : base_t()
+   {  this->steal(x);  }
+
+   //! <b>Effects</b>: Destroys the stored callable.
+   ~unique_function()
+   {  this->m_storage.destroy();  }
+
+   //! <b>Effects</b>: Destroys the stored callable and takes the callable stored in "x", leaving it empty.
+   unique_function& operator=(BOOST_RV_REF(unique_function) x) BOOST_NOEXCEPT
+   {
+      if(this != &x){
+         this->reset();
+         this->steal(x);
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: <tt>unique_function(std::forward<F>(f)).swap(*this)</tt>.
+   template<class F>
+   BOOST_MOVE_DOC1ST(unique_function&, typename ::boost::move_detail::enable_if_c
+      < !::boost::move_detail::is_same<typename detail_unique_function::callable_type<F>::type BOOST_MOVE_I unique_function>::value
+        BOOST_MOVE_I unique_function& >::type)
+      operator=(BOOST_FWD_REF(F) f)
+   {
+      unique_function tmp(::boost::forward<F>(f));
+      this->reset();
+      this->steal(tmp);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Destroys the stored callable.
+   //!
+   //! <b>Postcondition</b>: The object is empty.
+   void reset() BOOST_NOEXCEPT
+   {
+      this->m_storage.destroy();
+      this->m_invoke = 0;
+   }
+
+   //! <b>Returns</b>: True if a callable is stored.
+   #ifdef BOOST_MOVE_DOXYGEN_INVOKED
+   explicit operator bool
+   #else
+   operator ::boost::move_upd::explicit_bool_arg
+   #endif
+      ()const BOOST_NOEXCEPT
+   {
+      return this->m_invoke
+         ? &::boost::move_upd::bool_conversion::for_bool
+         : ::boost::move_upd::explicit_bool_arg(0);
+   }
+
+   //! <b>Returns</b>: True if the stored callable is stored inline.
+   bool is_inline() const BOOST_NOEXCEPT
+   {  return this->m_storage.is_inline();  }
+
+   //! <b>Returns</b>: True if callables of type F are stored inline.
+   template<class F>
+   static bool is_inline_type() BOOST_NOEXCEPT
+   {
+      typedef typename detail_unique_function::callable_type<F>::type callable_t;
+      return storage_t::template fits<callable_t>::value;
+   }
+
+   //! <b>Effects</b>: Exchanges the stored callables.
+   //!
+   //! <b>Throws</b>: Nothing.
+   void swap(unique_function &x) BOOST_NOEXCEPT
+   {
+      unique_function tmp(::boost::move(x));
+      x.steal(*this);
+      this->steal(tmp);
+   }
+
+   //! <b>Effects</b>: l.swap(r).
+   friend void swap(unique_function &l, unique_function &r) BOOST_NOEXCEPT
+   {  l.swap(r);  }
+
+   private:
+   typedef detail_unique_function::function_storage<InlineBytes> storage_t;
+
+   template<class F>
+   void assign(BOOST_FWD_REF(F) f)
+   {
+      typedef typename detail_unique_function::callable_type<F>::type callable_t;
+      typedef typename storage_t::template manager_for<callable_t>::type manager_t;
+      this->m_storage.template construct<callable_t>(::boost::forward<F>(f));
+      this->m_invoke = &base_t::template invoke<manager_t>;
+   }
+
+   //Precondition: *this is empty
+   void steal(unique_function &x) BOOST_NOEXCEPT
+   {
+      this->m_storage.steal(x.m_storage);
+      this->m_invoke = x.m_invoke;
+      x.m_invoke = 0;
+   }
+};
+
+}  //namespace movelib {
+}  //namespace boost{
+
+#include <boost/move/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_MOVE_UNIQUE_FUNCTION_HPP_INCLUDED
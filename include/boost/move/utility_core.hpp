@@ -208,7 +208,7 @@
       #else //BOOST_MOVE_OLD_RVALUE_REF_BINDING_RULES
 
          template <class T>
-         BOOST_MOVE_INTRINSIC_CAST
+         BOOST_MOVE_INTRINSIC_CAST BOOST_CONSTEXPR
          typename ::boost::move_detail::remove_reference<T>::type && move(T&& t) BOOST_NOEXCEPT
          { return static_cast<typename ::boost::move_detail::remove_reference<T>::type &&>(t); }
 
@@ -245,12 +245,12 @@
       #else //Old move
 
          template <class T>
-         BOOST_MOVE_INTRINSIC_CAST
+         BOOST_MOVE_INTRINSIC_CAST BOOST_CONSTEXPR
          T&& forward(typename ::boost::move_detail::remove_reference<T>::type& t) BOOST_NOEXCEPT
          {  return static_cast<T&&>(t);   }
 
          template <class T>
-         BOOST_MOVE_INTRINSIC_CAST
+         BOOST_MOVE_INTRINSIC_CAST BOOST_CONSTEXPR
          T&& forward(typename ::boost::move_detail::remove_reference<T>::type&& t) BOOST_NOEXCEPT
          {
             //"boost::forward<T> error: 'T' is a lvalue reference, can't forward as rvalue.";
@@ -287,11 +287,11 @@
    #else //Old move
 
       template <class T>
-      BOOST_MOVE_FORCEINLINE T&& move_if_not_lvalue_reference(typename ::boost::move_detail::remove_reference<T>::type& t) BOOST_NOEXCEPT
+      BOOST_MOVE_FORCEINLINE BOOST_CONSTEXPR T&& move_if_not_lvalue_reference(typename ::boost::move_detail::remove_reference<T>::type& t) BOOST_NOEXCEPT
       {  return static_cast<T&&>(t);   }
 
       template <class T>
-      BOOST_MOVE_FORCEINLINE T&& move_if_not_lvalue_reference(typename ::boost::move_detail::remove_reference<T>::type&& t) BOOST_NOEXCEPT
+      BOOST_MOVE_FORCEINLINE BOOST_CONSTEXPR T&& move_if_not_lvalue_reference(typename ::boost::move_detail::remove_reference<T>::type&& t) BOOST_NOEXCEPT
       {
          //"boost::forward<T> error: 'T' is a lvalue reference, can't forward as rvalue.";
          BOOST_MOVE_STATIC_ASSERT(!boost::move_detail::is_lvalue_reference<T>::value);
@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+//Memory resource shared by all copies of test_allocator. Requests bigger
+//than "limit" fail, throwing or returning null depending on "throws".
+struct test_resource
+{
+   explicit test_resource(std::size_t lim = std::size_t(-1), bool thr = true)
+      : limit(lim), throws(thr), num_requests(0u), outstanding(0u), last_size(0u)
+   {
+      for(std::size_t i = 0; i != 4u; ++i)
+         requests[i] = 0u;
+   }
+
+   void *allocate(std::size_t n, std::size_t elem_size)
+   {
+      if(num_requests < 4u)
+         requests[num_requests] = n;
+      ++num_requests;
+      if(n > limit){
+         if(throws)
+            throw std::bad_alloc();
+         return 0;
+      }
+      ++outstanding;
+      last_size = n;
+      return ::operator new(n*elem_size);
+   }
+
+   void deallocate(void *p, std::size_t n)
+   {
+      BOOST_TEST_EQ(n, last_size);
+      --outstanding;
+      ::operator delete(p);
+   }
+
+   std::size_t limit;
+   bool throws;
+   std::size_t requests[4];
+   std::size_t num_requests;
+   std::size_t outstanding;
+   std::size_t last_size;
+};
+
+template<class T>
+class test_allocator
+{
+   public:
+   typedef T value_type;
+
+   explicit test_allocator(test_resource &r)
+      : m_res(&r)
+   {}
+
+   T *allocate(std::size_t n)
+   {  return static_cast<T*>(m_res->allocate(n, sizeof(T)));  }
+
+   void deallocate(T *p, std::size_t n)
+   {  m_res->deallocate(p, n);  }
+
+   private:
+   test_resource *m_res;
+};
+
+void test_sort(std::size_t element_count, std::size_t num_keys, test_resource &res, std::size_t max_elements = std::size_t(-1))
+{
+   boost::movelib::unique_ptr<order_move_type[]> elements(new order_move_type[element_count]);
+   fill_shuffled(elements.get(), element_count, num_keys);
+   boost::movelib::adaptive_sort( elements.get(), elements.get() + element_count, order_type_less()
+                                , test_allocator<order_move_type>(res), max_elements);
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count));
+   BOOST_TEST_EQ(res.outstanding, 0u);
+}
+
+void test_merge(std::size_t element_count, std::size_t num_keys, test_resource &res, std::size_t max_elements = std::size_t(-1))
+{
+   boost::movelib::unique_ptr<order_move_type[]> elements(new order_move_type[element_count]);
+   fill_shuffled(elements.get(), element_count, num_keys);
+   order_move_type *const mid = elements.get() + element_count/3u;
+   boost::movelib::adaptive_sort(elements.get(), mid, order_type_less());
+   boost::movelib::adaptive_sort(mid, elements.get() + element_count, order_type_less());
+   boost::movelib::adaptive_merge( elements.get(), mid, elements.get() + element_count, order_type_less()
+                                 , test_allocator<order_move_type>(res), max_elements);
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count));
+   BOOST_TEST_EQ(res.outstanding, 0u);
+}
+
+void test_sort_allocation()
+{
+   const std::size_t n = 10001u;
+   const std::size_t sqrt_len = 2u*boost::movelib::detail_adaptive::ceil_sqrt_multiple(n);
+   {  //Ideal buffer is obtained
+      test_resource res;
+      test_sort(n, 0u, res);
+      BOOST_TEST_EQ(res.num_requests, 1u);
+      BOOST_TEST_EQ(res.requests[0], n - n/2u);
+   }
+   {  //Ideal buffer throws, sqrt buffer is used
+      test_resource res(n/4u, true);
+      test_sort(n, 0u, res);
+      BOOST_TEST_EQ(res.num_requests, 2u);
+      BOOST_TEST_EQ(res.requests[1], sqrt_len);
+   }
+   {  //Null is returned, sqrt buffer is used
+      test_resource res(n/4u, false);
+      test_sort(n, 200u, res);
+      BOOST_TEST_EQ(res.num_requests, 2u);
+      BOOST_TEST_EQ(res.requests[1], sqrt_len);
+   }
+   {  //Everything fails, sort without external buffer
+      test_resource res(0u, true);
+      test_sort(n, 65u, res);
+      BOOST_TEST_EQ(res.num_requests, 2u);
+   }
+   {  //Budget limits the request
+      test_resource res;
+      test_sort(n, 0u, res, 100u);
+      BOOST_TEST_EQ(res.num_requests, 1u);
+      BOOST_TEST_EQ(res.requests[0], 100u);
+   }
+   {  //Small ranges don't allocate
+      test_resource res;
+      test_sort(10u, 0u, res);
+      BOOST_TEST_EQ(res.num_requests, 0u);
+   }
+}
+
+void test_merge_allocation()
+{
+   const std::size_t n = 10001u;
+   const std::size_t sqrt_len = 2u*boost::movelib::detail_adaptive::ceil_sqrt(n);
+   {  //Ideal buffer is obtained
+      test_resource res;
+      test_merge(n, 0u, res);
+      BOOST_TEST_EQ(res.num_requests, 1u);
+      BOOST_TEST(res.requests[0] <= n/3u);
+   }
+   {  //Ideal buffer throws, sqrt buffer is used
+      test_resource res(sqrt_len, true);
+      test_merge(n, 0u, res);
+      BOOST_TEST_EQ(res.num_requests, 2u);
+      //Elements already in place are trimmed before computing the length
+      BOOST_TEST(res.requests[1] <= sqrt_len);
+      BOOST_TEST_EQ(res.outstanding, 0u);
+   }
+   {  //Everything fails, merge without external buffer
+      test_resource res(0u, false);
+      test_merge(n, 3u, res);
+      BOOST_TEST_EQ(res.num_requests, 2u);
+   }
+   {  //Budget limits the request
+      test_resource res;
+      test_merge(n, 0u, res, 50u);
+      BOOST_TEST_EQ(res.num_requests, 1u);
+      BOOST_TEST_EQ(res.requests[0], 50u);
+   }
+   {  //Already merged ranges don't allocate
+      test_resource res;
+      order_move_type elements[100];
+      for(std::size_t i = 0; i != 100u; ++i){
+         elements[i].key = i;
+         elements[i].val = 0u;
+      }
+      boost::movelib::adaptive_merge( elements, elements + 50, elements + 100, order_type_less()
+                                    , test_allocator<order_move_type>(res));
+      BOOST_TEST_EQ(res.num_requests, 0u);
+   }
+}
+
+void test_overload_selection()
+{
+   //Raw storage overloads are still selected for pointer lvalues
+   order_move_type elements[100];
+   fill_shuffled(elements, 100u, 0u);
+   boost::movelib::unique_ptr<char[]> mem(new char[sizeof(order_move_type)*50u]);
+   order_move_type *raw = boost::move_detail::force_ptr<order_move_type*>(mem.get());
+   std::size_t raw_len = 50u;
+   boost::movelib::adaptive_sort(elements, elements + 100, order_type_less(), raw, raw_len);
+   BOOST_TEST(is_order_type_ordered(elements, 100u));
+   boost::movelib::adaptive_merge(elements, elements + 30, elements + 100, order_type_less(), raw, raw_len);
+   BOOST_TEST(is_order_type_ordered(elements, 100u));
+
+   //Standard allocators
+   fill_shuffled(elements, 100u, 0u);
+   boost::movelib::adaptive_sort(elements, elements + 100, order_type_less(), std::allocator<order_move_type>());
+   BOOST_TEST(is_order_type_ordered(elements, 100u));
+}
+
+int main()
+{
+   std::srand(0);
+   test_sort_allocation();
+   test_merge_allocation();
+   test_overload_selection();
+   return boost::report_errors();
+}
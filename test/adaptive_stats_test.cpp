@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+std::size_t perf_type_num_copy()
+{  return std::size_t(order_perf_type::num_copy);  }
+
+void test_sort_stats(std::size_t element_count, std::size_t num_keys, std::size_t buf_len, boost::movelib::adaptive_strategy expected)
+{
+   using namespace boost::movelib;
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   unique_ptr<char[]> mem(new char[sizeof(order_perf_type)*(buf_len+1u)]);
+   fill_shuffled(elements.get(), element_count, num_keys);
+
+   order_perf_type::reset_stats();
+   adaptive_stats stats(&perf_type_num_copy);
+   adaptive_sort( elements.get(), elements.get() + element_count, order_type_less()
+                , boost::move_detail::force_ptr<order_perf_type*>(mem.get()), buf_len, stats);
+
+   BOOST_TEST_EQ(stats.length, element_count);
+   BOOST_TEST_EQ(stats.xbuf_capacity, buf_len);
+   BOOST_TEST_EQ(stats.strategy, expected);
+   //Every comparison and copy is attributed to exactly one phase
+   BOOST_TEST_EQ(stats.total_comparisons(), std::size_t(order_perf_type::num_compare));
+   BOOST_TEST_EQ(stats.total_moves(), std::size_t(order_perf_type::num_copy));
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, false));
+   if(expected == adaptive_block_strategy){
+      BOOST_TEST(stats.keys_collected <= stats.keys_requested);
+      BOOST_TEST(stats.block_length != 0u);
+      BOOST_TEST(stats.merge_passes != 0u);
+      BOOST_TEST(stats.comparisons[adaptive_build_phase] != 0u);
+      BOOST_TEST(stats.comparisons[adaptive_combine_phase] != 0u);
+   }
+   else{
+      BOOST_TEST_EQ(stats.merge_passes, 0u);
+      BOOST_TEST_EQ(stats.comparisons[adaptive_combine_phase], 0u);
+   }
+}
+
+void test_merge_stats(std::size_t element_count, std::size_t num_keys, std::size_t buf_len, boost::movelib::adaptive_strategy expected)
+{
+   using namespace boost::movelib;
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   unique_ptr<char[]> mem(new char[sizeof(order_perf_type)*(buf_len+1u)]);
+   fill_shuffled(elements.get(), element_count, num_keys);
+   order_perf_type *const mid = elements.get() + element_count/2u;
+   adaptive_sort(elements.get(), mid, order_type_less());
+   adaptive_sort(mid, elements.get() + element_count, order_type_less());
+
+   order_perf_type::reset_stats();
+   adaptive_stats stats(&perf_type_num_copy);
+   adaptive_merge( elements.get(), mid, elements.get() + element_count, order_type_less()
+                 , boost::move_detail::force_ptr<order_perf_type*>(mem.get()), buf_len, stats);
+
+   BOOST_TEST_EQ(stats.strategy, expected);
+   BOOST_TEST_EQ(stats.total_comparisons(), std::size_t(order_perf_type::num_compare));
+   BOOST_TEST_EQ(stats.total_moves(), std::size_t(order_perf_type::num_copy));
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, false));
+   BOOST_TEST_EQ(stats.comparisons[adaptive_build_phase], 0u);
+   if(expected == adaptive_block_strategy){
+      BOOST_TEST_EQ(stats.merge_passes, 1u);
+      BOOST_TEST(stats.comparisons[adaptive_combine_phase] != 0u);
+   }
+}
+
+void test_stats_reuse()
+{
+   using namespace boost::movelib;
+   order_perf_type elements[100];
+   fill_shuffled(elements, 100u, 0u);
+
+   adaptive_stats stats;
+   adaptive_sort(elements, elements + 100, order_type_less(), (order_perf_type*)0, 0u, stats);
+   BOOST_TEST(stats.total_comparisons() != 0u);
+   //No move counter, so no moves are recorded
+   BOOST_TEST_EQ(stats.total_moves(), 0u);
+
+   //Already sorted input is trimmed and no work is done
+   adaptive_merge(elements, elements + 50, elements + 100, order_type_less(), (order_perf_type*)0, 0u, stats);
+   BOOST_TEST_EQ(stats.strategy, adaptive_trivial_strategy);
+   BOOST_TEST_EQ(stats.length, 100u);
+   BOOST_TEST_EQ(stats.comparisons[adaptive_final_merge_phase], 0u);
+}
+
+int main()
+{
+   using namespace boost::movelib;
+   std::srand(0);
+
+   test_sort_stats(10u, 0u, 0u, adaptive_trivial_strategy);
+   test_sort_stats(1001u, 0u, 501u, adaptive_buffered_strategy);
+   test_sort_stats(1001u, 0u, 0u, adaptive_block_strategy);
+   test_sort_stats(10001u, 0u, 64u, adaptive_block_strategy);
+   test_sort_stats(10001u, 65u, 0u, adaptive_block_strategy);
+   test_sort_stats(10001u, 3u, 0u, adaptive_rotation_strategy);
+
+   test_merge_stats(1001u, 0u, 501u, adaptive_buffered_strategy);
+   test_merge_stats(10001u, 0u, 0u, adaptive_block_strategy);
+   test_merge_stats(10001u, 0u, 128u, adaptive_block_strategy);
+   test_merge_stats(10001u, 3u, 0u, adaptive_rotation_strategy);
+
+   test_stats_reuse();
+
+   return boost::report_errors();
+}
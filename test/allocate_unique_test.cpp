@@ -0,0 +1,246 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/move/allocate_unique.hpp>
+#include <boost/move/algo/scratch_arena.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <memory>
+#include <new>
+
+struct A
+{
+   int a, b, c;
+   static int count;
+   A() : a (999), b(1000), c(1001) {++count;}
+   A(int x) : a (x), b(1000), c(1001) {++count;}
+   A(int x, int y) : a (x), b(y), c(1001) {++count;}
+   A(int x, int y, int z) : a (x), b(y), c(z) {++count;}
+   A(const A&) {++count;}
+   ~A() {--count;}
+};
+
+int A::count = 0;
+
+//Throws when "throw_at" objects have been constructed
+struct T
+{
+   static int count;
+   static int throw_at;
+   T()
+   {
+      if(count == throw_at)
+         throw int(0);
+      ++count;
+   }
+   ~T() {--count;}
+};
+
+int T::count = 0;
+int T::throw_at = -1;
+
+//Stateless allocator counting live allocations in a global
+static int g_live_allocs = 0;
+
+template<class U>
+class empty_allocator
+{
+   public:
+   typedef U value_type;
+
+   empty_allocator() {}
+
+   template<class V>
+   empty_allocator(const empty_allocator<V> &) {}
+
+   U *allocate(std::size_t n)
+   {  ++g_live_allocs; return static_cast<U*>(::operator new(n*sizeof(U)));  }
+
+   void deallocate(U *p, std::size_t)
+   {  --g_live_allocs; ::operator delete(p);  }
+};
+
+//Stateful allocator recording the sizes of requests
+struct counter
+{
+   counter() : live(0), last_n(0u) {}
+   int live;
+   std::size_t last_n;
+};
+
+template<class U>
+class stateful_allocator
+{
+   template<class V>
+   friend class stateful_allocator;
+
+   public:
+   typedef U value_type;
+
+   template<class V>
+   struct rebind
+   {  typedef stateful_allocator<V> other;  };
+
+   explicit stateful_allocator(counter &c) : m_c(&c) {}
+
+   template<class V>
+   stateful_allocator(const stateful_allocator<V> &o) : m_c(o.m_c) {}
+
+   U *allocate(std::size_t n)
+   {
+      ++m_c->live;
+      m_c->last_n = n;
+      return static_cast<U*>(::operator new(n*sizeof(U)));
+   }
+
+   void deallocate(U *p, std::size_t n)
+   {
+      BOOST_TEST_EQ(n, m_c->last_n);
+      --m_c->live;
+      ::operator delete(p);
+   }
+
+   counter *m_c;
+};
+
+void test_single()
+{
+   using namespace boost::movelib;
+   {
+      unique_ptr<A, allocator_delete<A, empty_allocator<A> > > p =
+         allocate_unique<A>(empty_allocator<A>());
+      BOOST_TEST_EQ(A::count, 1);
+      BOOST_TEST_EQ(g_live_allocs, 1);
+      BOOST_TEST_EQ(p->a, 999);
+      BOOST_TEST_EQ(p->b, 1000);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   BOOST_TEST_EQ(g_live_allocs, 0);
+   {
+      //Allocator is rebound from another value type
+      unique_ptr<A, allocator_delete<A, empty_allocator<char> > > p =
+         allocate_unique<A>(empty_allocator<char>(), 1, 2, 3);
+      BOOST_TEST_EQ(p->a, 1);
+      BOOST_TEST_EQ(p->b, 2);
+      BOOST_TEST_EQ(p->c, 3);
+      //Ownership is transferred
+      unique_ptr<A, allocator_delete<A, empty_allocator<char> > > p2(boost::move(p));
+      BOOST_TEST(!p);
+      BOOST_TEST_EQ(p2->c, 3);
+      BOOST_TEST_EQ(A::count, 1);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   BOOST_TEST_EQ(g_live_allocs, 0);
+   {
+      counter c;
+      unique_ptr<A, allocator_delete<A, stateful_allocator<A> > > p =
+         allocate_unique<A>(stateful_allocator<A>(c), 5);
+      BOOST_TEST_EQ(c.live, 1);
+      BOOST_TEST_EQ(c.last_n, 1u);
+      BOOST_TEST_EQ(p->a, 5);
+      BOOST_TEST(p.get_deleter().get_allocator().m_c == &c);
+      p.reset();
+      BOOST_TEST_EQ(c.live, 0);
+   }
+   {
+      //Default initialization
+      unique_ptr<int, allocator_delete<int, empty_allocator<int> > > p =
+         allocate_unique_definit<int>(empty_allocator<int>());
+      *p = 3;
+      BOOST_TEST_EQ(*p, 3);
+      unique_ptr<int, allocator_delete<int, empty_allocator<int> > > v =
+         allocate_unique<int>(empty_allocator<int>());
+      BOOST_TEST_EQ(*v, 0);
+   }
+   BOOST_TEST_EQ(g_live_allocs, 0);
+}
+
+void test_array()
+{
+   using namespace boost::movelib;
+   {
+      unique_ptr<A[], allocator_delete<A[], empty_allocator<A> > > p =
+         allocate_unique<A[]>(empty_allocator<A>(), 10u);
+      BOOST_TEST_EQ(A::count, 10);
+      BOOST_TEST_EQ(g_live_allocs, 1);
+      BOOST_TEST_EQ(p.get_deleter().size(), 10u);
+      BOOST_TEST_EQ(p[9].a, 999);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   BOOST_TEST_EQ(g_live_allocs, 0);
+   {
+      counter c;
+      unique_ptr<int[], allocator_delete<int[], stateful_allocator<int> > > p =
+         allocate_unique<int[]>(stateful_allocator<int>(c), 7u);
+      BOOST_TEST_EQ(c.last_n, 7u);
+      for(std::size_t i = 0; i != 7u; ++i){
+         BOOST_TEST_EQ(p[i], 0);
+      }
+      unique_ptr<int[], allocator_delete<int[], stateful_allocator<int> > > d =
+         allocate_unique_definit<int[]>(stateful_allocator<int>(c), 7u);
+      BOOST_TEST_EQ(c.live, 2);
+      d[6] = 1;
+      BOOST_TEST_EQ(d[6], 1);
+      d.reset();
+      p.reset();
+      BOOST_TEST_EQ(c.live, 0);
+   }
+}
+
+void test_exceptions()
+{
+   using namespace boost::movelib;
+   T::throw_at = 0;
+   BOOST_TEST_THROWS(allocate_unique<T>(empty_allocator<T>()), int);
+   BOOST_TEST_EQ(g_live_allocs, 0);
+   T::throw_at = 5;
+   BOOST_TEST_THROWS(allocate_unique<T[]>(empty_allocator<T>(), 10u), int);
+   BOOST_TEST_EQ(T::count, 0);
+   BOOST_TEST_EQ(g_live_allocs, 0);
+   T::throw_at = -1;
+}
+
+void test_size()
+{
+   using namespace boost::movelib;
+   //Stateless allocators don't increase the size of unique_ptr
+   BOOST_TEST_EQ(sizeof(unique_ptr<A, allocator_delete<A, empty_allocator<A> > >), sizeof(A*));
+   BOOST_TEST_EQ(sizeof(unique_ptr<A, allocator_delete<A, std::allocator<A> > >), sizeof(A*));
+   //Arrays store their size
+   BOOST_TEST_EQ(sizeof(unique_ptr<A[], allocator_delete<A[], empty_allocator<A> > >), sizeof(A*) + sizeof(std::size_t));
+}
+
+void test_arena()
+{
+   using namespace boost::movelib;
+   scratch_arena arena;
+   {
+      unique_ptr<A, allocator_delete<A, scratch_arena_allocator<A> > > p =
+         allocate_unique<A>(scratch_arena_allocator<A>(arena), 1, 2);
+      BOOST_TEST(p.get() != 0);
+      BOOST_TEST(arena.in_use());
+      //The arena can't serve another request: an empty unique_ptr is returned
+      unique_ptr<A, allocator_delete<A, scratch_arena_allocator<A> > > q =
+         allocate_unique<A>(scratch_arena_allocator<A>(arena));
+      BOOST_TEST(!q);
+      BOOST_TEST_EQ(A::count, 1);
+   }
+   BOOST_TEST(!arena.in_use());
+   BOOST_TEST_EQ(A::count, 0);
+}
+
+int main()
+{
+   test_single();
+   test_array();
+   test_exceptions();
+   test_size();
+   test_arena();
+   return boost::report_errors();
+}
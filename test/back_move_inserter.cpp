@@ -16,7 +16,90 @@
 #include <boost/container/deque.hpp>
 #include <boost/container/list.hpp>
 #include <boost/container/stable_vector.hpp>
+#include <boost/container/vector.hpp>
 #include "../example/movable.hpp"
+#include <cstddef>
+#include <new>
+
+//Counts allocations to check that range moves grow the destination once
+unsigned allocation_count = 0;
+
+template<class T>
+class counting_allocator
+{
+   public:
+   typedef T value_type;
+
+   counting_allocator()
+   {}
+
+   template<class U>
+   counting_allocator(const counting_allocator<U> &)
+   {}
+
+   T* allocate(std::size_t n)
+   {
+      ++allocation_count;
+      return static_cast<T*>(::operator new(n*sizeof(T)));
+   }
+
+   void deallocate(T* p, std::size_t)
+   {  ::operator delete(p);  }
+
+   friend bool operator==(const counting_allocator &, const counting_allocator &)
+   {  return true;  }
+
+   friend bool operator!=(const counting_allocator &, const counting_allocator &)
+   {  return false;  }
+};
+
+//Container that can't insert ranges: only push_back and single element insert
+class single_insert_container
+{
+   public:
+   typedef ::boost::container::vector<int>   base_t;
+   typedef base_t::value_type                value_type;
+   typedef base_t::reference                 reference;
+   typedef base_t::pointer                   pointer;
+   typedef base_t::difference_type           difference_type;
+   typedef base_t::size_type                 size_type;
+   typedef base_t::iterator                  iterator;
+
+   iterator begin()
+   {  return m_v.begin();  }
+
+   iterator end()
+   {  return m_v.end();  }
+
+   size_type size() const
+   {  return m_v.size();  }
+
+   void push_back(int x)
+   {  m_v.push_back(x);  }
+
+   iterator insert(iterator pos, int x)
+   {  return m_v.insert(pos, x);  }
+
+   private:
+   base_t m_v;
+};
+
+int single_insert_test()
+{
+   BOOST_MOVE_STATIC_ASSERT((!::boost::move_detail::has_range_insert_member<single_insert_container, int*>::value));
+   #if !defined(BOOST_NO_SFINAE_EXPR)
+   BOOST_MOVE_STATIC_ASSERT((::boost::move_detail::has_range_insert_member< ::boost::container::vector<int>, int*>::value));
+   #endif
+   int src[] = { 1, 2, 3 };
+   single_insert_container c;
+   ::boost::move(src, src + 3, boost::back_move_inserter(c));
+   ::boost::move(src, src + 2, boost::move_inserter(c, c.begin() + 1));
+   const int expected[] = { 1, 1, 2, 2, 3 };
+   if(c.size() != 5u || !std::equal(c.begin(), c.end(), expected)){
+      return 1;
+   }
+   return 0;
+}
 
 template<class Container>
 int move_test()
@@ -61,10 +144,97 @@ int move_test()
    return 0;
 }
 
+int range_move_test()
+{
+   namespace bc = ::boost::container;
+   typedef bc::vector<movable, counting_allocator<movable> > counted_vector;
+   const std::size_t N = 1000;
+
+   //boost::move with a forward range issues a single range insertion
+   {
+      bc::vector<movable> v(N);
+      counted_vector v2;
+      allocation_count = 0;
+      ::boost::move(v.begin(), v.end(), boost::back_move_inserter(v2));
+      if(allocation_count != 1 || v2.size() != N || !v.begin()->moved() || v2.begin()->moved()){
+         return 1;
+      }
+   }
+   //Also through copy_or_move and uninitialized_copy_or_move with move iterators
+   {
+      bc::vector<movable> v(N);
+      counted_vector v2;
+      allocation_count = 0;
+      ::boost::copy_or_move( boost::make_move_iterator(v.begin())
+                           , boost::make_move_iterator(v.end())
+                           , boost::back_move_inserter(v2));
+      ::boost::uninitialized_copy_or_move( boost::make_move_iterator(v2.begin())
+                                         , boost::make_move_iterator(v2.begin() + N/2)
+                                         , boost::back_move_inserter(v));
+      if(allocation_count != 1 || v2.size() != N || v.size() != N + N/2 || !v.begin()->moved() || v.back().moved()){
+         return 1;
+      }
+   }
+   //A size hint reserves once for element by element insertion
+   {
+      bc::vector<movable> v(N);
+      counted_vector v2;
+      allocation_count = 0;
+      std::copy(v.begin(), v.end(), boost::back_move_inserter(v2, N));
+      if(allocation_count != 1 || v2.size() != N || v2.capacity() < N){
+         return 1;
+      }
+      //Containers without reserve ignore the hint
+      bc::list<movable> l;
+      std::copy(v2.begin(), v2.end(), boost::back_move_inserter(l, N));
+      if(l.size() != N || !v2.begin()->moved()){
+         return 1;
+      }
+   }
+   return 0;
+}
+
+template<class Container>
+int move_inserter_test()
+{
+   //Insert {2, 3} into {1, 4} and keep inserting through the returned iterator
+   Container c;
+   c.push_back(1);
+   c.push_back(4);
+   int src[] = { 2, 3 };
+   typename Container::iterator pos = c.begin();
+   ++pos;
+   boost::move_insert_iterator<Container> it =
+      ::boost::move(src, src + 2, boost::move_inserter(c, pos));
+   int five = 5;
+   *it = five;
+   const int expected[] = { 1, 2, 3, 5, 4 };
+   if(c.size() != 5u || !std::equal(c.begin(), c.end(), expected)){
+      return 1;
+   }
+   return 0;
+}
+
 int main()
 {
    namespace bc = ::boost::container;
 
+   if(range_move_test()){
+      return 1;
+   }
+   if(single_insert_test()){
+      return 1;
+   }
+   if(move_inserter_test< bc::vector<int> >()){
+      return 1;
+   }
+   if(move_inserter_test< bc::deque<int> >()){
+      return 1;
+   }
+   if(move_inserter_test< bc::list<int> >()){
+      return 1;
+   }
+
    if(move_test< bc::vector<movable> >()){
       return 1;
    }
@@ -0,0 +1,219 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares branchy and branch-free merge kernels in merge_sort, adaptive_sort
+//and adaptive_merge with 8 byte records. Random keys make the branch of the
+//merge kernel unpredictable, clustered keys (long runs coming from the same
+//input range) make it predictable.
+
+#include <cstdio>    //std::printf
+#include <cstdlib>   //std::rand
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/algo/branchless_merge.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include "random_shuffle.hpp"
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+
+template<bool Branchless>
+struct key_record
+{
+   unsigned key;
+   unsigned val;
+};
+
+namespace boost {
+namespace movelib {
+
+template<bool Branchless>
+struct branchless_merge< key_record<Branchless> >
+{
+   static const bool value = Branchless;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+struct key_less
+{
+   template<class T>
+   bool operator()(const T &l, const T &r) const
+   {  return l.key < r.key;  }
+};
+
+namespace boost {
+namespace movelib {
+
+template<bool Branchless>
+struct branchless_merge_compare< key_less, key_record<Branchless> >
+{
+   static const bool value = true;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+enum Distribution
+{
+   Random,
+   Clustered,
+   MaxDistribution
+};
+
+const char *DistributionNames [] = { "random", "clustered" };
+
+enum AlgoType
+{
+   MergeSort,
+   AdaptiveSortBuf,
+   AdaptiveSort,
+   AdaptiveMerge,
+   MaxAlgo
+};
+
+const char *AlgoNames [] = { "merge_sort          "
+                           , "adaptive_sort (n/2) "
+                           , "adaptive_sort (0)   "
+                           , "adaptive_merge (0)  "
+                           };
+
+BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxAlgo);
+
+void generate_keys(boost::container::vector<unsigned> &keys, std::size_t n, Distribution d)
+{
+   keys.resize(n);
+   std::srand(0);
+   if(d == Random){
+      for(std::size_t i = 0; i != n; ++i)
+         keys[i] = unsigned(std::rand());
+   }
+   else{
+      //Shuffled blocks of 256 consecutive keys
+      const std::size_t block = 256u;
+      const std::size_t nblocks = (n + block - 1u)/block;
+      boost::container::vector<std::size_t> order(nblocks);
+      for(std::size_t i = 0; i != nblocks; ++i)
+         order[i] = i;
+      ::random_shuffle(order.data(), order.data() + nblocks);
+      for(std::size_t i = 0; i != n; ++i)
+         keys[i] = unsigned(order[i/block]*block + i%block);
+   }
+}
+
+template<class T>
+void run_algo(T *elements, std::size_t n, std::size_t alg)
+{
+   switch(alg)
+   {
+      case MergeSort:
+      {
+         boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*(n - n/2)]);
+         boost::movelib::merge_sort(elements, elements + n, key_less(), boost::move_detail::force_ptr<T*>(mem.get()));
+      }
+      break;
+      case AdaptiveSortBuf:
+      {
+         boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*(n/2 + 1u)]);
+         boost::movelib::adaptive_sort(elements, elements + n, key_less(), boost::move_detail::force_ptr<T*>(mem.get()), n/2 + 1u);
+      }
+      break;
+      case AdaptiveSort:
+         boost::movelib::adaptive_sort(elements, elements + n, key_less(), (T*)0, 0u);
+      break;
+      case AdaptiveMerge:
+         boost::movelib::adaptive_merge(elements, elements + n/2, elements + n, key_less(), (T*)0, 0u);
+      break;
+   }
+}
+
+template<class T>
+nanosecond_type measure_one(const boost::container::vector<unsigned> &keys, std::size_t alg, const char *case_name, const char *algo_name, bench_report &report)
+{
+   const std::size_t n = keys.size();
+   boost::container::vector<T> original(n), elements;
+   for(std::size_t i = 0; i != n; ++i){
+      original[i].key = keys[i];
+      original[i].val = unsigned(i);
+   }
+   if(alg == AdaptiveMerge){
+      boost::movelib::adaptive_sort(original.data(), original.data() + n/2, key_less());
+      boost::movelib::adaptive_sort(original.data() + n/2, original.data() + n, key_less());
+   }
+
+   bench_samples samples;
+   for(std::size_t run = 0; run != report.runs(); ++run){
+      elements = original;
+      cpu_timer timer(true);
+      timer.resume();
+      run_algo(elements.data(), n, alg);
+      timer.stop();
+      samples.add(timer.elapsed(), 0u, 0u);
+   }
+   for(std::size_t i = 1; i < n; ++i){
+      if(elements[i].key < elements[i-1].key || (elements[i].key == elements[i-1].key && elements[i].val < elements[i-1].val)){
+         std::printf("\n Ord KO !!!!");
+         std::abort();
+      }
+   }
+   report.add(case_name, n, algo_name, samples);
+   return samples.median();
+}
+
+void measure(std::size_t n, Distribution d, bench_report &report)
+{
+   boost::container::vector<unsigned> keys;
+   generate_keys(keys, n, d);
+
+   char case_name[64];
+   std::sprintf(case_name, "key8/%s", DistributionNames[d]);
+   if(report.is_text())
+      std::printf("\n - - N: %u, %s - -\n", unsigned(n), case_name);
+
+   for(std::size_t alg = 0; alg != MaxAlgo; ++alg){
+      char algo_name[64];
+      std::sprintf(algo_name, "%s branchy", AlgoNames[alg]);
+      const nanosecond_type branchy = measure_one< key_record<false> >(keys, alg, case_name, algo_name, report);
+      std::sprintf(algo_name, "%s branchless", AlgoNames[alg]);
+      const nanosecond_type branchless = measure_one< key_record<true> >(keys, alg, case_name, algo_name, report);
+      if(report.is_text()){
+         std::printf("%s branchy %9.02f us, branchless %9.02f us (%6.02f)\n", AlgoNames[alg]
+                    , double(branchy)/1000.0, double(branchless)/1000.0, double(branchless)/double(branchy));
+      }
+   }
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("branchless_merge", opt);
+   #ifdef NDEBUG
+   const std::size_t sizes[] = { 10000u, 1000000u };
+   #else
+   const std::size_t sizes[] = { 1000u, 10000u };
+   #endif
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(*sizes); ++i){
+      measure(sizes[i], Random, report);
+      measure(sizes[i], Clustered, report);
+   }
+   return report.finish();
+}
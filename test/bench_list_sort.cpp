@@ -0,0 +1,187 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Sorts an intrusive doubly linked list of 300 byte orders relinking nodes with
+//list_sort (binary and K-way merges) and compares it with sorting the same
+//orders by value in a contiguous array with adaptive_sort
+
+#include <cstdio>    //std::printf
+#include <cstdlib>   //std::rand
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/algo/list_sort.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include "random_shuffle.hpp"
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+
+struct order
+{
+   order *next;
+   order *prev;
+   std::size_t price;
+   std::size_t seq;
+   char payload[300 - 2*sizeof(void*) - 2*sizeof(std::size_t)];
+};
+
+struct order_traits
+{
+   typedef order *       node_ptr;
+   typedef const order * const_node_ptr;
+
+   static node_ptr get_next(const_node_ptr n)            {  return n->next;  }
+   static void set_next(node_ptr n, node_ptr next)       {  n->next = next;  }
+   static node_ptr get_previous(const_node_ptr n)        {  return n->prev;  }
+   static void set_previous(node_ptr n, node_ptr prev)   {  n->prev = prev;  }
+};
+
+struct order_ptr_less
+{
+   bool operator()(const order *l, const order *r) const
+   {  return l->price < r->price;  }
+};
+
+struct order_less
+{
+   bool operator()(const order &l, const order &r) const
+   {  return l.price < r.price;  }
+};
+
+enum AlgoType
+{
+   ListSort,
+   ListSort4,
+   ListSort8,
+   AdaptiveSortValues,
+   MaxSort
+};
+
+const char *AlgoNames [] = { "list_sort           "
+                           , "list_sort<4>        "
+                           , "list_sort<8>        "
+                           , "adaptive_sort values"
+                           };
+
+BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxSort);
+
+//Links the nodes in the given order in a circular list with a header
+void link_list(order &header, order **nodes, std::size_t n)
+{
+   order *prev = &header;
+   for(std::size_t i = 0; i != n; ++i){
+      prev->next = nodes[i];
+      nodes[i]->prev = prev;
+      prev = nodes[i];
+   }
+   prev->next = &header;
+   header.prev = prev;
+}
+
+bool is_list_sorted(const order &header, std::size_t n)
+{
+   std::size_t count = 0;
+   for(const order *p = header.next; p != &header; p = p->next, ++count){
+      if(p->next->prev != p || (p->next != &header && order_ptr_less()(p->next, p)))
+         return false;
+   }
+   return count == n;
+}
+
+void measure(std::size_t n, std::size_t num_keys, bench_report &report)
+{
+   boost::container::vector<order> nodes(n), values, sorted_values;
+   boost::container::vector<order*> list_order(n);
+   std::srand(0);
+   for(std::size_t i = 0; i != n; ++i){
+      list_order[i] = &nodes[i];
+   }
+   //Nodes are scattered in memory as in a real order book
+   ::random_shuffle(list_order.data(), list_order.data() + n);
+   for(std::size_t i = 0; i != n; ++i){
+      list_order[i]->price = std::size_t(std::rand()) % num_keys;
+      list_order[i]->seq = i;
+      values.push_back(*list_order[i]);
+   }
+
+   char case_name[64];
+   std::sprintf(case_name, "order/keys:%u", unsigned(num_keys));
+   if(report.is_text())
+      std::printf("\n - - N: %u, %s - -\n", unsigned(n), case_name);
+
+   order header;
+   nanosecond_type prev_clock = 0;
+   for(std::size_t alg = 0; alg != MaxSort; ++alg){
+      bench_samples samples;
+      for(std::size_t run = 0; run != report.runs(); ++run){
+         link_list(header, list_order.data(), n);
+         sorted_values = values;
+         cpu_timer timer(true);
+         timer.resume();
+         switch(alg)
+         {
+            case ListSort:
+               boost::movelib::list_sort<order_traits>(header.next, &header, order_ptr_less());
+            break;
+            case ListSort4:
+               boost::movelib::list_sort<order_traits, 4>(header.next, &header, order_ptr_less());
+            break;
+            case ListSort8:
+               boost::movelib::list_sort<order_traits, 8>(header.next, &header, order_ptr_less());
+            break;
+            case AdaptiveSortValues:
+               boost::movelib::adaptive_sort(sorted_values.data(), sorted_values.data() + n, order_less());
+            break;
+         }
+         timer.stop();
+         samples.add(timer.elapsed(), 0u, 0u);
+      }
+      const bool ok = alg == AdaptiveSortValues
+         ? boost::movelib::is_sorted(sorted_values.data(), sorted_values.data() + n, order_less())
+         : is_list_sorted(header, n);
+      if(!ok){
+         std::printf("\n Ord KO !!!!");
+         std::abort();
+      }
+      report.add(case_name, n, AlgoNames[alg], samples);
+      if(report.is_text()){
+         const nanosecond_type new_clock = samples.median();
+         std::printf("%s %8.02f us (%6.02f)", AlgoNames[alg]
+                    , double(new_clock)/1000.0, prev_clock ? double(new_clock)/double(prev_clock) : 1.0);
+         samples.print_hw(n);
+         std::printf("\n");
+         if(!prev_clock)
+            prev_clock = new_clock;
+      }
+   }
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("list_sort", opt);
+   #ifdef NDEBUG
+   const std::size_t sizes[] = { 1000u, 100000u, 1000000u };
+   #else
+   const std::size_t sizes[] = { 1000u, 10000u };
+   #endif
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(*sizes); ++i){
+      measure(sizes[i], sizes[i], report);
+      measure(sizes[i], 64u, report);
+   }
+   return report.finish();
+}
@@ -9,8 +9,19 @@
 //
 //////////////////////////////////////////////////////////////////////////////
 
-//#define BOOST_MOVE_ADAPTIVE_SORT_STATS
-//#define BOOST_MOVE_ADAPTIVE_SORT_STATS_LEVEL 2
+//Define it to record peak scratch memory and recursion depth of each engine
+//(the bookkeeping is done inside the timed runs)
+//#define BENCH_MERGE_SCRATCH_STATS
+
+#ifdef BENCH_MERGE_SCRATCH_STATS
+#define BOOST_MOVE_SCRATCH_STATS
+#endif
+
+//Define it to print per-phase statistics of buffered adaptive merges
+//#define BENCH_MERGE_ADAPTIVE_STATS
+
+//Define it to measure merges of 10^8 large records (needs ~26 GB of memory)
+//#define BENCH_MERGE_HUGE
 
 #include <algorithm> //std::inplace_merge
 #include <cstdio>    //std::printf
@@ -26,21 +37,68 @@
 
 #include "order_type.hpp"
 #include "random_shuffle.hpp"
+#include "bench_report.hpp"
 
 using boost::move_detail::cpu_timer;
 using boost::move_detail::nanosecond_type;
 
-void print_stats(const char *str, boost::ulong_long_type element_count)
-{
-   std::printf( "%sCmp:%8.04f Cpy:%9.04f\n", str
-              , double(order_perf_type::num_compare)/double(element_count)
-              , double(order_perf_type::num_copy)/double(element_count));
-}
-
 #include <boost/move/algo/adaptive_merge.hpp>
 #include <boost/move/algo/detail/merge.hpp>
+#include <boost/move/algo/merge_prefetch.hpp>
 #include <boost/move/core.hpp>
 
+//Large record to measure the effect of merge prefetching (cycles per element
+//are printed when hardware counters are available)
+template<std::size_t Size, bool Prefetch>
+struct order_perf_record
+   : order_perf_type
+{
+   unsigned char payload[Size - sizeof(order_perf_type)];
+};
+
+namespace boost {
+namespace movelib {
+
+template<std::size_t Size, bool Prefetch>
+struct merge_prefetch< order_perf_record<Size, Prefetch> >
+{
+   static const bool value = Prefetch;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+template<class T>
+struct bench_type_name
+{
+   static void get(char *buf)
+   {  buf[0] = 0;  }
+};
+
+template<std::size_t Size, bool Prefetch>
+struct bench_type_name< order_perf_record<Size, Prefetch> >
+{
+   static void get(char *buf)
+   {  std::sprintf(buf, "Rec:%u:%s/", (unsigned)Size, Prefetch ? "prefetch" : "noprefetch");  }
+};
+
+std::size_t perf_type_num_copy()
+{  return std::size_t(order_perf_type::num_copy);  }
+
+void print_adaptive_stats(const boost::movelib::adaptive_stats &stats)
+{
+   const char *const phase_names[] = { "collect", "build  ", "combine", "final  " };
+   std::printf( "\n   keys: %u/%u block: %u intbuf: %u xbuf: %d"
+              , unsigned(stats.keys_collected), unsigned(stats.keys_requested), unsigned(stats.block_length)
+              , unsigned(stats.internal_buffer_length), int(stats.used_xbuf));
+   for(std::size_t i = 0; i != boost::movelib::adaptive_phase_count; ++i){
+      std::printf( "\n   %s Cmp:%8.04f Cpy:%9.04f", phase_names[i]
+                 , double(stats.comparisons[i])/double(stats.length)
+                 , double(stats.moves[i])/double(stats.length));
+   }
+   std::printf("\n                   ");
+}
+
 template<class T, class Compare>
 std::size_t generate_elements(boost::container::vector<T> &elements, std::size_t L, std::size_t NK, Compare comp)
 {
@@ -71,7 +129,13 @@ template<class T, class Compare>
 void adaptive_merge_buffered(T *elements, T *mid, T *last, Compare comp, std::size_t BufLen)
 {
    boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*BufLen]);
+   #ifdef BENCH_MERGE_ADAPTIVE_STATS
+   boost::movelib::adaptive_stats stats(&perf_type_num_copy);
+   boost::movelib::adaptive_merge(elements, mid, last, comp, boost::move_detail::force_ptr<T*>(mem.get()), BufLen, stats);
+   print_adaptive_stats(stats);
+   #else
    boost::movelib::adaptive_merge(elements, mid, last, comp, boost::move_detail::force_ptr<T*>(mem.get()), BufLen);
+   #endif
 }
 
 template<class T, class Compare>
@@ -113,14 +177,8 @@ const char *AlgoNames [] = { "StdMerge           "
 BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxMerge);
 
 template<class T>
-bool measure_algo(T *elements, std::size_t element_count, std::size_t split_pos, std::size_t alg, nanosecond_type &prev_clock)
+void run_algo(T *elements, std::size_t element_count, std::size_t split_pos, std::size_t alg)
 {
-   std::printf("%s ", AlgoNames[alg]);
-   order_perf_type::num_compare=0;
-   order_perf_type::num_copy=0;
-   order_perf_type::num_elements = element_count;
-   cpu_timer timer;
-   timer.resume();
    switch(alg)
    {
       case StdMerge:
@@ -165,17 +223,61 @@ bool measure_algo(T *elements, std::size_t element_count, std::size_t split_pos,
                             , (element_count)/4+1);
       break;
    }
-   timer.stop();
+}
+
+template<class T>
+bool measure_algo( const boost::container::vector<T> &original_elements, boost::container::vector<T> &elements
+                 , std::size_t NK, std::size_t split_pos, std::size_t alg, nanosecond_type &prev_clock, bench_report &report)
+{
+   std::size_t const element_count = original_elements.size();
+   bench_samples samples;
+   bool tmp_ok = true;
+   bool res = true;
+   for(std::size_t run = 0; run != report.runs(); ++run){
+      elements = original_elements;
+      order_perf_type::num_compare=0;
+      order_perf_type::num_copy=0;
+      order_perf_type::num_elements = element_count;
+      #ifdef BENCH_MERGE_SCRATCH_STATS
+      boost::movelib::scratch_stats scratch;
+      #endif
+      cpu_timer timer(true);
+      timer.resume();
+      {
+         #ifdef BENCH_MERGE_SCRATCH_STATS
+         boost::movelib::scoped_scratch_stats scratch_scope(scratch);
+         #endif
+         run_algo(elements.data(), element_count, split_pos, alg);
+      }
+      timer.stop();
+      tmp_ok = tmp_ok && order_perf_type::num_elements == element_count;
+      samples.add(timer.elapsed(), order_perf_type::num_compare, order_perf_type::num_copy);
+      #ifdef BENCH_MERGE_SCRATCH_STATS
+      samples.add_scratch(scratch);
+      #endif
+      res = res && is_order_type_ordered(elements.data(), element_count, true);
+   }
+   char type_name[32];
+   bench_type_name<T>::get(type_name);
+   char case_name[64];
+   std::sprintf(case_name, "%sNK:%u", type_name, (unsigned)NK);
+   report.add(case_name, element_count, AlgoNames[alg], samples);
+   if(!report.is_text()){
+      return res && tmp_ok;
+   }
 
-   if(order_perf_type::num_elements == element_count){
+   std::printf("%s ", AlgoNames[alg]);
+   if(tmp_ok){
       std::printf(" Tmp Ok ");
    } else{
       std::printf(" Tmp KO ");
    }
-   nanosecond_type new_clock = timer.elapsed().wall;
+   nanosecond_type new_clock = samples.median();
 
    //std::cout << "Cmp:" << order_perf_type::num_compare << " Cpy:" << order_perf_type::num_copy;   //for old compilers without ll size argument
-   std::printf("Cmp:%8.04f Cpy:%9.04f", double(order_perf_type::num_compare)/double(element_count), double(order_perf_type::num_copy)/double(element_count) );
+   std::printf("Cmp:%8.04f Cpy:%9.04f", double(samples.cmp)/double(element_count), double(samples.cpy)/double(element_count) );
+   samples.print_hw(element_count);
+   samples.print_scratch();
 
    double time = double(new_clock);
 
@@ -198,65 +300,57 @@ bool measure_algo(T *elements, std::size_t element_count, std::size_t split_pos,
               , units
               , prev_clock ? double(new_clock)/double(prev_clock): 1.0);
    prev_clock = new_clock;
-   bool res = is_order_type_ordered(elements, element_count, true);
-   return res;
+   return res && tmp_ok;
 }
 
 template<class T>
-bool measure_all(std::size_t L, std::size_t NK)
+bool measure_all(std::size_t L, std::size_t NK, bench_report &report)
 {
    boost::container::vector<T> original_elements, elements;
    std::size_t split_pos = generate_elements(original_elements, L, NK, order_type_less());
-   std::printf("\n - - N: %u, NK: %u - -\n", (unsigned)L, (unsigned)NK);
+   if(report.is_text()){
+      char type_name[32];
+      bench_type_name<T>::get(type_name);
+      std::printf("\n - - %sN: %u, NK: %u - -\n", type_name, (unsigned)L, (unsigned)NK);
+   }
 
    nanosecond_type prev_clock = 0;
    nanosecond_type back_clock;
    bool res = true;
 
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, StdMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, StdMerge, prev_clock, report);
    back_clock = prev_clock;
    //
 
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, QuartAdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, QuartAdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, StdQuartAdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, StdQuartAdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, Sqrt2AdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, Sqrt2AdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, StdSqrt2AdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, StdSqrt2AdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, SqrtAdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, SqrtAdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, StdSqrtAdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, StdSqrtAdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, SqrtHAdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, SqrtHAdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, StdSqrtHAdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, StdSqrtHAdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos, AdaptMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, AdaptMerge, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, split_pos,StdInplaceMerge, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, split_pos, StdInplaceMerge, prev_clock, report);
    //
    if (!res)
       std::abort();
@@ -267,65 +361,78 @@ bool measure_all(std::size_t L, std::size_t NK)
 #define BENCH_MERGE_SHORT
 #define BENCH_SORT_UNIQUE_VALUES
 
-int main()
+int main(int argc, char *argv[])
 {
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("merge", opt);
+
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(101,1);
-   measure_all<order_perf_type>(101,5);
-   measure_all<order_perf_type>(101,7);
-   measure_all<order_perf_type>(101,31);
+   measure_all<order_perf_type>(101,1, report);
+   measure_all<order_perf_type>(101,5, report);
+   measure_all<order_perf_type>(101,7, report);
+   measure_all<order_perf_type>(101,31, report);
    #endif
-   measure_all<order_perf_type>(101,0);
+   measure_all<order_perf_type>(101,0, report);
 
    //
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(1101,1);
-   measure_all<order_perf_type>(1001,7);
-   measure_all<order_perf_type>(1001,31);
-   measure_all<order_perf_type>(1001,127);
-   measure_all<order_perf_type>(1001,511);
+   measure_all<order_perf_type>(1101,1, report);
+   measure_all<order_perf_type>(1001,7, report);
+   measure_all<order_perf_type>(1001,31, report);
+   measure_all<order_perf_type>(1001,127, report);
+   measure_all<order_perf_type>(1001,511, report);
    #endif
-   measure_all<order_perf_type>(1001,0);
+   measure_all<order_perf_type>(1001,0, report);
 
    //
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(10001,65);
-   measure_all<order_perf_type>(10001,255);
-   measure_all<order_perf_type>(10001,1023);
-   measure_all<order_perf_type>(10001,4095);
+   measure_all<order_perf_type>(10001,65, report);
+   measure_all<order_perf_type>(10001,255, report);
+   measure_all<order_perf_type>(10001,1023, report);
+   measure_all<order_perf_type>(10001,4095, report);
    #endif
-   measure_all<order_perf_type>(10001,0);
+   measure_all<order_perf_type>(10001,0, report);
 
    //
    #if defined(NDEBUG)
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(100001,511);
-   measure_all<order_perf_type>(100001,2047);
-   measure_all<order_perf_type>(100001,8191);
-   measure_all<order_perf_type>(100001,32767);
+   measure_all<order_perf_type>(100001,511, report);
+   measure_all<order_perf_type>(100001,2047, report);
+   measure_all<order_perf_type>(100001,8191, report);
+   measure_all<order_perf_type>(100001,32767, report);
    #endif
-   measure_all<order_perf_type>(100001,0);
+   measure_all<order_perf_type>(100001,0, report);
 
    //
    #if !defined(BENCH_MERGE_SHORT)
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(1000001, 8192);
-   measure_all<order_perf_type>(1000001, 32768);
-   measure_all<order_perf_type>(1000001, 131072);
-   measure_all<order_perf_type>(1000001, 524288);
+   measure_all<order_perf_type>(1000001,8192, report);
+   measure_all<order_perf_type>(1000001,32768, report);
+   measure_all<order_perf_type>(1000001,131072, report);
+   measure_all<order_perf_type>(1000001,524288, report);
    #endif
-   measure_all<order_perf_type>(1000001,0);
+   measure_all<order_perf_type>(1000001,0, report);
 
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(10000001, 65536);
-   measure_all<order_perf_type>(10000001, 262144);
-   measure_all<order_perf_type>(10000001, 1048576);
-   measure_all<order_perf_type>(10000001, 4194304);
+   measure_all<order_perf_type>(10000001,65536, report);
+   measure_all<order_perf_type>(10000001,262144, report);
+   measure_all<order_perf_type>(10000001,1048576, report);
+   measure_all<order_perf_type>(10000001,4194304, report);
    #endif
-   measure_all<order_perf_type>(10000001,0);
+   measure_all<order_perf_type>(10000001,0, report);
    #endif   //#ifndef BENCH_MERGE_SHORT
+
+   //Large records, with and without prefetching
+   measure_all< order_perf_record<128, false> >(1000001,0, report);
+   measure_all< order_perf_record<128, true>  >(1000001,0, report);
+   #if defined(BENCH_MERGE_HUGE)
+   measure_all< order_perf_record<128, false> >(100000001,0, report);
+   measure_all< order_perf_record<128, true>  >(100000001,0, report);
+   #endif   //#if defined(BENCH_MERGE_HUGE)
    #endif   //#ifdef NDEBUG
 
-   return 0;
+   return report.finish();
 }
 
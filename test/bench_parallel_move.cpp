@@ -0,0 +1,100 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Bandwidth of serial and parallel move, overlapping move_backward and uninitialized_move
+//of big arrays of doubles.
+
+#include <cstdio>    //std::printf
+#include <new>       //operator new
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/algo/parallel_move.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+using boost::movelib::parallel_policy;
+
+enum operation { move_op, move_backward_op, uninitialized_move_op };
+
+const char *const operation_names[] = { "move", "move_backward_shift", "uninitialized_move" };
+
+void run(operation op, const parallel_policy *pol, double *src, double *dst, std::size_t n)
+{
+   switch(op){
+      case move_op:
+         if(pol) boost::move(*pol, src, src + n, dst);
+         else    boost::move(src, src + n, dst);
+      break;
+      case move_backward_op:
+         //Opens a gap of 1/8 of the range at the front, as an insertion would
+         if(pol) boost::move_backward(*pol, src, src + n - n/8u, src + n);
+         else    boost::move_backward(src, src + n - n/8u, src + n);
+      break;
+      default:
+         if(pol) boost::uninitialized_move(*pol, src, src + n, dst);
+         else    boost::uninitialized_move(src, src + n, dst);
+      break;
+   }
+}
+
+void measure(std::size_t n, operation op, const parallel_policy *pol, const char *name, bench_report &report)
+{
+   boost::container::vector<double> src(n, 1.0);
+   double *const dst = static_cast<double*>(::operator new(n*sizeof(double)));
+   //Touch the destination so that page faults are not measured
+   boost::move(src.data(), src.data() + n, dst);
+   bench_samples samples;
+   for(std::size_t run_i = 0; run_i != report.runs(); ++run_i){
+      //Hardware counters only see the calling thread, not the workers
+      cpu_timer timer;
+      timer.resume();
+      run(op, pol, src.data(), dst, n);
+      timer.stop();
+      samples.add(timer.elapsed(), 0u, 0u);
+   }
+   ::operator delete(dst);
+   report.add(operation_names[op], n, name, samples);
+   if(report.is_text()){
+      const double secs = double(samples.median())/1e9;
+      std::printf("%-20s %-12s %8.02f ms %8.02f GB/s\n", operation_names[op], name
+                 , secs*1e3, double(n*sizeof(double))/secs/1e9);
+   }
+}
+
+void measure_all(std::size_t n, bench_report &report)
+{
+   if(report.is_text())
+      std::printf("\n - - N: %u (%u MB) - -\n", unsigned(n), unsigned(n*sizeof(double) >> 20u));
+   const parallel_policy par2(2u), par_all;
+   for(int op = move_op; op <= uninitialized_move_op; ++op){
+      measure(n, operation(op), 0, "serial", report);
+      measure(n, operation(op), &par2, "2_threads", report);
+      measure(n, operation(op), &par_all, "all_threads", report);
+   }
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("parallel_move", opt);
+   measure_all(100001, report);
+   #ifdef NDEBUG
+   measure_all(4000001, report);
+   measure_all(64000001, report);
+   #endif
+   return report.finish();
+}
@@ -0,0 +1,197 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares copying and moving polymorphic objects owned by a clone_ptr
+//(see the clone_ptr example) and by polymorphic_value
+
+#include <cstdio>    //std::printf
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/polymorphic_value.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+
+class base
+{
+   public:
+   virtual ~base(){}
+   virtual base *clone() const = 0;
+   virtual int value() const = 0;
+};
+
+//Fits the inline buffer of polymorphic_value
+class small_derived : public base
+{
+   public:
+   explicit small_derived(int v) : m_v(v) {}
+   virtual base *clone() const { return new small_derived(*this); }
+   virtual int value() const { return m_v; }
+
+   private:
+   int m_v;
+};
+
+//Always heap allocated
+class big_derived : public base
+{
+   public:
+   explicit big_derived(int v) { m_v[0] = v; }
+   virtual base *clone() const { return new big_derived(*this); }
+   virtual int value() const { return m_v[0]; }
+
+   private:
+   int m_v[16];
+};
+
+namespace boost{
+
+template<>
+struct has_nothrow_move<small_derived>
+{
+   static const bool value = true;
+};
+
+}  //namespace boost{
+
+template <class T>
+class clone_ptr
+{
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(clone_ptr)
+   T* ptr;
+
+   public:
+   explicit clone_ptr(T* p = 0) : ptr(p) {}
+
+   ~clone_ptr() { delete ptr; }
+
+   clone_ptr(const clone_ptr& p)
+      : ptr(p.ptr ? p.ptr->clone() : 0) {}
+
+   clone_ptr& operator=(BOOST_COPY_ASSIGN_REF(clone_ptr) p)
+   {
+      if (this != &p){
+         T *tmp_p = p.ptr ? p.ptr->clone() : 0;
+         delete ptr;
+         ptr = tmp_p;
+      }
+      return *this;
+   }
+
+   clone_ptr(BOOST_RV_REF(clone_ptr) p)
+      : ptr(p.ptr) { p.ptr = 0; }
+
+   clone_ptr& operator=(BOOST_RV_REF(clone_ptr) p)
+   {
+      if (this != &p){
+         delete ptr;
+         ptr = p.ptr;
+         p.ptr = 0;
+      }
+      return *this;
+   }
+
+   T *operator->() const { return ptr; }
+};
+
+typedef boost::movelib::polymorphic_value<base> value_t;
+
+template<class D>
+void fill(boost::container::vector< clone_ptr<base> > &v, std::size_t n)
+{
+   for(std::size_t i = 0; i != n; ++i)
+      v.push_back(clone_ptr<base>(new D(int(i))));
+}
+
+template<class D>
+void fill(boost::container::vector<value_t> &v, std::size_t n)
+{
+   for(std::size_t i = 0; i != n; ++i)
+      v.push_back(boost::movelib::make_polymorphic_value<base, D>(int(i)));
+}
+
+template<class V>
+std::size_t checksum(const boost::container::vector<V> &v)
+{
+   std::size_t sum = 0;
+   for(std::size_t i = 0; i != v.size(); ++i)
+      sum += std::size_t(v[i]->value());
+   return sum;
+}
+
+enum op_type { op_copy, op_move };
+
+const char *const op_names[] = { "copy", "move" };
+
+template<class V, class D>
+void measure(std::size_t n, op_type op, const char *case_name, const char *algo, bench_report &report)
+{
+   boost::container::vector<V> original;
+   original.reserve(n);
+   fill<D>(original, n);
+   bench_samples samples;
+   std::size_t sum = 0;
+   for(std::size_t run = 0; run != report.runs(); ++run){
+      //Destination storage is touched before measuring
+      boost::container::vector<V> src(original), dst(n);
+      cpu_timer timer(true);
+      timer.resume();
+      if(op == op_copy){
+         for(std::size_t i = 0; i != n; ++i)
+            dst[i] = src[i];
+      }
+      else{
+         for(std::size_t i = 0; i != n; ++i)
+            dst[i] = boost::move(src[i]);
+      }
+      timer.stop();
+      sum = checksum(dst);
+      samples.add(timer.elapsed(), 0u, 0u);
+   }
+   report.add(case_name, n, algo, samples);
+   if(report.is_text()){
+      std::printf("%-14s %-5s %-18s %10.02f ns/elem (checksum %u)\n"
+                 , case_name, op_names[op], algo, double(samples.median())/double(n), unsigned(sum));
+   }
+}
+
+void measure_all(std::size_t n, bench_report &report)
+{
+   if(report.is_text())
+      std::printf("\n - - N: %u - -\n", unsigned(n));
+   measure<clone_ptr<base>, small_derived>(n, op_copy, "small_copy", "clone_ptr", report);
+   measure<value_t, small_derived>        (n, op_copy, "small_copy", "polymorphic_value", report);
+   measure<clone_ptr<base>, small_derived>(n, op_move, "small_move", "clone_ptr", report);
+   measure<value_t, small_derived>        (n, op_move, "small_move", "polymorphic_value", report);
+   measure<clone_ptr<base>, big_derived>  (n, op_copy, "big_copy", "clone_ptr", report);
+   measure<value_t, big_derived>          (n, op_copy, "big_copy", "polymorphic_value", report);
+   measure<clone_ptr<base>, big_derived>  (n, op_move, "big_move", "clone_ptr", report);
+   measure<value_t, big_derived>          (n, op_move, "big_move", "polymorphic_value", report);
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("polymorphic_value", opt);
+   measure_all(1001, report);
+   #ifdef NDEBUG
+   measure_all(100001, report);
+   measure_all(1000001, report);
+   #endif
+   return report.finish();
+}
@@ -0,0 +1,382 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_MOVE_TEST_BENCH_REPORT_HPP
+#define BOOST_MOVE_TEST_BENCH_REPORT_HPP
+
+//Machine readable output for the bench programs. Usage:
+//
+//    bench_xxx [--format=text|json|csv] [--runs=N] [--out=FILE]
+//              [--baseline=FILE] [--threshold=FRACTION]
+//
+//Each engine is measured "runs" times and median, p10 and p90 times are reported.
+//Comparison and copy counts are deterministic so when a baseline (a previous json
+//or csv output) is given, any increase is reported as a regression. Times are
+//reported as a regression if the median is "threshold" (default 0.10) slower.
+//The program returns non-zero if a regression is found.
+//
+//Hardware counters (instructions, cycles, branch and cache misses) are reported
+//next to comparisons and copies when the system supports them.
+//
+//Peak scratch memory (external buffer elements and bytes borrowed for keys) and
+//maximum recursion depth are reported when the bench program defines
+//BOOST_MOVE_SCRATCH_STATS before including any header.
+
+#include <boost/config.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+#include <boost/move/algo/scratch_stats.hpp>
+#include <algorithm> //std::sort, std::max
+#include <cstdio>    //std::printf, std::FILE
+#include <cstdlib>   //std::atoi, std::atof
+#include <cstring>   //std::strncmp
+#include <string>
+
+enum bench_format
+{
+   bench_text,
+   bench_json,
+   bench_csv
+};
+
+struct bench_options
+{
+   bench_options()
+      : format(bench_text), runs(1u), out(), baseline(), threshold(0.10)
+   {}
+
+   bench_format format;
+   std::size_t runs;
+   std::string out;
+   std::string baseline;
+   double threshold;
+};
+
+inline bool parse_bench_options(int argc, char *argv[], bench_options &opt)
+{
+   for(int i = 1; i < argc; ++i){
+      const std::string arg(argv[i]);
+      const std::string::size_type eq = arg.find('=');
+      const std::string key = arg.substr(0, eq);
+      const std::string val = eq == std::string::npos ? std::string() : arg.substr(eq + 1u);
+      if(key == "--format" && val == "text"){
+         opt.format = bench_text;
+      }
+      else if(key == "--format" && val == "json"){
+         opt.format = bench_json;
+      }
+      else if(key == "--format" && val == "csv"){
+         opt.format = bench_csv;
+      }
+      else if(key == "--runs" && std::atoi(val.c_str()) > 0){
+         opt.runs = std::size_t(std::atoi(val.c_str()));
+      }
+      else if(key == "--out" && !val.empty()){
+         opt.out = val;
+      }
+      else if(key == "--baseline" && !val.empty()){
+         opt.baseline = val;
+      }
+      else if(key == "--threshold" && std::atof(val.c_str()) >= 0.0){
+         opt.threshold = std::atof(val.c_str());
+      }
+      else{
+         std::fprintf( stderr, "Unknown option \"%s\". Usage: %s [--format=text|json|csv] [--runs=N]"
+                       " [--out=FILE] [--baseline=FILE] [--threshold=FRACTION]\n", argv[i], argv[0]);
+         return false;
+      }
+   }
+   return true;
+}
+
+//Nearest-rank percentile
+inline boost::uint64_t bench_percentile(const boost::container::vector<boost::uint64_t> &v, std::size_t pct)
+{
+   if(v.empty())
+      return 0;
+   boost::container::vector<boost::uint64_t> sorted(v);
+   std::sort(sorted.begin(), sorted.end());
+   std::size_t idx = (pct*sorted.size() + 99u)/100u;
+   return sorted[idx ? idx - 1u : 0u];
+}
+
+//Measures of several runs of the same engine on the same input
+struct bench_samples
+{
+   bench_samples()
+      : times(), cmp(), cpy(), hw_mask(0u), scratch(), has_scratch(false)
+   {}
+
+   void add(const boost::move_detail::cpu_times &t, boost::ulong_long_type c, boost::ulong_long_type m)
+   {
+      times.push_back(t.wall);
+      cmp = c;
+      cpy = m;
+      hw_mask = t.hw_mask;
+      for(std::size_t i = 0; i != boost::move_detail::hw_counter_count; ++i){
+         hw[i].push_back(t.hw[i]);
+      }
+   }
+
+   //Keeps the maximum of all runs
+   void add_scratch(const boost::movelib::scratch_stats &s)
+   {
+      #if defined(BOOST_MOVE_SCRATCH_STATS)
+      has_scratch = true;
+      scratch.peak_xbuf_elements = (std::max)(scratch.peak_xbuf_elements, s.peak_xbuf_elements);
+      scratch.peak_xbuf_bytes = (std::max)(scratch.peak_xbuf_bytes, s.peak_xbuf_bytes);
+      scratch.peak_key_bytes = (std::max)(scratch.peak_key_bytes, s.peak_key_bytes);
+      scratch.max_recursion_depth = (std::max)(scratch.max_recursion_depth, s.max_recursion_depth);
+      #else
+      (void)s;
+      #endif
+   }
+
+   boost::move_detail::nanosecond_type percentile(std::size_t pct) const
+   {  return bench_percentile(times, pct);  }
+
+   boost::move_detail::nanosecond_type median() const
+   {  return this->percentile(50u);  }
+
+   bool has_hw(std::size_t id) const
+   {  return 0 != (hw_mask & (1u << id));  }
+
+   boost::uint64_t hw_median(std::size_t id) const
+   {  return bench_percentile(hw[id], 50u);  }
+
+   //Prints available hardware counters per element, nothing if they are not supported
+   void print_hw(std::size_t element_count) const
+   {
+      for(std::size_t i = 0; i != boost::move_detail::hw_counter_count; ++i){
+         if(this->has_hw(i)){
+            std::printf( " %s:%8.02f", boost::move_detail::hw_counter_name(i)
+                       , double(this->hw_median(i))/double(element_count));
+         }
+      }
+   }
+
+   //Prints peak scratch memory and recursion depth, nothing if they were not recorded
+   void print_scratch() const
+   {
+      if(has_scratch){
+         std::printf( " Buf:%7u Key:%6u Dep:%3u", unsigned(scratch.peak_xbuf_bytes)
+                    , unsigned(scratch.peak_key_bytes), unsigned(scratch.max_recursion_depth));
+      }
+   }
+
+   boost::container::vector<boost::move_detail::nanosecond_type> times;
+   boost::ulong_long_type cmp;
+   boost::ulong_long_type cpy;
+   boost::container::vector<boost::uint64_t> hw[boost::move_detail::hw_counter_count];
+   unsigned hw_mask;
+   boost::movelib::scratch_stats scratch;
+   bool has_scratch;
+};
+
+struct bench_result
+{
+   std::string bench;
+   std::string case_name;
+   unsigned long n;
+   std::string algo;
+   unsigned long runs;
+   //Times and counters are stored as doubles, as they can overflow a 32 bit
+   //long and "long long" is not standard C++03. Printed without decimals.
+   double median_ns;
+   double p10_ns;
+   double p90_ns;
+   double cmp;
+   double cpy;
+   //Median of hardware counters, -1 if not available
+   double hw[boost::move_detail::hw_counter_count];
+   //Peak scratch usage, -1 if not recorded
+   double xbuf_elems;
+   double xbuf_bytes;
+   double key_bytes;
+   double depth;
+
+   bool same_case(const bench_result &o) const
+   {  return bench == o.bench && case_name == o.case_name && n == o.n && algo == o.algo;  }
+};
+
+//Names are printed padded for text output, strip trailing spaces
+inline std::string bench_trim(const char *s)
+{
+   std::string r(s);
+   r.erase(r.find_last_not_of(' ') + 1u);
+   return r;
+}
+
+class bench_report
+{
+   public:
+   bench_report(const char *bench_name, const bench_options &opt)
+      : m_bench(bench_name), m_opt(opt), m_results()
+   {}
+
+   bool is_text() const
+   {  return m_opt.format == bench_text;  }
+
+   std::size_t runs() const
+   {  return m_opt.runs;  }
+
+   void add(const char *case_name, std::size_t n, const char *algo, const bench_samples &s)
+   {
+      bench_result r;
+      r.bench = m_bench;
+      r.case_name = bench_trim(case_name);
+      r.n = (unsigned long)n;
+      r.algo = bench_trim(algo);
+      r.runs = (unsigned long)s.times.size();
+      r.median_ns = double(s.median());
+      r.p10_ns = double(s.percentile(10u));
+      r.p90_ns = double(s.percentile(90u));
+      r.cmp = double(s.cmp);
+      r.cpy = double(s.cpy);
+      for(std::size_t i = 0; i != boost::move_detail::hw_counter_count; ++i){
+         r.hw[i] = s.has_hw(i) ? double(s.hw_median(i)) : -1.0;
+      }
+      r.xbuf_elems = s.has_scratch ? double(s.scratch.peak_xbuf_elements)  : -1.0;
+      r.xbuf_bytes = s.has_scratch ? double(s.scratch.peak_xbuf_bytes)     : -1.0;
+      r.key_bytes  = s.has_scratch ? double(s.scratch.peak_key_bytes)      : -1.0;
+      r.depth      = s.has_scratch ? double(s.scratch.max_recursion_depth) : -1.0;
+      m_results.push_back(r);
+   }
+
+   //Writes json/csv output and compares against the baseline.
+   //Returns the exit code of the program.
+   int finish() const
+   {
+      if(!this->is_text()){
+         std::FILE *f = m_opt.out.empty() ? stdout : std::fopen(m_opt.out.c_str(), "w");
+         if(!f){
+            std::fprintf(stderr, "Can't open \"%s\"\n", m_opt.out.c_str());
+            return 1;
+         }
+         m_opt.format == bench_json ? this->write_json(f) : this->write_csv(f);
+         if(f != stdout)
+            std::fclose(f);
+      }
+      return m_opt.baseline.empty() ? 0 : this->compare_baseline();
+   }
+
+   private:
+   void write_json(std::FILE *f) const
+   {
+      std::fprintf(f, "[\n");
+      for(std::size_t i = 0; i != m_results.size(); ++i){
+         const bench_result &r = m_results[i];
+         std::fprintf( f, "{\"bench\":\"%s\",\"case\":\"%s\",\"n\":%lu,\"algo\":\"%s\",\"runs\":%lu"
+                          ",\"median_ns\":%.0f,\"p10_ns\":%.0f,\"p90_ns\":%.0f,\"cmp\":%.0f,\"cpy\":%.0f"
+                     , r.bench.c_str(), r.case_name.c_str(), r.n, r.algo.c_str(), r.runs
+                     , r.median_ns, r.p10_ns, r.p90_ns, r.cmp, r.cpy);
+         //Hardware counters are optional and appended at the end
+         for(std::size_t j = 0; j != boost::move_detail::hw_counter_count; ++j){
+            if(r.hw[j] >= 0)
+               std::fprintf(f, ",\"%s\":%.0f", boost::move_detail::hw_counter_name(j), r.hw[j]);
+         }
+         if(r.depth >= 0){
+            std::fprintf( f, ",\"xbuf_elems\":%.0f,\"xbuf_bytes\":%.0f,\"key_bytes\":%.0f,\"depth\":%.0f"
+                        , r.xbuf_elems, r.xbuf_bytes, r.key_bytes, r.depth);
+         }
+         std::fprintf(f, "}%s\n", i + 1u == m_results.size() ? "" : ",");
+      }
+      std::fprintf(f, "]\n");
+   }
+
+   void write_csv(std::FILE *f) const
+   {
+      std::fprintf(f, "bench,case,n,algo,runs,median_ns,p10_ns,p90_ns,cmp,cpy");
+      for(std::size_t j = 0; j != boost::move_detail::hw_counter_count; ++j){
+         std::fprintf(f, ",%s", boost::move_detail::hw_counter_name(j));
+      }
+      std::fprintf(f, ",xbuf_elems,xbuf_bytes,key_bytes,depth\n");
+      for(std::size_t i = 0; i != m_results.size(); ++i){
+         const bench_result &r = m_results[i];
+         std::fprintf( f, "%s,%s,%lu,%s,%lu,%.0f,%.0f,%.0f,%.0f,%.0f"
+                     , r.bench.c_str(), r.case_name.c_str(), r.n, r.algo.c_str(), r.runs
+                     , r.median_ns, r.p10_ns, r.p90_ns, r.cmp, r.cpy);
+         //Unavailable hardware counters are left empty
+         for(std::size_t j = 0; j != boost::move_detail::hw_counter_count; ++j){
+            if(r.hw[j] >= 0)
+               std::fprintf(f, ",%.0f", r.hw[j]);
+            else
+               std::fprintf(f, ",");
+         }
+         if(r.depth >= 0)
+            std::fprintf(f, ",%.0f,%.0f,%.0f,%.0f\n", r.xbuf_elems, r.xbuf_bytes, r.key_bytes, r.depth);
+         else
+            std::fprintf(f, ",,,,\n");
+      }
+   }
+
+   //Parses a line of a file written by write_json or write_csv
+   static bool parse_line(const char *line, bench_result &r)
+   {
+      char bench[64], case_name[64], algo[64];
+      int matched = 0;
+      while(*line == ' ' || *line == '\t')
+         ++line;
+      if(*line == '{'){
+         matched = std::sscanf( line, "{\"bench\":\"%63[^\"]\",\"case\":\"%63[^\"]\",\"n\":%lu,\"algo\":\"%63[^\"]\",\"runs\":%lu"
+                                      ",\"median_ns\":%lf,\"p10_ns\":%lf,\"p90_ns\":%lf,\"cmp\":%lf,\"cpy\":%lf"
+                              , bench, case_name, &r.n, algo, &r.runs, &r.median_ns, &r.p10_ns, &r.p90_ns, &r.cmp, &r.cpy);
+      }
+      else if(std::strncmp(line, "bench,", 6u) != 0){
+         matched = std::sscanf( line, "%63[^,],%63[^,],%lu,%63[^,],%lu,%lf,%lf,%lf,%lf,%lf"
+                              , bench, case_name, &r.n, algo, &r.runs, &r.median_ns, &r.p10_ns, &r.p90_ns, &r.cmp, &r.cpy);
+      }
+      if(matched != 10)
+         return false;
+      r.bench = bench;
+      r.case_name = case_name;
+      r.algo = algo;
+      return true;
+   }
+
+   int compare_baseline() const
+   {
+      std::FILE *f = std::fopen(m_opt.baseline.c_str(), "r");
+      if(!f){
+         std::fprintf(stderr, "Can't open baseline \"%s\"\n", m_opt.baseline.c_str());
+         return 1;
+      }
+      std::size_t regressions = 0, compared = 0;
+      char line[1024];
+      while(std::fgets(line, sizeof(line), f)){
+         bench_result base;
+         if(!parse_line(line, base))
+            continue;
+         for(std::size_t i = 0; i != m_results.size(); ++i){
+            const bench_result &r = m_results[i];
+            if(!r.same_case(base))
+               continue;
+            ++compared;
+            const bool slower = r.median_ns > base.median_ns*(1.0 + m_opt.threshold);
+            if(slower || r.cmp > base.cmp || r.cpy > base.cpy){
+               ++regressions;
+               std::fprintf( stderr, "REGRESSION %s %s N:%lu %s: median_ns %.0f -> %.0f, cmp %.0f -> %.0f, cpy %.0f -> %.0f\n"
+                           , r.bench.c_str(), r.case_name.c_str(), r.n, r.algo.c_str()
+                           , base.median_ns, r.median_ns, base.cmp, r.cmp, base.cpy, r.cpy);
+            }
+         }
+      }
+      std::fclose(f);
+      std::fprintf(stderr, "%u results compared with baseline, %u regressions\n", unsigned(compared), unsigned(regressions));
+      return regressions ? 1 : 0;
+   }
+
+   std::string m_bench;
+   bench_options m_opt;
+   boost::container::vector<bench_result> m_results;
+};
+
+#endif   //BOOST_MOVE_TEST_BENCH_REPORT_HPP
@@ -9,6 +9,14 @@
 //
 //////////////////////////////////////////////////////////////////////////////
 
+//Define it to record peak scratch memory and recursion depth of each engine
+//(the bookkeeping is done inside the timed runs)
+//#define BENCH_SORT_SCRATCH_STATS
+
+#ifdef BENCH_SORT_SCRATCH_STATS
+#define BOOST_MOVE_SCRATCH_STATS
+#endif
+
 #include <cstdlib>   //std::srand
 #include <algorithm> //std::stable_sort, std::make|sort_heap, std::random_shuffle
 #include <cstdio>    //std::printf
@@ -26,16 +34,11 @@ using boost::move_detail::nanosecond_type;
 
 #include "order_type.hpp"
 #include "random_shuffle.hpp"
+#include "bench_report.hpp"
 
-//#define BOOST_MOVE_ADAPTIVE_SORT_STATS
 //#define BOOST_MOVE_ADAPTIVE_SORT_INVARIANTS
-void print_stats(const char *str, boost::ulong_long_type element_count)
-{
-   std::printf( "%sCmp:%7.03f Cpy:%8.03f\n", str
-              , double(order_perf_type::num_compare)/double(element_count)
-              , double(order_perf_type::num_copy)/double(element_count) );
-}
-
+//Define it to print per-phase statistics of buffered adaptive sorts
+//#define BENCH_SORT_ADAPTIVE_STATS
 
 #include <boost/move/algo/adaptive_sort.hpp>
 #include <boost/move/algo/detail/merge_sort.hpp>
@@ -65,11 +68,34 @@ void generate_elements(boost::container::vector<T> &elements, std::size_t L, std
    }
 }
 
+std::size_t perf_type_num_copy()
+{  return std::size_t(order_perf_type::num_copy);  }
+
+void print_adaptive_stats(const boost::movelib::adaptive_stats &stats)
+{
+   const char *const phase_names[] = { "collect", "build  ", "combine", "final  " };
+   std::printf( "\n   keys: %u/%u block: %u intbuf: %u passes: %u xbuf: %d"
+              , unsigned(stats.keys_collected), unsigned(stats.keys_requested), unsigned(stats.block_length)
+              , unsigned(stats.internal_buffer_length), unsigned(stats.merge_passes), int(stats.used_xbuf));
+   for(std::size_t i = 0; i != boost::movelib::adaptive_phase_count; ++i){
+      std::printf( "\n   %s Cmp:%7.03f Cpy:%8.03f", phase_names[i]
+                 , double(stats.comparisons[i])/double(stats.length)
+                 , double(stats.moves[i])/double(stats.length));
+   }
+   std::printf("\n               ");
+}
+
 template<class T, class Compare>
 void adaptive_sort_buffered(T *elements, std::size_t element_count, Compare comp, std::size_t BufLen)
 {
    boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*BufLen]);
+   #ifdef BENCH_SORT_ADAPTIVE_STATS
+   boost::movelib::adaptive_stats stats(&perf_type_num_copy);
+   boost::movelib::adaptive_sort(elements, elements + element_count, comp, boost::move_detail::force_ptr<T*>(mem.get()), BufLen, stats);
+   print_adaptive_stats(stats);
+   #else
    boost::movelib::adaptive_sort(elements, elements + element_count, comp, boost::move_detail::force_ptr<T*>(mem.get()), BufLen);
+   #endif
 }
 
 template<class T, class Compare>
@@ -128,14 +154,8 @@ const char *AlgoNames [] = { "MergeSort      "
 BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxSort);
 
 template<class T>
-bool measure_algo(T *elements, std::size_t element_count, std::size_t alg, nanosecond_type &prev_clock)
+void run_algo(T *elements, std::size_t element_count, std::size_t alg)
 {
-   std::printf("%s ", AlgoNames[alg]);
-   order_perf_type::num_compare=0;
-   order_perf_type::num_copy=0;
-   order_perf_type::num_elements = element_count;
-   cpu_timer timer;
-   timer.resume();
    switch(alg)
    {
       case MergeSort:
@@ -197,17 +217,59 @@ bool measure_algo(T *elements, std::size_t element_count, std::size_t alg, nanos
 
       break;
    }
-   timer.stop();
+}
 
-   if(order_perf_type::num_elements == element_count){
+template<class T>
+bool measure_algo( const boost::container::vector<T> &original_elements, boost::container::vector<T> &elements
+                 , std::size_t NK, std::size_t alg, nanosecond_type &prev_clock, bench_report &report)
+{
+   std::size_t const element_count = original_elements.size();
+   bench_samples samples;
+   bool tmp_ok = true;
+   bool res = true;
+   for(std::size_t run = 0; run != report.runs(); ++run){
+      elements = original_elements;
+      order_perf_type::num_compare=0;
+      order_perf_type::num_copy=0;
+      order_perf_type::num_elements = element_count;
+      #ifdef BENCH_SORT_SCRATCH_STATS
+      boost::movelib::scratch_stats scratch;
+      #endif
+      cpu_timer timer(true);
+      timer.resume();
+      {
+         #ifdef BENCH_SORT_SCRATCH_STATS
+         boost::movelib::scoped_scratch_stats scratch_scope(scratch);
+         #endif
+         run_algo(elements.data(), element_count, alg);
+      }
+      timer.stop();
+      tmp_ok = tmp_ok && order_perf_type::num_elements == element_count;
+      samples.add(timer.elapsed(), order_perf_type::num_compare, order_perf_type::num_copy);
+      #ifdef BENCH_SORT_SCRATCH_STATS
+      samples.add_scratch(scratch);
+      #endif
+      res = res && is_order_type_ordered(elements.data(), element_count, alg != HeapSort && alg != PdQsort && alg != StdSort);
+   }
+   char case_name[32];
+   std::sprintf(case_name, "NK:%u", (unsigned)NK);
+   report.add(case_name, element_count, AlgoNames[alg], samples);
+   if(!report.is_text()){
+      return res && tmp_ok;
+   }
+
+   std::printf("%s ", AlgoNames[alg]);
+   if(tmp_ok){
       std::printf(" Tmp Ok ");
    } else{
       std::printf(" Tmp KO ");
    }
-   nanosecond_type new_clock = timer.elapsed().wall;
+   nanosecond_type new_clock = samples.median();
 
    //std::cout << "Cmp:" << order_perf_type::num_compare << " Cpy:" << order_perf_type::num_copy;   //for old compilers without ll size argument
-   std::printf("Cmp:%7.03f Cpy:%8.03f", double(order_perf_type::num_compare)/double(element_count), double(order_perf_type::num_copy)/double(element_count) );
+   std::printf("Cmp:%7.03f Cpy:%8.03f", double(samples.cmp)/double(element_count), double(samples.cpy)/double(element_count) );
+   samples.print_hw(element_count);
+   samples.print_scratch();
 
    double time = double(new_clock);
 
@@ -230,83 +292,68 @@ bool measure_algo(T *elements, std::size_t element_count, std::size_t alg, nanos
               , units
               , prev_clock ? double(new_clock)/double(prev_clock): 1.0);
    prev_clock = new_clock;
-   bool res = is_order_type_ordered(elements, element_count, alg != HeapSort && alg != PdQsort && alg != StdSort);
-   return res;
+   return res && tmp_ok;
 }
 
 template<class T>
-bool measure_all(std::size_t L, std::size_t NK)
+bool measure_all(std::size_t L, std::size_t NK, bench_report &report)
 {
    boost::container::vector<T> original_elements, elements;
    generate_elements(original_elements, L, NK);
-   std::printf("\n - - N: %u, NK: %u - -\n", (unsigned)L, (unsigned)NK);
+   if(report.is_text())
+      std::printf("\n - - N: %u, NK: %u - -\n", (unsigned)L, (unsigned)NK);
 
    nanosecond_type prev_clock = 0;
    nanosecond_type back_clock;
    bool res = true;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,MergeSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, MergeSort, prev_clock, report);
    back_clock = prev_clock;
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,StableSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, StableSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,PdQsort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, PdQsort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,StdSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, StdSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,HeapSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, HeapSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,QuartAdaptiveSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, QuartAdaptiveSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, StdQuartAdpSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, StdQuartAdpSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,Sqrt2AdaptiveSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, Sqrt2AdaptiveSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, StdSqrt2AdpSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, StdSqrt2AdpSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,SqrtAdaptiveSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, SqrtAdaptiveSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, StdSqrtAdpSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, StdSqrtAdpSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,SqrtHAdaptiveSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, SqrtHAdaptiveSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L, StdSqrtHAdpSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, StdSqrtHAdpSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,AdaptiveSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, AdaptiveSort, prev_clock, report);
    //
    prev_clock = back_clock;
-   elements = original_elements;
-   res = res && measure_algo(elements.data(), L,InplaceStableSort, prev_clock);
+   res = res && measure_algo(original_elements, elements, NK, InplaceStableSort, prev_clock, report);
    //
    //prev_clock = back_clock;
    //elements = original_elements;
-   //res = res && measure_algo(elements.data(), L,SlowStableSort, prev_clock);
+   //res = res && measure_algo(original_elements, elements, NK, SlowStableSort, prev_clock, report);
 
    if(!res)
       std::abort();
@@ -317,64 +364,69 @@ bool measure_all(std::size_t L, std::size_t NK)
 #define BENCH_SORT_SHORT
 #define BENCH_SORT_UNIQUE_VALUES
 
-int main()
+int main(int argc, char *argv[])
 {
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("sort", opt);
+
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(101,1);
-   measure_all<order_perf_type>(101,7);
-   measure_all<order_perf_type>(101,31);
+   measure_all<order_perf_type>(101,1, report);
+   measure_all<order_perf_type>(101,7, report);
+   measure_all<order_perf_type>(101,31, report);
    #endif
-   measure_all<order_perf_type>(101,0);
+   measure_all<order_perf_type>(101,0, report);
 
    //
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(1101,1);
-   measure_all<order_perf_type>(1001,7);
-   measure_all<order_perf_type>(1001,31);
-   measure_all<order_perf_type>(1001,127);
-   measure_all<order_perf_type>(1001,511);
+   measure_all<order_perf_type>(1101,1, report);
+   measure_all<order_perf_type>(1001,7, report);
+   measure_all<order_perf_type>(1001,31, report);
+   measure_all<order_perf_type>(1001,127, report);
+   measure_all<order_perf_type>(1001,511, report);
    #endif
-   measure_all<order_perf_type>(1001,0);
+   measure_all<order_perf_type>(1001,0, report);
    //
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(10001,65);
-   measure_all<order_perf_type>(10001,255);
-   measure_all<order_perf_type>(10001,1023);
-   measure_all<order_perf_type>(10001,4095);
+   measure_all<order_perf_type>(10001,65, report);
+   measure_all<order_perf_type>(10001,255, report);
+   measure_all<order_perf_type>(10001,1023, report);
+   measure_all<order_perf_type>(10001,4095, report);
    #endif
-   measure_all<order_perf_type>(10001,0);
+   measure_all<order_perf_type>(10001,0, report);
 
    //
    #ifdef NDEBUG
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(100001,511);
-   measure_all<order_perf_type>(100001,2047);
-   measure_all<order_perf_type>(100001,8191);
-   measure_all<order_perf_type>(100001,32767);
+   measure_all<order_perf_type>(100001,511, report);
+   measure_all<order_perf_type>(100001,2047, report);
+   measure_all<order_perf_type>(100001,8191, report);
+   measure_all<order_perf_type>(100001,32767, report);
    #endif
-   measure_all<order_perf_type>(100001,0);
+   measure_all<order_perf_type>(100001,0, report);
 
    //
    #ifndef BENCH_SORT_SHORT
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(1000001, 8192);
-   measure_all<order_perf_type>(1000001, 32768);
-   measure_all<order_perf_type>(1000001, 131072);
-   measure_all<order_perf_type>(1000001, 524288);
+   measure_all<order_perf_type>(1000001,8192, report);
+   measure_all<order_perf_type>(1000001,32768, report);
+   measure_all<order_perf_type>(1000001,131072, report);
+   measure_all<order_perf_type>(1000001,524288, report);
    #endif
-   measure_all<order_perf_type>(1000001,0);
+   measure_all<order_perf_type>(1000001,0, report);
 
    #ifndef BENCH_SORT_UNIQUE_VALUES
-   measure_all<order_perf_type>(10000001, 65536);
-   measure_all<order_perf_type>(10000001, 262144);
-   measure_all<order_perf_type>(10000001, 1048576);
-   measure_all<order_perf_type>(10000001, 4194304);
+   measure_all<order_perf_type>(10000001,65536, report);
+   measure_all<order_perf_type>(10000001,262144, report);
+   measure_all<order_perf_type>(10000001,1048576, report);
+   measure_all<order_perf_type>(10000001,4194304, report);
    #endif
-   measure_all<order_perf_type>(1000001,0);
+   measure_all<order_perf_type>(1000001,0, report);
    #endif   //#ifndef BENCH_SORT_SHORT
    #endif   //NDEBUG
 
-   //measure_all<order_perf_type>(100000001,0);
+   //measure_all<order_perf_type>(100000001,0, report);
 
-   return 0;
+   return report.finish();
 }
@@ -0,0 +1,377 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Runs every sorting engine against adversarial and real-world input shapes
+//and reports time, comparisons and copies per element.
+
+#include <cstdlib>   //std::srand, std::abort
+#include <cstdio>    //std::printf
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/algo/detail/heap_sort.hpp>
+#include <boost/move/core.hpp>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+
+enum Pattern
+{
+   Random,
+   Sorted,
+   Reversed,
+   OrganPipe,
+   Sawtooth,
+   FewUnique,
+   RandomSortedTail,
+   PdqKiller,
+   Zipf,
+   MaxPattern
+};
+
+const char *PatternNames [] = { "Random      "
+                              , "Sorted      "
+                              , "Reversed    "
+                              , "OrganPipe   "
+                              , "Sawtooth    "
+                              , "FewUnique   "
+                              , "RndSortTail "
+                              , "PdqKiller   "
+                              , "Zipf        "
+                              };
+
+BOOST_MOVE_STATIC_ASSERT((sizeof(PatternNames)/sizeof(*PatternNames)) == MaxPattern);
+
+enum AlgoType
+{
+   AdaptiveSort,
+   SqrtHAdaptiveSort,
+   SqrtAdaptiveSort,
+   Sqrt2AdaptiveSort,
+   QuartAdaptiveSort,
+   HalfAdaptiveSort,
+   PdQsort,
+   HeapSort,
+   MergeSort,
+   InplaceStableSort,
+   MaxSort
+};
+
+const char *AlgoNames [] = { "AdaptSort      "
+                           , "SqrtHAdaptSort "
+                           , "SqrtAdaptSort  "
+                           , "Sqrt2AdaptSort "
+                           , "QuartAdaptSort "
+                           , "HalfAdaptSort  "
+                           , "PdQsort        "
+                           , "HeapSort       "
+                           , "MergeSort      "
+                           , "InplStableSort "
+                           };
+
+BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxSort);
+
+//McIlroy's "A Killer Adversary for Quicksort": values are decided lazily
+//while pdqsort runs, always making the pivot candidate compare low.
+//The final values are an input that triggers pdqsort's worst partitions.
+struct killer_state
+{
+   killer_state(std::size_t n)
+      : vals(n, n), gas(n), nsolid(0), candidate(0)
+   {}
+
+   void freeze(std::size_t x)
+   {  vals[x] = nsolid++;  }
+
+   boost::container::vector<std::size_t> vals;
+   std::size_t gas;
+   std::size_t nsolid;
+   std::size_t candidate;
+};
+
+struct killer_less
+{
+   explicit killer_less(killer_state &st)
+      : m_st(&st)
+   {}
+
+   bool operator()(std::size_t x, std::size_t y) const
+   {
+      killer_state &st = *m_st;
+      if(st.vals[x] == st.gas && st.vals[y] == st.gas){
+         st.freeze(x == st.candidate ? x : y);
+      }
+      if(st.vals[x] == st.gas){
+         st.candidate = x;
+      }
+      else if(st.vals[y] == st.gas){
+         st.candidate = y;
+      }
+      return st.vals[x] < st.vals[y];
+   }
+
+   killer_state *m_st;
+};
+
+void generate_pdq_killer(boost::container::vector<std::size_t> &keys, std::size_t L)
+{
+   killer_state st(L);
+   boost::container::vector<std::size_t> idx(L);
+   for(std::size_t i = 0; i != L; ++i){
+      idx[i] = i;
+   }
+   boost::movelib::pdqsort(idx.begin(), idx.end(), killer_less(st));
+   for(std::size_t i = 0; i != L; ++i){
+      keys[i] = st.vals[i] == st.gas ? st.nsolid : st.vals[i];
+   }
+}
+
+//Keys follow a Zipf (s = 1) distribution over L/8+1 distinct values
+void generate_zipf(boost::container::vector<std::size_t> &keys, std::size_t L)
+{
+   std::size_t const nk = L/8u + 1u;
+   boost::container::vector<double> cdf(nk);
+   double sum = 0.0;
+   for(std::size_t i = 0; i != nk; ++i){
+      sum += 1.0/double(i+1u);
+      cdf[i] = sum;
+   }
+   for(std::size_t i = 0; i != L; ++i){
+      double const u = (double(ullrand() >> 11u)/9007199254740992.0)*sum;
+      std::size_t lo = 0, hi = nk-1u;
+      while(lo < hi){
+         std::size_t const mid = lo + (hi-lo)/2u;
+         if(cdf[mid] < u) lo = mid+1u;
+         else             hi = mid;
+      }
+      keys[i] = lo;
+   }
+}
+
+void generate_keys(boost::container::vector<std::size_t> &keys, std::size_t L, Pattern p)
+{
+   keys.resize(L);
+   std::srand(0);
+   for(std::size_t i = 0; i != L; ++i){
+      keys[i] = i;
+   }
+   switch(p){
+      case Random:
+         ::random_shuffle(keys.data(), keys.data() + L);
+      break;
+      case Sorted:
+      break;
+      case Reversed:
+         for(std::size_t i = 0; i != L; ++i){
+            keys[i] = L - i - 1u;
+         }
+      break;
+      case OrganPipe:
+         for(std::size_t i = 0; i != L; ++i){
+            keys[i] = i < L/2u ? i : L - i - 1u;
+         }
+      break;
+      case Sawtooth:
+      {
+         std::size_t const tooth = L/8u + 1u;
+         for(std::size_t i = 0; i != L; ++i){
+            keys[i] = i % tooth;
+         }
+      }
+      break;
+      case FewUnique:
+         for(std::size_t i = 0; i != L; ++i){
+            keys[i] = i % 16u;
+         }
+         ::random_shuffle(keys.data(), keys.data() + L);
+      break;
+      case RandomSortedTail:
+      {
+         //90% of random keys followed by an ordered run
+         std::size_t const head = L - L/10u;
+         ::random_shuffle(keys.data(), keys.data() + L);
+         boost::movelib::pdqsort(keys.data() + head, keys.data() + L, order_type_less());
+      }
+      break;
+      case PdqKiller:
+         generate_pdq_killer(keys, L);
+      break;
+      case Zipf:
+         generate_zipf(keys, L);
+      break;
+      default:
+      break;
+   }
+}
+
+template<class T>
+void generate_elements(boost::container::vector<T> &elements, const boost::container::vector<std::size_t> &keys)
+{
+   std::size_t const L = keys.size();
+   elements.resize(L);
+   boost::movelib::unique_ptr<std::size_t[]> key_reps(new std::size_t[L]);
+   for (std::size_t i = 0; i < L; ++i) {
+      key_reps[i] = 0;
+   }
+   for (std::size_t i = 0; i < L; ++i) {
+      elements[i].key = keys[i];
+      elements[i].val = key_reps[keys[i]]++;
+   }
+}
+
+template<class T, class Compare>
+void adaptive_sort_buffered(T *elements, std::size_t element_count, Compare comp, std::size_t BufLen)
+{
+   boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*BufLen]);
+   boost::movelib::adaptive_sort(elements, elements + element_count, comp, boost::move_detail::force_ptr<T*>(mem.get()), BufLen);
+}
+
+template<class T, class Compare>
+void merge_sort_buffered(T *elements, std::size_t element_count, Compare comp)
+{
+   boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*((element_count+1)/2)]);
+   boost::movelib::merge_sort(elements, elements + element_count, comp, boost::move_detail::force_ptr<T*>(mem.get()));
+}
+
+template<class T>
+void run_algo(T *elements, std::size_t element_count, std::size_t alg)
+{
+   using boost::movelib::detail_adaptive::ceil_sqrt_multiple;
+   switch(alg)
+   {
+      case AdaptiveSort:
+         boost::movelib::adaptive_sort(elements, elements+element_count, order_type_less());
+      break;
+      case SqrtHAdaptiveSort:
+         adaptive_sort_buffered(elements, element_count, order_type_less(), ceil_sqrt_multiple(element_count)/2+1);
+      break;
+      case SqrtAdaptiveSort:
+         adaptive_sort_buffered(elements, element_count, order_type_less(), ceil_sqrt_multiple(element_count));
+      break;
+      case Sqrt2AdaptiveSort:
+         adaptive_sort_buffered(elements, element_count, order_type_less(), 2*ceil_sqrt_multiple(element_count));
+      break;
+      case QuartAdaptiveSort:
+         adaptive_sort_buffered(elements, element_count, order_type_less(), (element_count-1)/4+1);
+      break;
+      case HalfAdaptiveSort:
+         adaptive_sort_buffered(elements, element_count, order_type_less(), (element_count-1)/2+1);
+      break;
+      case PdQsort:
+         boost::movelib::pdqsort(elements,elements+element_count,order_type_less());
+      break;
+      case HeapSort:
+         boost::movelib::heap_sort(elements, elements+element_count, order_type_less());
+      break;
+      case MergeSort:
+         merge_sort_buffered(elements, element_count, order_type_less());
+      break;
+      case InplaceStableSort:
+         boost::movelib::inplace_stable_sort(elements, elements+element_count, order_type_less());
+      break;
+   }
+}
+
+template<class T>
+bool measure_algo( const boost::container::vector<T> &original_elements, boost::container::vector<T> &elements
+                 , Pattern p, std::size_t alg, bench_report &report)
+{
+   std::size_t const element_count = original_elements.size();
+   bench_samples samples;
+   bool res = true;
+   for(std::size_t run = 0; run != report.runs(); ++run){
+      elements = original_elements;
+      order_perf_type::num_compare=0;
+      order_perf_type::num_copy=0;
+      order_perf_type::num_elements = element_count;
+      cpu_timer timer(true);
+      timer.start();
+      run_algo(elements.data(), element_count, alg);
+      timer.stop();
+      if(order_perf_type::num_elements != element_count){
+         std::printf(" %s Tmp KO ", AlgoNames[alg]);
+         return false;
+      }
+      samples.add(timer.elapsed(), order_perf_type::num_compare, order_perf_type::num_copy);
+      res = res && is_order_type_ordered(elements.data(), element_count, alg != HeapSort && alg != PdQsort);
+   }
+   report.add(PatternNames[p], element_count, AlgoNames[alg], samples);
+
+   if(report.is_text()){
+      double const n = double(element_count);
+      std::printf( "   %s ns/elem:%9.03f Cmp/elem:%8.03f Cpy/elem:%8.03f", AlgoNames[alg]
+                 , double(samples.median())/n, double(samples.cmp)/n, double(samples.cpy)/n);
+      samples.print_hw(element_count);
+      std::printf("\n");
+   }
+   return res;
+}
+
+template<class T>
+bool measure_pattern(std::size_t L, Pattern p, bench_report &report)
+{
+   boost::container::vector<std::size_t> keys;
+   generate_keys(keys, L, p);
+   boost::container::vector<T> original_elements, elements;
+   generate_elements(original_elements, keys);
+   if(report.is_text())
+      std::printf("\n - - %s N: %u - -\n", PatternNames[p], (unsigned)L);
+
+   bool res = true;
+   for(std::size_t alg = 0; alg != MaxSort; ++alg){
+      res = res && measure_algo(original_elements, elements, p, alg, report);
+   }
+   if(!res)
+      std::abort();
+   return res;
+}
+
+template<class T>
+void measure_all(std::size_t L, bench_report &report)
+{
+   for(std::size_t p = 0; p != MaxPattern; ++p){
+      measure_pattern<T>(L, Pattern(p), report);
+   }
+}
+
+//Undef it to run the long test
+#define BENCH_SORT_DISTRIBUTION_SHORT
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("sort_distribution", opt);
+
+   measure_all<order_perf_type>(1001, report);
+
+   #ifdef NDEBUG
+   measure_all<order_perf_type>(100001, report);
+   #ifndef BENCH_SORT_DISTRIBUTION_SHORT
+   measure_all<order_perf_type>(1000001, report);
+   measure_all<order_perf_type>(10000001, report);
+   #endif   //BENCH_SORT_DISTRIBUTION_SHORT
+   #endif   //NDEBUG
+
+   return report.finish();
+}
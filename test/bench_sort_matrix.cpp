@@ -0,0 +1,311 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Sweeps sorting engines over element sizes and move policies and prints
+//a crossover table with the fastest stable and unstable engine for each
+//kind of record.
+
+#include <cstdlib>   //std::srand, std::abort
+#include <cstdio>    //std::printf
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/core.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/algo/detail/heap_sort.hpp>
+
+#include "random_shuffle.hpp"
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+
+struct bench_counters
+{
+   static boost::ulong_long_type num_compare;
+   static boost::ulong_long_type num_move;
+};
+
+boost::ulong_long_type bench_counters::num_compare = 0;
+boost::ulong_long_type bench_counters::num_move = 0;
+
+//Fills the record up to the requested size. Empty when the key
+//already has the requested size (empty base optimization).
+template<std::size_t N>
+struct bench_payload
+{
+   unsigned char data[N];
+};
+
+template<>
+struct bench_payload<0>
+{};
+
+//Trivially copyable record. Moves can't be counted
+struct trivial_policy
+{  static const char *name() { return "trivial"; }  };
+
+//Non-trivial but non-throwing moves that copy the whole record
+struct nothrow_policy
+{  static const char *name() { return "nothrow"; }  };
+
+//Small handle owning the payload in the heap, like unique_ptr or string
+struct heap_policy
+{  static const char *name() { return "heap"; }  };
+
+template<std::size_t Size, class Policy>
+class bench_record;
+
+template<std::size_t Size>
+class bench_record<Size, trivial_policy>
+   : public bench_payload<Size - sizeof(std::size_t)>
+{
+   public:
+   std::size_t key;
+};
+
+template<std::size_t Size>
+class bench_record<Size, nothrow_policy>
+   : public bench_payload<Size - sizeof(std::size_t)>
+{
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(bench_record)
+   typedef bench_payload<Size - sizeof(std::size_t)> payload_t;
+
+   public:
+   std::size_t key;
+
+   bench_record()
+      : payload_t(), key()
+   {}
+
+   bench_record(BOOST_RV_REF(bench_record) other) BOOST_NOEXCEPT
+      : payload_t(other), key(other.key)
+   {  ++bench_counters::num_move;  }
+
+   bench_record & operator=(BOOST_RV_REF(bench_record) other) BOOST_NOEXCEPT
+   {
+      static_cast<payload_t&>(*this) = static_cast<const payload_t&>(other);
+      key = other.key;
+      ++bench_counters::num_move;
+      return *this;
+   }
+};
+
+template<std::size_t Size>
+class bench_record<Size, heap_policy>
+{
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(bench_record)
+
+   public:
+   std::size_t key;
+
+   bench_record()
+      : key(), m_payload(new unsigned char[Size])
+   {}
+
+   ~bench_record()
+   {  delete [] m_payload;  }
+
+   bench_record(BOOST_RV_REF(bench_record) other) BOOST_NOEXCEPT
+      : key(other.key), m_payload(other.m_payload)
+   {
+      other.m_payload = 0;
+      ++bench_counters::num_move;
+   }
+
+   bench_record & operator=(BOOST_RV_REF(bench_record) other) BOOST_NOEXCEPT
+   {
+      if(this != &other){
+         delete [] m_payload;
+         m_payload = other.m_payload;
+         other.m_payload = 0;
+         key = other.key;
+      }
+      ++bench_counters::num_move;
+      return *this;
+   }
+
+   private:
+   unsigned char *m_payload;
+};
+
+struct bench_record_less
+{
+   template<class T>
+   bool operator()(const T &a, const T &b) const
+   {
+      ++bench_counters::num_compare;
+      return a.key < b.key;
+   }
+};
+
+enum AlgoType
+{
+   AdaptiveSort,
+   SqrtAdaptiveSort,
+   MergeSort,
+   PdQsort,
+   HeapSort,
+   MaxSort
+};
+
+const char *AlgoNames [] = { "AdaptSort"
+                           , "SqrtAdaptSort"
+                           , "MergeSort"
+                           , "PdQsort"
+                           , "HeapSort"
+                           };
+
+BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxSort);
+
+inline bool is_stable_algo(std::size_t alg)
+{  return alg == AdaptiveSort || alg == SqrtAdaptiveSort || alg == MergeSort;  }
+
+template<class T>
+void run_algo(T *elements, std::size_t element_count, std::size_t alg)
+{
+   switch(alg)
+   {
+      case AdaptiveSort:
+         boost::movelib::adaptive_sort(elements, elements + element_count, bench_record_less());
+      break;
+      case SqrtAdaptiveSort:
+      {
+         std::size_t const buf_len = 2*boost::movelib::detail_adaptive::ceil_sqrt_multiple(element_count);
+         boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*buf_len]);
+         boost::movelib::adaptive_sort( elements, elements + element_count, bench_record_less()
+                                      , boost::move_detail::force_ptr<T*>(mem.get()), buf_len);
+      }
+      break;
+      case MergeSort:
+      {
+         boost::movelib::unique_ptr<char[]> mem(new char[sizeof(T)*((element_count+1)/2)]);
+         boost::movelib::merge_sort(elements, elements + element_count, bench_record_less(), boost::move_detail::force_ptr<T*>(mem.get()));
+      }
+      break;
+      case PdQsort:
+         boost::movelib::pdqsort(elements, elements + element_count, bench_record_less());
+      break;
+      case HeapSort:
+         boost::movelib::heap_sort(elements, elements + element_count, bench_record_less());
+      break;
+   }
+}
+
+template<class T>
+bool is_sorted_by_key(const T *elements, std::size_t element_count)
+{
+   for(std::size_t i = 1; i < element_count; ++i){
+      if(elements[i].key < elements[i-1].key)
+         return false;
+   }
+   return true;
+}
+
+template<std::size_t Size, class Policy>
+void measure_record(const boost::container::vector<std::size_t> &keys, bench_report &report)
+{
+   typedef bench_record<Size, Policy> record_t;
+   std::size_t const element_count = keys.size();
+   char case_name[32];
+   std::sprintf(case_name, "%uB/%s", (unsigned)Size, Policy::name());
+
+   double ns_per_elem[MaxSort];
+   for(std::size_t alg = 0; alg != MaxSort; ++alg){
+      bench_samples samples;
+      for(std::size_t run = 0; run != report.runs(); ++run){
+         boost::container::vector<record_t> elements(element_count);
+         for(std::size_t i = 0; i != element_count; ++i){
+            elements[i].key = keys[i];
+         }
+         bench_counters::num_compare = 0;
+         bench_counters::num_move = 0;
+         cpu_timer timer(true);
+         timer.start();
+         run_algo(elements.data(), element_count, alg);
+         timer.stop();
+         samples.add(timer.elapsed(), bench_counters::num_compare, bench_counters::num_move);
+         if(!is_sorted_by_key(elements.data(), element_count)){
+            std::printf("\n Ord KO !!!! %s %s\n", case_name, AlgoNames[alg]);
+            std::abort();
+         }
+      }
+      report.add(case_name, element_count, AlgoNames[alg], samples);
+      ns_per_elem[alg] = double(samples.median())/double(element_count);
+   }
+
+   if(report.is_text()){
+      std::size_t best = 0, best_stable = AdaptiveSort;
+      std::printf("%4uB %-7s |", (unsigned)Size, Policy::name());
+      for(std::size_t alg = 0; alg != MaxSort; ++alg){
+         std::printf(" %13.02f", ns_per_elem[alg]);
+         if(ns_per_elem[alg] < ns_per_elem[best])
+            best = alg;
+         if(is_stable_algo(alg) && ns_per_elem[alg] < ns_per_elem[best_stable])
+            best_stable = alg;
+      }
+      std::printf(" | %-13s %-13s\n", AlgoNames[best_stable], AlgoNames[best]);
+   }
+}
+
+template<std::size_t Size>
+void measure_size(const boost::container::vector<std::size_t> &keys, bench_report &report)
+{
+   measure_record<Size, trivial_policy>(keys, report);
+   measure_record<Size, nothrow_policy>(keys, report);
+   measure_record<Size, heap_policy>(keys, report);
+}
+
+void measure_all(std::size_t L, bench_report &report)
+{
+   boost::container::vector<std::size_t> keys(L);
+   for(std::size_t i = 0; i != L; ++i){
+      keys[i] = i;
+   }
+   std::srand(0);
+   ::random_shuffle(keys.data(), keys.data() + L);
+
+   if(report.is_text()){
+      std::printf("\n - - N: %u, ns/elem - -\n", (unsigned)L);
+      std::printf("      record   |");
+      for(std::size_t alg = 0; alg != MaxSort; ++alg){
+         std::printf(" %13s", AlgoNames[alg]);
+      }
+      std::printf(" | %-13s %-13s\n", "best stable", "best");
+   }
+   measure_size<8>(keys, report);
+   measure_size<16>(keys, report);
+   measure_size<32>(keys, report);
+   measure_size<64>(keys, report);
+   measure_size<128>(keys, report);
+   measure_size<256>(keys, report);
+   measure_size<512>(keys, report);
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("sort_matrix", opt);
+
+   measure_all(1001, report);
+   #ifdef NDEBUG
+   measure_all(100001, report);
+   #endif   //NDEBUG
+
+   return report.finish();
+}
@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Sorts many small fixed-size arrays (feature vectors, top-k buffers) with
+//insertion_sort, pdqsort and the sorting networks of static_sort.hpp
+
+#include <cstdio>    //std::printf
+#include <cstdlib>   //std::rand
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/algo/static_sort.hpp>
+#include <boost/move/algo/detail/insertion_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include "order_type.hpp"
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+
+struct less_value
+{
+   template<class T>
+   bool operator()(const T &a, const T &b) const
+   {  return a < b;  }
+};
+
+enum AlgoType
+{
+   InsertionSort,
+   PdqSort,
+   StaticSort,
+   StaticStableSort,
+   MaxSort
+};
+
+const char *AlgoNames [] = { "insertion_sort     "
+                           , "pdqsort            "
+                           , "static_sort        "
+                           , "static_stable_sort "
+                           };
+
+BOOST_MOVE_STATIC_ASSERT((sizeof(AlgoNames)/sizeof(*AlgoNames)) == MaxSort);
+
+template<std::size_t N, class T>
+void sort_arrays(T *first, std::size_t arrays, std::size_t alg)
+{
+   for(T *const last = first + arrays*N; first != last; first += N){
+      switch(alg)
+      {
+         case InsertionSort:
+            boost::movelib::insertion_sort(first, first + N, less_value());
+         break;
+         case PdqSort:
+            boost::movelib::pdqsort(first, first + N, less_value());
+         break;
+         case StaticSort:
+            boost::movelib::static_sort<N>(first, less_value());
+         break;
+         case StaticStableSort:
+            boost::movelib::static_stable_sort<N>(first, less_value());
+         break;
+      }
+   }
+}
+
+template<class T>
+struct type_name;
+
+template<>
+struct type_name<int>
+{  static const char *get() { return "int"; }  };
+
+template<>
+struct type_name<double>
+{  static const char *get() { return "double"; }  };
+
+template<>
+struct type_name<order_perf_type>
+{  static const char *get() { return "order_perf_type"; }  };
+
+void init_value(int &v)
+{  v = std::rand();  }
+
+void init_value(double &v)
+{  v = double(std::rand())/3.0;  }
+
+void init_value(order_perf_type &v)
+{  v.key = std::size_t(std::rand()); v.val = 0u;  }
+
+template<std::size_t N, class T>
+void measure(std::size_t element_count, bench_report &report)
+{
+   const std::size_t arrays = element_count/N;
+   boost::container::vector<T> original(arrays*N), elements;
+   std::srand(0);
+   for(std::size_t i = 0; i != original.size(); ++i)
+      init_value(original[i]);
+
+   char case_name[64];
+   std::sprintf(case_name, "%s/N:%u", type_name<T>::get(), unsigned(N));
+   if(report.is_text())
+      std::printf("\n - - %s, %u arrays - -\n", case_name, unsigned(arrays));
+
+   nanosecond_type prev_clock = 0;
+   for(std::size_t alg = 0; alg != MaxSort; ++alg){
+      bench_samples samples;
+      for(std::size_t run = 0; run != report.runs(); ++run){
+         elements = original;
+         cpu_timer timer(true);
+         timer.resume();
+         sort_arrays<N>(elements.data(), arrays, alg);
+         timer.stop();
+         samples.add(timer.elapsed(), 0u, 0u);
+      }
+      for(std::size_t i = 0; i != arrays; ++i){
+         if(!boost::movelib::is_sorted(elements.data() + i*N, elements.data() + (i + 1u)*N, less_value())){
+            std::printf("\n Ord KO !!!!");
+            std::abort();
+         }
+      }
+      report.add(case_name, arrays*N, AlgoNames[alg], samples);
+      if(report.is_text()){
+         const nanosecond_type new_clock = samples.median();
+         std::printf("%s %6.02f ns/array (%6.02f)", AlgoNames[alg]
+                    , double(new_clock)/double(arrays), prev_clock ? double(new_clock)/double(prev_clock) : 1.0);
+         samples.print_hw(arrays*N);
+         std::printf("\n");
+         if(!prev_clock)
+            prev_clock = new_clock;
+      }
+   }
+}
+
+template<class T>
+void measure_type(std::size_t element_count, bench_report &report)
+{
+   measure<4, T>(element_count, report);
+   measure<8, T>(element_count, report);
+   measure<16, T>(element_count, report);
+   measure<32, T>(element_count, report);
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("static_sort", opt);
+   #ifdef NDEBUG
+   const std::size_t element_count = 1u << 20u;
+   #else
+   const std::size_t element_count = 1u << 12u;
+   #endif
+   measure_type<int>(element_count, report);
+   measure_type<double>(element_count, report);
+   measure_type<order_perf_type>(element_count, report);
+   return report.finish();
+}
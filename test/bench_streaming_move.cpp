@@ -0,0 +1,215 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Effect of bulk moves on a co-located cache-sensitive workload (the "victim"): a random
+//pointer chase through a working set that fits in the last level cache. The victim runs
+//in another thread while big arrays are moved with boost::move (normal stores, which evict
+//the victim's working set) or boost::movelib::streaming_move (non-temporal stores).
+//Without <thread> the victim runs after each move.
+
+#include <cstdio>    //std::printf
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/algo/streaming_move.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#define BENCH_STREAMING_CONCURRENT_VICTIM
+#include <atomic>
+#include <thread>
+#endif
+
+#include "random_shuffle.hpp"
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::cpu_times;
+using boost::move_detail::nanosecond_type;
+
+//Steps of the pointer chase per measured pass
+const std::size_t victim_pass_steps = 100000u;
+
+//Random cyclic permutation: next[i] is the index visited after i
+void build_chase(boost::container::vector<std::size_t> &next, std::size_t n)
+{
+   boost::container::vector<std::size_t> order(n);
+   for(std::size_t i = 0; i != n; ++i)
+      order[i] = i;
+   ::random_shuffle(order.begin() + 1, order.end());
+   next.resize(n);
+   for(std::size_t i = 0; i != n; ++i)
+      next[order[i]] = order[(i + 1u) % n];
+}
+
+//Returns the elapsed time of a pass
+nanosecond_type victim_pass(const boost::container::vector<std::size_t> &next, std::size_t &pos)
+{
+   cpu_timer timer(true);
+   timer.resume();
+   std::size_t p = pos;
+   for(std::size_t i = 0; i != victim_pass_steps; ++i)
+      p = next[p];
+   pos = p;
+   timer.stop();
+   return timer.elapsed().wall;
+}
+
+void add_victim_sample(bench_samples &samples, nanosecond_type ns)
+{
+   cpu_times t;
+   t.clear();
+   t.wall = ns;
+   samples.add(t, 0u, 0u);
+}
+
+enum store_type { normal_stores, streaming_stores };
+
+const char *const store_names[] = { "normal_stores", "streaming_stores" };
+
+void move_array(store_type st, const double *src, double *dst, std::size_t n)
+{
+   if(st == streaming_stores)
+      boost::movelib::streaming_move(src, src + n, dst, 0u);
+   else
+      boost::move(src, src + n, dst);
+}
+
+#if defined(BENCH_STREAMING_CONCURRENT_VICTIM)
+
+class victim_thread
+{
+   public:
+   victim_thread(const boost::container::vector<std::size_t> &next, bench_samples &samples)
+      : m_next(&next), m_samples(&samples), m_stop(false), m_passes(0u), m_pos(0u), m_thread()
+   {}
+
+   void start()
+   {  m_thread = std::thread(&victim_thread::run, this);  }
+
+   void stop()
+   {
+      m_stop = true;
+      m_thread.join();
+   }
+
+   std::size_t pos() const
+   {  return m_pos;  }
+
+   std::size_t passes() const
+   {  return m_passes;  }
+
+   private:
+   void run()
+   {
+      while(!m_stop){
+         add_victim_sample(*m_samples, victim_pass(*m_next, m_pos));
+         ++m_passes;
+      }
+   }
+
+   const boost::container::vector<std::size_t> *m_next;
+   bench_samples *m_samples;
+   std::atomic<bool> m_stop;
+   std::atomic<std::size_t> m_passes;
+   std::size_t m_pos;
+   std::thread m_thread;
+};
+
+bool enough_victim_passes(const victim_thread &victim, std::size_t runs)
+{  return victim.passes() >= runs;  }
+
+#else
+
+bool enough_victim_passes(int, std::size_t)
+{  return true;  }
+
+#endif
+
+void measure(std::size_t n, std::size_t victim_bytes, store_type st, bench_report &report)
+{
+   boost::container::vector<std::size_t> next;
+   build_chase(next, victim_bytes/sizeof(std::size_t));
+   boost::container::vector<double> src(n, 1.0), dst(n, 0.0);
+   bench_samples move_samples, victim_samples;
+   std::size_t pos = 0u;
+   //Warm up the victim's working set
+   victim_pass(next, pos);
+
+   #if defined(BENCH_STREAMING_CONCURRENT_VICTIM)
+   victim_thread victim(next, victim_samples);
+   victim.start();
+   #else
+   const int victim = 0;
+   #endif
+   //With concurrent victims, moves continue until the victim has been measured enough times
+   for(std::size_t run_i = 0; run_i < report.runs() || !enough_victim_passes(victim, report.runs()); ++run_i){
+      cpu_timer timer(true);
+      timer.resume();
+      move_array(st, src.data(), dst.data(), n);
+      timer.stop();
+      move_samples.add(timer.elapsed(), 0u, 0u);
+      #if !defined(BENCH_STREAMING_CONCURRENT_VICTIM)
+      add_victim_sample(victim_samples, victim_pass(next, pos));
+      #endif
+   }
+   #if defined(BENCH_STREAMING_CONCURRENT_VICTIM)
+   victim.stop();
+   pos = victim.pos();
+   #endif
+
+   report.add("move", n, store_names[st], move_samples);
+   report.add("victim_pass", n, store_names[st], victim_samples);
+   if(report.is_text()){
+      const double secs = double(move_samples.median())/1e9;
+      std::printf("%-17s move %8.02f GB/s, victim %6.02f ns/access (checksum %u)\n", store_names[st]
+                 , double(n*sizeof(double))/secs/1e9
+                 , double(victim_samples.median())/double(victim_pass_steps), unsigned(pos));
+   }
+}
+
+void measure_all(std::size_t n, std::size_t victim_bytes, bench_report &report)
+{
+   if(report.is_text())
+      std::printf("\n - - N: %u (%u MB), victim: %u KB - -\n"
+                 , unsigned(n), unsigned(n*sizeof(double) >> 20u), unsigned(victim_bytes >> 10u));
+   //Victim alone
+   {
+      boost::container::vector<std::size_t> next;
+      build_chase(next, victim_bytes/sizeof(std::size_t));
+      std::size_t pos = 0u;
+      victim_pass(next, pos);
+      bench_samples samples;
+      for(std::size_t run_i = 0; run_i != report.runs(); ++run_i)
+         add_victim_sample(samples, victim_pass(next, pos));
+      report.add("victim_pass", n, "idle", samples);
+      if(report.is_text()){
+         std::printf("%-17s                    victim %6.02f ns/access (checksum %u)\n", "idle"
+                    , double(samples.median())/double(victim_pass_steps), unsigned(pos));
+      }
+   }
+   measure(n, victim_bytes, normal_stores, report);
+   measure(n, victim_bytes, streaming_stores, report);
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("streaming_move", opt);
+   measure_all(100001, 256u << 10u, report);
+   #ifdef NDEBUG
+   measure_all(8000001, 2u << 20u, report);
+   measure_all(32000001, 4u << 20u, report);
+   #endif
+   return report.finish();
+}
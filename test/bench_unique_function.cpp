@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Task queue throughput: move-only tasks are pushed to a queue and then executed.
+//unique_function stores them directly. Without it, they are boxed in a unique_ptr,
+//either behind a virtual interface or wrapped in a std::function.
+
+#include <cstdio>    //std::printf
+#include <boost/container/vector.hpp>  //boost::container::vector
+
+#include <boost/config.hpp>
+#include <boost/move/unique_function.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/make_unique.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+#include <functional>
+#endif
+
+#include "bench_report.hpp"
+
+using boost::move_detail::cpu_timer;
+using boost::move_detail::nanosecond_type;
+
+//A move-only task, e.g. owning a file descriptor
+class task
+{
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(task)
+
+   public:
+   task(int fd, std::size_t *sum) : m_fd(fd), m_sum(sum) {}
+   task(BOOST_RV_REF(task) t) BOOST_NOEXCEPT : m_fd(t.m_fd), m_sum(t.m_sum) { t.m_fd = 0; }
+   task& operator=(BOOST_RV_REF(task) t) BOOST_NOEXCEPT
+   {  m_fd = t.m_fd; m_sum = t.m_sum; t.m_fd = 0; return *this;  }
+   void operator()() { *m_sum += std::size_t(m_fd); }
+
+   private:
+   int m_fd;
+   std::size_t *m_sum;
+};
+
+namespace boost{
+
+template<>
+struct has_nothrow_move<task>
+{
+   static const bool value = true;
+};
+
+}  //namespace boost{
+
+//Boxing behind a virtual interface
+struct task_base
+{
+   virtual ~task_base(){}
+   virtual void run() = 0;
+};
+
+struct task_box : task_base
+{
+   explicit task_box(BOOST_RV_REF(task) t) : m_t(boost::move(t)) {}
+   virtual void run() { m_t(); }
+   task m_t;
+};
+
+typedef boost::movelib::unique_ptr<task_base> virtual_task;
+
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+
+//std::function requires copyable callables: the boxed task is transferred on copy
+struct boxed_task
+{
+   explicit boxed_task(boost::movelib::unique_ptr<task> p) : m_p(boost::move(p)) {}
+   boxed_task(const boxed_task &b) : m_p(boost::move(b.m_p)) {}
+   boxed_task &operator=(const boxed_task &b) { m_p = boost::move(b.m_p); return *this; }
+   void operator()() const { (*m_p)(); }
+   mutable boost::movelib::unique_ptr<task> m_p;
+};
+
+#endif
+
+enum queue_type { virtual_box, std_function_box, unique_function_queue };
+
+const char *const queue_names[] = { "virtual_box", "std_function_box", "unique_function" };
+
+void push(boost::container::vector<virtual_task> &q, int fd, std::size_t *sum)
+{  q.push_back(virtual_task(new task_box(task(fd, sum))));  }
+
+void run(virtual_task &t)
+{  t->run();  }
+
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+
+void push(boost::container::vector< std::function<void()> > &q, int fd, std::size_t *sum)
+{  q.push_back(boxed_task(boost::movelib::make_unique<task>(task(fd, sum))));  }
+
+void run(std::function<void()> &t)
+{  t();  }
+
+#endif
+
+void push(boost::container::vector< boost::movelib::unique_function<void()> > &q, int fd, std::size_t *sum)
+{
+   task t(fd, sum);
+   q.push_back(boost::movelib::unique_function<void()>(boost::move(t)));
+}
+
+void run(boost::movelib::unique_function<void()> &t)
+{  t();  }
+
+template<class Task>
+void measure(std::size_t n, queue_type type, bench_report &report)
+{
+   bench_samples samples;
+   std::size_t sum = 0;
+   boost::container::vector<Task> q;
+   q.reserve(n);
+   for(std::size_t run_i = 0; run_i != report.runs(); ++run_i){
+      sum = 0;
+      cpu_timer timer(true);
+      timer.resume();
+      for(std::size_t i = 0; i != n; ++i)
+         push(q, int(i), &sum);
+      for(std::size_t i = 0; i != n; ++i)
+         run(q[i]);
+      q.clear();
+      timer.stop();
+      samples.add(timer.elapsed(), 0u, 0u);
+   }
+   report.add("push_run", n, queue_names[type], samples);
+   if(report.is_text()){
+      std::printf("%-18s %10.02f ns/task (checksum %u)\n"
+                 , queue_names[type], double(samples.median())/double(n), unsigned(sum));
+   }
+}
+
+void measure_all(std::size_t n, bench_report &report)
+{
+   if(report.is_text())
+      std::printf("\n - - N: %u - -\n", unsigned(n));
+   measure<virtual_task>(n, virtual_box, report);
+   #if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+   measure< std::function<void()> >(n, std_function_box, report);
+   #endif
+   measure< boost::movelib::unique_function<void()> >(n, unique_function_queue, report);
+}
+
+int main(int argc, char *argv[])
+{
+   bench_options opt;
+   if(!parse_bench_options(argc, argv, opt))
+      return 1;
+   bench_report report("unique_function", opt);
+   measure_all(1001, report);
+   #ifdef NDEBUG
+   measure_all(100001, report);
+   measure_all(1000001, report);
+   #endif
+   return report.finish();
+}
@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/branchless_merge.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/algo/predicate.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+//Trivially copyable record, merged without branches
+struct pod_record
+{
+   unsigned key;
+   unsigned val;
+
+   friend bool operator< (const pod_record &l, const pod_record &r)
+   {  return l.key < r.key;  }
+};
+
+//Same layout, but branch-free merges are disabled by the user
+struct opt_out_record
+   : pod_record
+{};
+
+//Trivially copy assignable but not trivially copyable: elements
+//constructed in or destroyed from buffers need their own operations
+struct nontrivial_copy_record
+{
+   unsigned key;
+   unsigned val;
+
+   nontrivial_copy_record()
+      : key(), val()
+   {}
+
+   nontrivial_copy_record(const nontrivial_copy_record &o)
+      : key(o.key), val(o.val)
+   {}
+};
+
+struct nontrivial_dtor_record
+{
+   unsigned key;
+   unsigned val;
+
+   ~nontrivial_dtor_record()
+   {}
+};
+
+//Cheap comparison of small types, but each one calls a function
+struct cstring_less
+{
+   bool operator()(const char *l, const char *r) const
+   {  return std::strcmp(l, r) < 0;  }
+};
+
+namespace boost {
+namespace movelib {
+
+template<>
+struct branchless_merge<opt_out_record>
+{
+   static const bool value = false;
+};
+
+//order_type_less only compares an integer key
+template<class T>
+struct branchless_merge_compare<order_type_less, T>
+{
+   static const bool value = true;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::branchless_merge<pod_record>::value));
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::branchless_merge<int>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::branchless_merge<opt_out_record>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::branchless_merge<order_perf_type>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::branchless_merge<nontrivial_copy_record>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::branchless_merge<nontrivial_dtor_record>::value));
+
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::branchless_merge_compare<std::less<int>, int>::value));
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::branchless_merge_compare<std::greater<double>, double>::value));
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::branchless_merge_compare<boost::movelib::antistable<std::less<int> >, int>::value));
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::branchless_merge_compare<boost::movelib::inverse<order_type_less>, pod_record>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::branchless_merge_compare<std::less<pod_record>, pod_record>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::branchless_merge_compare<cstring_less, const char*>::value));
+
+template<class T>
+void init(boost::container::vector<T> &v, std::size_t n, std::size_t num_keys)
+{
+   v.resize(n);
+   boost::movelib::unique_ptr<unsigned[]> key_reps(new unsigned[num_keys]);
+   for(std::size_t i = 0; i != num_keys; ++i)
+      key_reps[i] = 0;
+   for(std::size_t i = 0; i != n; ++i)
+      v[i].key = unsigned(i % num_keys);
+   ::random_shuffle(v.data(), v.data() + n);
+   for(std::size_t i = 0; i != n; ++i){
+      v[i].val = key_reps[v[i].key]++;
+   }
+}
+
+template<class T>
+bool check(const boost::container::vector<T> &v)
+{
+   return is_order_type_ordered(v.data(), v.size());
+}
+
+template<class T>
+void test_sorts(std::size_t n, std::size_t num_keys)
+{
+   boost::container::vector<T> orig, v;
+   init(orig, n, num_keys);
+
+   //merge_sort
+   {
+      v = orig;
+      boost::movelib::unique_ptr<char[]> buf(new char[sizeof(T)*(n - n/2)]);
+      boost::movelib::merge_sort(v.data(), v.data() + n, order_type_less(), boost::move_detail::force_ptr<T*>(buf.get()));
+      BOOST_TEST(check(v));
+   }
+   //adaptive_sort with internal and external buffers
+   const std::size_t sort_buf_lens[] = { 0u, n/2 + 1u, n };
+   for(std::size_t i = 0; i != sizeof(sort_buf_lens)/sizeof(*sort_buf_lens); ++i){
+      v = orig;
+      boost::movelib::unique_ptr<char[]> buf(new char[sizeof(T)*(sort_buf_lens[i] + 1u)]);
+      boost::movelib::adaptive_sort
+         (v.data(), v.data() + n, order_type_less(), boost::move_detail::force_ptr<T*>(buf.get()), sort_buf_lens[i]);
+      BOOST_TEST(check(v));
+   }
+   //adaptive_merge of two sorted halves with several buffer sizes
+   const std::size_t buf_lens[] = { 0u, 16u, n/4 + 1u, n };
+   for(std::size_t i = 0; i != sizeof(buf_lens)/sizeof(*buf_lens); ++i){
+      v = orig;
+      boost::movelib::adaptive_sort(v.data(), v.data() + n/2, order_type_less());
+      boost::movelib::adaptive_sort(v.data() + n/2, v.data() + n, order_type_less());
+      boost::movelib::unique_ptr<char[]> buf(new char[sizeof(T)*(buf_lens[i] + 1u)]);
+      boost::movelib::adaptive_merge
+         (v.data(), v.data() + n/2, v.data() + n, order_type_less(), boost::move_detail::force_ptr<T*>(buf.get()), buf_lens[i]);
+      BOOST_TEST(check(v));
+   }
+}
+
+//Branch-free merges give the same result as the branchy ones
+void test_same_result(std::size_t n, std::size_t num_keys)
+{
+   boost::container::vector<pod_record> v;
+   boost::container::vector<opt_out_record> w;
+   init(v, n, num_keys);
+   w.resize(n);
+   for(std::size_t i = 0; i != n; ++i){
+      w[i].key = v[i].key;
+      w[i].val = v[i].val;
+   }
+   boost::movelib::adaptive_sort(v.data(), v.data() + n, order_type_less());
+   boost::movelib::adaptive_sort(w.data(), w.data() + n, order_type_less());
+   for(std::size_t i = 0; i != n; ++i){
+      BOOST_TEST(v[i].key == w[i].key && v[i].val == w[i].val);
+   }
+}
+
+int main()
+{
+   const std::size_t sizes[] = { 1u, 2u, 7u, 33u, 1001u, 10001u };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(*sizes); ++i){
+      test_sorts<pod_record>(sizes[i], sizes[i]);
+      test_sorts<pod_record>(sizes[i], 7u);
+      test_sorts<opt_out_record>(sizes[i], sizes[i]);
+      test_sorts<opt_out_record>(sizes[i], 7u);
+      test_same_result(sizes[i], 7u);
+   }
+   return boost::report_errors();
+}
@@ -0,0 +1,16 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Scratch memory statistics hooks must not break algorithms evaluated at compile time
+#define BOOST_MOVE_SCRATCH_STATS
+#include <boost/move/algo/scratch_stats.hpp>
+
+#include "constexpr_algo_test.cpp"
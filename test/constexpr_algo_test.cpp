@@ -0,0 +1,213 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/detail/workaround.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_MOVE_HAS_CXX20_CONSTEXPR)
+
+#include <boost/move/algo/detail/insertion_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/algo/detail/heap_sort.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/algo/detail/search.hpp>
+#include <boost/move/algo/detail/is_sorted.hpp>
+#include <boost/move/algo/unique.hpp>
+#include <boost/move/algo/move.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#include <array>
+#include <memory>
+#include <string_view>
+
+//Keyword table sorted at compile time
+struct keyword
+{
+   std::string_view name;
+   int token;
+
+   friend constexpr bool operator==(const keyword &l, const keyword &r)
+   {  return l.name == r.name && l.token == r.token;  }
+};
+
+struct keyword_less
+{
+   constexpr bool operator()(const keyword &l, const keyword &r) const
+   {  return l.name < r.name;  }
+};
+
+struct keyword_name_less
+{
+   constexpr bool operator()(const keyword &l, std::string_view r) const
+   {  return l.name < r;  }
+
+   constexpr bool operator()(std::string_view l, const keyword &r) const
+   {  return l < r.name;  }
+};
+
+struct int_less
+{
+   constexpr bool operator()(int l, int r) const
+   {  return l < r;  }
+};
+
+struct int_equal
+{
+   constexpr bool operator()(int l, int r) const
+   {  return l == r;  }
+};
+
+typedef std::array<keyword, 20> keyword_table;
+
+constexpr keyword_table unsorted_keywords()
+{
+   return keyword_table
+      {{ {"while", 0}, {"if", 1}, {"return", 2}, {"for", 3}, {"switch", 4}
+      , {"case", 5}, {"break", 6}, {"continue", 7}, {"do", 8}, {"else", 9}
+      , {"struct", 10}, {"class", 11}, {"enum", 12}, {"union", 13}, {"typedef", 14}
+      , {"const", 15}, {"static", 16}, {"extern", 17}, {"inline", 18}, {"goto", 19} }};
+}
+
+enum algo_type { insertion_sort_algo, pdqsort_algo, heap_sort_algo, merge_sort_algo, inplace_stable_sort_algo };
+
+template<algo_type Algo>
+constexpr keyword_table make_keywords()
+{
+   keyword_table t = unsorted_keywords();
+   switch(Algo){
+      case insertion_sort_algo:
+         boost::movelib::insertion_sort(t.begin(), t.end(), keyword_less());
+      break;
+      case pdqsort_algo:
+         boost::movelib::pdqsort(t.begin(), t.end(), keyword_less());
+      break;
+      case heap_sort_algo:
+         boost::movelib::heap_sort(t.begin(), t.end(), keyword_less());
+      break;
+      case merge_sort_algo:
+      {
+         //Uninitialized memory obtained from std::allocator can be used in constant expressions
+         std::allocator<keyword> a;
+         keyword *const buf = a.allocate(t.size());
+         boost::movelib::merge_sort(t.begin(), t.end(), keyword_less(), buf);
+         a.deallocate(buf, t.size());
+      }
+      break;
+      case inplace_stable_sort_algo:
+         boost::movelib::inplace_stable_sort(t.begin(), t.end(), keyword_less());
+      break;
+   }
+   return t;
+}
+
+template<algo_type Algo>
+constexpr bool check_keywords()
+{
+   constexpr keyword_table t = make_keywords<Algo>();
+   return boost::movelib::is_sorted(t.begin(), t.end(), keyword_less())
+      && t.front().name == "break" && t.back().name == "while";
+}
+
+static_assert(check_keywords<insertion_sort_algo>());
+static_assert(check_keywords<pdqsort_algo>());
+static_assert(check_keywords<heap_sort_algo>());
+static_assert(check_keywords<merge_sort_algo>());
+static_assert(check_keywords<inplace_stable_sort_algo>());
+
+//Lookup in a table built at compile time
+constexpr keyword_table keywords = make_keywords<pdqsort_algo>();
+
+constexpr int find_token(std::string_view name)
+{
+   const keyword *const p = boost::movelib::lower_bound(keywords.begin(), keywords.end(), name, keyword_name_less());
+   return (p != keywords.end() && p->name == name) ? p->token : -1;
+}
+
+static_assert(find_token("return") == 2);
+static_assert(find_token("goto") == 19);
+static_assert(find_token("break") == 6);
+static_assert(find_token("while") == 0);
+static_assert(find_token("module") == -1);
+static_assert(boost::movelib::upper_bound(keywords.begin(), keywords.end(), std::string_view("if"), keyword_name_less()) - keywords.begin() == 12);
+
+//Bigger tables use all pdqsort and merge_sort code paths
+typedef std::array<int, 500> int_table;
+
+constexpr int_table unsorted_ints()
+{
+   int_table t{};
+   unsigned x = 12345u;
+   for(int &i : t){
+      x = x*1103515245u + 12345u;
+      i = int((x >> 16u) % 300u);
+   }
+   return t;
+}
+
+constexpr bool check_ints()
+{
+   int_table a = unsorted_ints(), b = a, c = a, d = a;
+   boost::movelib::pdqsort(a.begin(), a.end(), int_less());
+   boost::movelib::heap_sort(b.begin(), b.end(), int_less());
+   std::allocator<int> al;
+   int *const buf = al.allocate(c.size());
+   boost::movelib::merge_sort(c.begin(), c.end(), int_less(), buf);
+   al.deallocate(buf, c.size());
+   boost::movelib::inplace_stable_sort(d.begin(), d.end(), int_less());
+   bool ok = a == b && a == c && a == d && boost::movelib::is_sorted(a.begin(), a.end(), int_less());
+
+   //unique
+   int *const new_end = boost::movelib::unique(a.begin(), a.end(), int_equal());
+   ok = ok && new_end - a.begin() <= 300 && boost::movelib::is_sorted(a.begin(), new_end, int_less());
+   for(int *p = a.begin() + 1; p < new_end; ++p)
+      ok = ok && p[-1] != *p;
+   return ok;
+}
+
+static_assert(check_ints());
+
+//Move algorithms and adl_move_swap
+constexpr bool check_move()
+{
+   std::array<int, 8> a{1, 2, 3, 4, 5, 6, 7, 8}, b{};
+   bool ok = boost::move(a.begin(), a.end(), b.begin()) == b.end() && a == b;
+   ok = ok && boost::move_backward(b.begin(), b.begin() + 4, b.end()) == b.begin() + 4;
+   ok = ok && b[4] == 1 && b[7] == 4;
+   boost::adl_move_swap(a[0], a[7]);
+   ok = ok && a[0] == 8 && a[7] == 1;
+   boost::adl_move_swap_ranges(a.begin(), a.begin() + 4, b.begin());
+   ok = ok && a[0] == 1 && b[0] == 8;
+   boost::adl_move_iter_swap(a.begin(), a.begin() + 1);
+   ok = ok && a[0] == 2 && a[1] == 1;
+   return ok;
+}
+
+static_assert(check_move());
+
+int main()
+{
+   //The same code at runtime
+   keyword_table t = unsorted_keywords();
+   boost::movelib::pdqsort(t.begin(), t.end(), keyword_less());
+   BOOST_TEST(t == keywords);
+   BOOST_TEST(check_ints());
+   BOOST_TEST(check_move());
+   BOOST_TEST_EQ(find_token("continue"), 7);
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
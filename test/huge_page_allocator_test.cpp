@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/huge_page_allocator.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+#include <cstring>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+using namespace boost::movelib;
+
+void test_backing()
+{
+   //Small blocks use the heap
+   huge_page_allocator<int> a;
+   huge_page_backing b = mapped_backing;
+   int *p = a.allocate(10u, b);
+   BOOST_TEST_EQ(b, heap_backing);
+   a.deallocate(p, 10u);
+
+   //Big blocks are mapped on Linux, using huge pages if the kernel allows it.
+   //Exact multiples of huge_page_size don't need an extra huge page.
+   const std::size_t n = 3u*huge_page_size/sizeof(int);
+   p = a.allocate(n, b);
+   #if defined(BOOST_MOVE_DETAIL_HAS_HUGE_PAGES)
+   BOOST_TEST(b == mapped_backing || b == transparent_huge_page_backing);
+   BOOST_TEST_EQ(std::size_t(p) % huge_page_size, 0u);
+   #else
+   BOOST_TEST_EQ(b, heap_backing);
+   #endif
+   std::memset(p, 1, n*sizeof(int));
+   BOOST_TEST_EQ(p[n-1u], 0x01010101);
+   a.deallocate(p, n);
+
+   //Sizes that are not multiples of huge_page_size
+   p = a.allocate(n + 1u, b);
+   p[n] = 1;
+   BOOST_TEST_EQ(p[n], 1);
+   a.deallocate(p, n + 1u);
+
+   //The huge page pool is usually empty: it falls back to other backings
+   huge_page_allocator<char> pool(0u, true, false);
+   char *c = pool.allocate(huge_page_size, b);
+   #if defined(BOOST_MOVE_DETAIL_HAS_HUGE_PAGES)
+   BOOST_TEST(b != heap_backing);
+   BOOST_TEST_EQ(std::size_t(c) % huge_page_size, 0u);
+   #endif
+   std::memset(c, 0, huge_page_size);
+   pool.deallocate(c, huge_page_size);
+
+   //Zero sized requests
+   c = pool.allocate(0u);
+   pool.deallocate(c, 0u);
+
+   //Options are kept by rebinding
+   huge_page_allocator<char> small(0u);
+   huge_page_allocator<double> rebound(small);
+   double *d = rebound.allocate(1u, b);
+   #if defined(BOOST_MOVE_DETAIL_HAS_HUGE_PAGES)
+   BOOST_TEST(b != heap_backing);
+   #endif
+   rebound.deallocate(d, 1u);
+   BOOST_TEST(rebound == huge_page_allocator<double>(small));
+   BOOST_TEST(small != huge_page_allocator<char>());
+   BOOST_TEST(small == pool);
+
+   //Overflow
+   BOOST_TEST_THROWS(a.allocate(std::size_t(-1)), std::bad_alloc);
+}
+
+void test_algorithms()
+{
+   const std::size_t n = 50001u;
+   unique_ptr<order_move_type[]> elements(new order_move_type[n]);
+   //Map even small buffers so that the mapped path is exercised
+   huge_page_allocator<order_move_type> a(0u);
+
+   fill_stable(elements.get(), n);
+   adaptive_sort(elements.get(), elements.get() + n, order_type_less(), a);
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+
+   fill_stable(elements.get(), n);
+   adaptive_sort(elements.get(), elements.get() + n/2u, order_type_less());
+   adaptive_sort(elements.get() + n/2u, elements.get() + n, order_type_less());
+   adaptive_merge(elements.get(), elements.get() + n/2u, elements.get() + n, order_type_less(), a);
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+
+   fill_stable(elements.get(), n);
+   order_move_type *const buf = a.allocate((n+1u)/2u);
+   merge_sort(elements.get(), elements.get() + n, order_type_less(), buf);
+   a.deallocate(buf, (n+1u)/2u);
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+}
+
+int main()
+{
+   std::srand(0);
+   test_backing();
+   test_algorithms();
+   return boost::report_errors();
+}
@@ -10,7 +10,6 @@
 //////////////////////////////////////////////////////////////////////////////
 
 //#define BOOST_MOVE_ADAPTIVE_SORT_INVARIANTS
-#define BOOST_MOVE_ADAPTIVE_SORT_STATS
 
 #include "order_type.hpp"
 
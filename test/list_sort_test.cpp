@@ -0,0 +1,210 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/list_sort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/meta_utils.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdlib>
+
+#include "random_shuffle.hpp"
+
+//A big node that must not be moved
+struct order_node
+{
+   order_node *next;
+   order_node *prev;
+   std::size_t key;
+   std::size_t val;
+   char payload[256];
+};
+
+struct order_node_traits
+{
+   typedef order_node         node;
+   typedef order_node *       node_ptr;
+   typedef const order_node * const_node_ptr;
+
+   static node_ptr get_next(const_node_ptr n)            {  return n->next;  }
+   static void set_next(node_ptr n, node_ptr next)       {  n->next = next;  }
+   static node_ptr get_previous(const_node_ptr n)        {  return n->prev;  }
+   static void set_previous(node_ptr n, node_ptr prev)   {  n->prev = prev;  }
+};
+
+struct order_node_less
+{
+   explicit order_node_less(std::size_t *count = 0)
+      : m_count(count)
+   {}
+
+   bool operator()(const order_node *l, const order_node *r) const
+   {
+      if(m_count)
+         ++*m_count;
+      return l->key < r->key;
+   }
+
+   std::size_t *m_count;
+};
+
+//Nodes are linked in a shuffled memory order and val holds the position in the list
+void init_nodes(order_node *nodes, order_node **order, std::size_t n, std::size_t num_keys)
+{
+   for(std::size_t i = 0; i != n; ++i){
+      order[i] = nodes + i;
+      nodes[i].payload[0] = char(i);
+   }
+   if(n)
+      ::random_shuffle(order, order + n);
+   for(std::size_t i = 0; i != n; ++i){
+      order[i]->key = std::size_t(std::rand()) % num_keys;
+      order[i]->val = i;
+   }
+}
+
+//Checks sorted and stable order following next pointers, returns the last node
+const order_node *check_sorted(const order_node *first, const order_node *last, std::size_t n)
+{
+   const order_node *prev = 0;
+   std::size_t count = 0;
+   for(; first != last && count <= n; prev = first, first = first->next, ++count){
+      if(prev){
+         BOOST_TEST(prev->key <= first->key);
+         BOOST_TEST(prev->key != first->key || prev->val < first->val);
+      }
+   }
+   BOOST_TEST_EQ(count, n);
+   return prev;
+}
+
+void check_payload(const order_node *nodes, std::size_t n)
+{
+   for(std::size_t i = 0; i != n; ++i)
+      BOOST_TEST_EQ(nodes[i].payload[0], char(i));
+}
+
+template<std::size_t K>
+void slist_sort_k(order_node *&first, order_node *last, const order_node_less &comp, boost::move_detail::bool_<true>)
+{  first = boost::movelib::slist_sort<order_node_traits>(first, last, comp);  }
+
+template<std::size_t K>
+void slist_sort_k(order_node *&first, order_node *last, const order_node_less &comp, boost::move_detail::bool_<false>)
+{  first = boost::movelib::slist_sort<order_node_traits, K>(first, last, comp);  }
+
+template<std::size_t K>
+void list_sort_k(order_node *&first, order_node *last, const order_node_less &comp, boost::move_detail::bool_<true>)
+{  first = boost::movelib::list_sort<order_node_traits>(first, last, comp);  }
+
+template<std::size_t K>
+void list_sort_k(order_node *&first, order_node *last, const order_node_less &comp, boost::move_detail::bool_<false>)
+{  first = boost::movelib::list_sort<order_node_traits, K>(first, last, comp);  }
+
+//K == 0 tests the overload without K
+template<std::size_t K>
+void test_slist(std::size_t n, std::size_t num_keys)
+{
+   boost::movelib::unique_ptr<order_node[]> nodes(new order_node[n + 1u]);
+   boost::movelib::unique_ptr<order_node*[]> order(new order_node*[n + 1u]);
+   init_nodes(nodes.get(), order.get(), n, num_keys);
+
+   //Null terminated
+   for(std::size_t i = 0; i != n; ++i)
+      order[i]->next = i + 1u == n ? 0 : order[i + 1u];
+   order_node *first = n ? order[0] : 0;
+   std::size_t count = 0;
+   slist_sort_k<K>(first, 0, order_node_less(&count), boost::move_detail::bool_<K == 0u>());
+   check_sorted(first, 0, n);
+   check_payload(nodes.get(), n);
+
+   //Bottom-up merges of a power of two levels do at most N*log2(N) comparisons
+   std::size_t log_n = 0;
+   while((std::size_t(1u) << log_n) < n)
+      ++log_n;
+   if(K <= 2u){
+      BOOST_TEST(count <= n*log_n);
+   }
+
+   //Circular with a header node
+   order_node &header = nodes[n];
+   init_nodes(nodes.get(), order.get(), n, num_keys);
+   header.next = n ? order[0] : &header;
+   for(std::size_t i = 0; i != n; ++i)
+      order[i]->next = i + 1u == n ? &header : order[i + 1u];
+   slist_sort_k<K>(header.next, &header, order_node_less(), boost::move_detail::bool_<K == 0u>());
+   check_sorted(header.next, &header, n);
+}
+
+template<std::size_t K>
+void test_list(std::size_t n, std::size_t num_keys)
+{
+   boost::movelib::unique_ptr<order_node[]> nodes(new order_node[n + 1u]);
+   boost::movelib::unique_ptr<order_node*[]> order(new order_node*[n + 1u]);
+
+   //Circular with a header node
+   order_node &header = nodes[n];
+   init_nodes(nodes.get(), order.get(), n, num_keys);
+   order[n] = &header;
+   for(std::size_t i = 0; i != n + 1u; ++i){
+      order[i]->next = order[(i + 1u) % (n + 1u)];
+      order[i]->prev = order[(i + n) % (n + 1u)];
+   }
+   order_node *first = header.next;
+   list_sort_k<K>(first, &header, order_node_less(), boost::move_detail::bool_<K == 0u>());
+   BOOST_TEST(first == header.next);
+   const order_node *last = check_sorted(header.next, &header, n);
+   BOOST_TEST(header.prev == (n ? last : &header));
+   for(const order_node *p = &header; p->next != &header; p = p->next)
+      BOOST_TEST(p->next->prev == p);
+   check_payload(nodes.get(), n);
+
+   //A null terminated range in the middle of a list
+   if(n >= 2u){
+      init_nodes(nodes.get(), order.get(), n, num_keys);
+      for(std::size_t i = 0; i != n; ++i){
+         order[i]->next = i + 1u == n ? 0 : order[i + 1u];
+         order[i]->prev = i == 0u ? 0 : order[i - 1u];
+      }
+      order_node *const before = order[0];
+      order_node *const after  = order[n - 1u];
+      first = order[1];
+      list_sort_k<K>(first, after, order_node_less(), boost::move_detail::bool_<K == 0u>());
+      BOOST_TEST(before->next == first);
+      BOOST_TEST(first->prev == before);
+      last = check_sorted(first, after, n - 2u);
+      BOOST_TEST(after->prev == (n == 2u ? before : last));
+      BOOST_TEST(after->next == 0);
+      for(const order_node *p = before; p->next; p = p->next)
+         BOOST_TEST(p->next->prev == p);
+   }
+}
+
+template<std::size_t K>
+void test_k()
+{
+   const std::size_t sizes[] = { 0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 16u, 17u, 31u, 64u, 65u, 100u, 1000u, 4097u };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(*sizes); ++i){
+      test_slist<K>(sizes[i], 4u);
+      test_slist<K>(sizes[i], sizes[i] + 1u);
+      test_list<K>(sizes[i], 4u);
+      test_list<K>(sizes[i], sizes[i] + 1u);
+   }
+}
+
+int main()
+{
+   test_k<0>();
+   test_k<2>();
+   test_k<3>();
+   test_k<4>();
+   test_k<8>();
+   return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/move/make_unique_aligned.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+struct A
+{
+   int a, b, c;
+   static int count;
+   A() : a (999), b(1000), c(1001) {++count;}
+   A(int x) : a (x), b(1000), c(1001) {++count;}
+   A(int x, int y) : a (x), b(y), c(1001) {++count;}
+   A(int x, int y, int z) : a (x), b(y), c(z) {++count;}
+   A(const A&) {++count;}
+   ~A() {--count;}
+};
+
+int A::count = 0;
+
+//Throws when "throw_at" objects have been constructed
+struct T
+{
+   static int count;
+   static int throw_at;
+   T()
+   {
+      if(count == throw_at)
+         throw int(0);
+      ++count;
+   }
+   ~T() {--count;}
+};
+
+int T::count = 0;
+int T::throw_at = -1;
+
+bool is_aligned(const void *p, std::size_t alignment)
+{  return reinterpret_cast<std::size_t>(p) % alignment == 0u;  }
+
+void test_single()
+{
+   using namespace boost::movelib;
+   {
+      unique_ptr<A, aligned_delete<A> > p = make_unique_aligned<A>(64u);
+      BOOST_TEST(is_aligned(p.get(), 64u));
+      BOOST_TEST_EQ(A::count, 1);
+      BOOST_TEST_EQ(p->a, 999);
+      unique_ptr<A, aligned_delete<A> > q = make_unique_aligned<A>(4096u, 1, 2, 3);
+      BOOST_TEST(is_aligned(q.get(), 4096u));
+      BOOST_TEST_EQ(q->a, 1);
+      BOOST_TEST_EQ(q->b, 2);
+      BOOST_TEST_EQ(q->c, 3);
+      BOOST_TEST_EQ(A::count, 2);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   {
+      //Alignments smaller than the type's are raised
+      unique_ptr<double, aligned_delete<double> > p = make_unique_aligned<double>(1u);
+      BOOST_TEST(is_aligned(p.get(), boost::move_detail::alignment_of<double>::value));
+      BOOST_TEST_EQ(*p, 0.0);
+      unique_ptr<int, aligned_delete<int> > d = make_unique_aligned_definit<int>(128u);
+      BOOST_TEST(is_aligned(d.get(), 128u));
+      *d = 2;
+      BOOST_TEST_EQ(*d, 2);
+   }
+   //The deleter is stateless
+   BOOST_TEST_EQ(sizeof(unique_ptr<A, aligned_delete<A> >), sizeof(A*));
+}
+
+void test_array()
+{
+   using namespace boost::movelib;
+   {
+      unique_ptr<A[], aligned_delete<A[]> > p = make_unique_aligned<A[]>(128u, 10u);
+      BOOST_TEST(is_aligned(p.get(), 128u));
+      BOOST_TEST_EQ(A::count, 10);
+      BOOST_TEST_EQ(p.get_deleter().size(), 10u);
+      BOOST_TEST_EQ(p[9].c, 1001);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   {
+      unique_ptr<int[], aligned_delete<int[]> > p = make_unique_aligned<int[]>(64u, 100u);
+      for(std::size_t i = 0; i != 100u; ++i){
+         BOOST_TEST_EQ(p[i], 0);
+      }
+      unique_ptr<float[], aligned_delete<float[]> > d = make_unique_aligned_definit<float[]>(32u, 16u);
+      BOOST_TEST(is_aligned(d.get(), 32u));
+      d[15] = 1.0f;
+      BOOST_TEST_EQ(d[15], 1.0f);
+   }
+}
+
+void test_cache_padded()
+{
+   #if !defined(BOOST_NO_ALIGNMENT) && (!defined(BOOST_MSVC) || !defined(BOOST_NO_CXX11_ALIGNAS))
+   using namespace boost::movelib;
+   BOOST_TEST_EQ(sizeof(cache_padded<int>), std::size_t(BOOST_MOVE_CACHE_LINE_SIZE));
+   BOOST_TEST_EQ(sizeof(cache_padded<char[100]>), 2u*BOOST_MOVE_CACHE_LINE_SIZE);
+   BOOST_TEST_EQ(sizeof(cache_padded<int, 128u>), 128u);
+
+   //Each element starts a cache line
+   unique_ptr<cache_padded<long>[], aligned_delete<cache_padded<long>[]> > counters =
+      make_unique_aligned<cache_padded<long>[]>(BOOST_MOVE_CACHE_LINE_SIZE, 8u);
+   for(std::size_t i = 0; i != 8u; ++i){
+      BOOST_TEST(is_aligned(&counters[i].value, BOOST_MOVE_CACHE_LINE_SIZE));
+      BOOST_TEST_EQ(counters[i].value, 0);
+   }
+   //The alignment of the element is used if it's bigger
+   unique_ptr<cache_padded<long, 256u>[], aligned_delete<cache_padded<long, 256u>[]> > big =
+      make_unique_aligned<cache_padded<long, 256u>[]>(16u, 3u);
+   BOOST_TEST(is_aligned(&big[1], 256u));
+   #endif
+}
+
+void test_exceptions()
+{
+   using namespace boost::movelib;
+   T::throw_at = 0;
+   BOOST_TEST_THROWS(make_unique_aligned<T>(64u), int);
+   T::throw_at = 5;
+   BOOST_TEST_THROWS(make_unique_aligned<T[]>(64u, 10u), int);
+   BOOST_TEST_EQ(T::count, 0);
+   T::throw_at = -1;
+   BOOST_TEST_THROWS(make_unique_aligned<A[]>(64u, std::size_t(-1)/2u), std::bad_alloc);
+   BOOST_TEST_EQ(A::count, 0);
+}
+
+int main()
+{
+   test_single();
+   test_array();
+   test_cache_padded();
+   test_exceptions();
+   return boost::report_errors();
+}
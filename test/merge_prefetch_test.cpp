@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Small distance so that hints are issued both inside and outside the ranges
+#define BOOST_MOVE_MERGE_PREFETCH_DISTANCE 64
+
+#include <boost/move/algo/merge_prefetch.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+//Large record whose payload is derived from the key and the stability index
+struct big_record
+   : order_perf_type
+{
+   unsigned char payload[112];
+};
+
+//Small type with prefetching enabled by the user
+struct small_record
+   : order_perf_type
+{};
+
+namespace boost {
+namespace movelib {
+
+template<>
+struct merge_prefetch<small_record>
+{
+   static const bool value = true;
+};
+
+}  //namespace movelib {
+}  //namespace boost {
+
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::merge_prefetch<big_record>::value));
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::merge_prefetch<small_record>::value));
+BOOST_MOVE_STATIC_ASSERT((!boost::movelib::merge_prefetch<int>::value));
+
+void fill_payload(big_record &r)
+{
+   for(std::size_t i = 0; i != sizeof(r.payload); ++i)
+      r.payload[i] = static_cast<unsigned char>(r.key*31u + r.val + i);
+}
+
+void fill_payload(small_record &)
+{}
+
+bool check_payload(const big_record &r)
+{
+   for(std::size_t i = 0; i != sizeof(r.payload); ++i){
+      if(r.payload[i] != static_cast<unsigned char>(r.key*31u + r.val + i))
+         return false;
+   }
+   return true;
+}
+
+bool check_payload(const small_record &)
+{  return true;  }
+
+template<class T>
+void init(boost::container::vector<T> &v, std::size_t n, std::size_t num_keys)
+{
+   v.resize(n);
+   boost::movelib::unique_ptr<std::size_t[]> key_reps(new std::size_t[num_keys]);
+   for(std::size_t i = 0; i != num_keys; ++i)
+      key_reps[i] = 0;
+   for(std::size_t i = 0; i != n; ++i)
+      v[i].key = i % num_keys;
+   ::random_shuffle(v.data(), v.data() + n);
+   for(std::size_t i = 0; i != n; ++i){
+      v[i].val = key_reps[v[i].key]++;
+      fill_payload(v[i]);
+   }
+}
+
+template<class T>
+bool check(const boost::container::vector<T> &v)
+{
+   bool ok = is_order_type_ordered(v.data(), v.size());
+   for(std::size_t i = 0; i != v.size(); ++i)
+      ok = ok && check_payload(v[i]);
+   return ok;
+}
+
+template<class T>
+void test_sorts(std::size_t n, std::size_t num_keys)
+{
+   boost::container::vector<T> orig, v;
+   init(orig, n, num_keys);
+
+   //merge_sort
+   {
+      v = orig;
+      boost::movelib::unique_ptr<char[]> buf(new char[sizeof(T)*(n - n/2)]);
+      boost::movelib::merge_sort(v.data(), v.data() + n, order_type_less(), boost::move_detail::force_ptr<T*>(buf.get()));
+      BOOST_TEST(check(v));
+   }
+   //adaptive_sort with internal and external buffers
+   const std::size_t sort_buf_lens[] = { 0u, n/2 + 1u, n };
+   for(std::size_t i = 0; i != sizeof(sort_buf_lens)/sizeof(*sort_buf_lens); ++i){
+      v = orig;
+      boost::movelib::unique_ptr<char[]> buf(new char[sizeof(T)*(sort_buf_lens[i] + 1u)]);
+      boost::movelib::adaptive_sort
+         (v.data(), v.data() + n, order_type_less(), boost::move_detail::force_ptr<T*>(buf.get()), sort_buf_lens[i]);
+      BOOST_TEST(check(v));
+   }
+   //adaptive_merge of two sorted halves with several buffer sizes
+   const std::size_t buf_lens[] = { 0u, 16u, n/4 + 1u, n };
+   for(std::size_t i = 0; i != sizeof(buf_lens)/sizeof(*buf_lens); ++i){
+      v = orig;
+      boost::movelib::adaptive_sort(v.data(), v.data() + n/2, order_type_less());
+      boost::movelib::adaptive_sort(v.data() + n/2, v.data() + n, order_type_less());
+      boost::movelib::unique_ptr<char[]> buf(new char[sizeof(T)*(buf_lens[i] + 1u)]);
+      boost::movelib::adaptive_merge
+         (v.data(), v.data() + n/2, v.data() + n, order_type_less(), boost::move_detail::force_ptr<T*>(buf.get()), buf_lens[i]);
+      BOOST_TEST(check(v));
+   }
+}
+
+int main()
+{
+   const std::size_t sizes[] = { 1u, 2u, 7u, 33u, 1001u, 10001u };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(*sizes); ++i){
+      test_sorts<big_record>(sizes[i], sizes[i]);
+      test_sorts<big_record>(sizes[i], 7u);
+      test_sorts<small_record>(sizes[i], sizes[i]);
+      test_sorts<small_record>(sizes[i], 7u);
+   }
+   return boost::report_errors();
+}
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/move/object_pool.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+struct A
+{
+   int a, b, c;
+   static int count;
+   A() : a (999), b(1000), c(1001) {++count;}
+   A(int x) : a (x), b(1000), c(1001) {++count;}
+   A(int x, int y) : a (x), b(y), c(1001) {++count;}
+   A(int x, int y, int z) : a (x), b(y), c(z) {++count;}
+   A(const A&) {++count;}
+   ~A() {--count;}
+};
+
+int A::count = 0;
+
+struct throwing
+{
+   explicit throwing(bool thr)
+   {
+      if(thr)
+         throw int(0);
+   }
+};
+
+using namespace boost::movelib;
+
+typedef unique_ptr<A, pool_delete<A> > pooled_a;
+
+void test_recycling()
+{
+   object_pool<A> pool;
+   {
+      pooled_a p = make_pooled<A>(pool);
+      BOOST_TEST_EQ(A::count, 1);
+      BOOST_TEST_EQ(p->a, 999);
+      BOOST_TEST(p.get_deleter().pool() == &pool);
+      BOOST_TEST_EQ(pool.stats().misses, 1u);
+      BOOST_TEST_EQ(pool.free_count(), 0u);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   BOOST_TEST_EQ(pool.free_count(), 1u);
+   {
+      //The block is reused
+      pooled_a p = make_pooled<A>(pool, 1, 2, 3);
+      BOOST_TEST_EQ(p->a, 1);
+      BOOST_TEST_EQ(p->b, 2);
+      BOOST_TEST_EQ(p->c, 3);
+      BOOST_TEST_EQ(pool.stats().hits, 1u);
+      BOOST_TEST_EQ(pool.stats().misses, 1u);
+      //Ownership is transferred
+      pooled_a p2(boost::move(p));
+      BOOST_TEST(!p);
+      p2.reset();
+      BOOST_TEST_EQ(pool.free_count(), 1u);
+   }
+   {
+      //Most recently freed blocks are reused first
+      pooled_a p1 = make_pooled<A>(pool, 1);
+      pooled_a p2 = make_pooled<A>(pool, 2);
+      A *const last = p2.get();
+      p1.reset();
+      p2.reset();
+      BOOST_TEST_EQ(pool.free_count(), 2u);
+      pooled_a p3 = make_pooled<A>(pool, 3);
+      BOOST_TEST(p3.get() == last);
+   }
+   {
+      //The pool must outlive its objects
+      object_pool<int> ipool;
+      unique_ptr<int, pool_delete<int> > i;
+      i = make_pooled_definit<int>(ipool);
+      *i = 5;
+      BOOST_TEST_EQ(*i, 5);
+      i = make_pooled<int>(ipool);
+      BOOST_TEST_EQ(*i, 0);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+}
+
+void test_retention()
+{
+   object_pool<A> pool(2u);
+   BOOST_TEST_EQ(pool.max_retained(), 2u);
+   {
+      pooled_a p1 = make_pooled<A>(pool);
+      pooled_a p2 = make_pooled<A>(pool);
+      pooled_a p3 = make_pooled<A>(pool);
+   }
+   BOOST_TEST_EQ(pool.free_count(), 2u);
+   BOOST_TEST_EQ(pool.stats().discards, 1u);
+   BOOST_TEST_EQ(pool.stats().misses, 3u);
+
+   pool.max_retained(1u);
+   BOOST_TEST_EQ(pool.free_count(), 1u);
+   pool.trim();
+   BOOST_TEST_EQ(pool.free_count(), 0u);
+
+   //No retention: the pool behaves as the global allocator
+   pool.max_retained(0u);
+   make_pooled<A>(pool).reset();
+   BOOST_TEST_EQ(pool.free_count(), 0u);
+   BOOST_TEST_EQ(pool.stats().discards, 2u);
+
+   pool.clear_stats();
+   BOOST_TEST_EQ(pool.stats().hits + pool.stats().misses + pool.stats().discards, 0u);
+}
+
+void test_exceptions()
+{
+   object_pool<throwing> pool;
+   BOOST_TEST_THROWS(make_pooled<throwing>(pool, true), int);
+   //The block was returned
+   BOOST_TEST_EQ(pool.free_count(), 1u);
+   unique_ptr<throwing, pool_delete<throwing> > p = make_pooled<throwing>(pool, false);
+   BOOST_TEST_EQ(pool.stats().hits, 1u);
+}
+
+void test_thread_instance()
+{
+   #if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+   object_pool<A> &pool = object_pool<A>::thread_instance();
+   BOOST_TEST(&pool == &object_pool<A>::thread_instance());
+   make_pooled<A>(pool).reset();
+   BOOST_TEST_EQ(pool.free_count(), 1u);
+   pool.trim();
+   #endif
+}
+
+int main()
+{
+   test_recycling();
+   test_retention();
+   test_exceptions();
+   test_thread_instance();
+   return boost::report_errors();
+}
@@ -15,9 +15,12 @@
 #include <boost/config.hpp>
 #include <boost/move/core.hpp>
 #include <boost/move/detail/iterator_traits.hpp>
+#include <boost/move/unique_ptr.hpp>
 #include <cstddef>
 #include <cstdio>
 
+#include "random_shuffle.hpp"
+
 struct order_perf_type
 {
    public:
@@ -132,6 +135,33 @@ inline bool is_order_type_ordered(T *elements, std::size_t element_count, bool s
    return true;
 }
 
+//Shuffles element_count elements with num_keys different keys (all keys are
+//different if num_keys is zero). "val" numbers elements with the same key in
+//order of appearance, so that is_order_type_ordered can check stability.
+template<class T>
+void fill_shuffled(T *elements, std::size_t element_count, std::size_t num_keys)
+{
+   const std::size_t key_count = num_keys ? num_keys : element_count;
+   ::boost::movelib::unique_ptr<std::size_t[]> key_reps(new std::size_t[key_count ? key_count : 1u]);
+   for(std::size_t i = 0; i < key_count; ++i){
+      key_reps[i] = 0;
+   }
+   for(std::size_t i = 0; i < element_count; ++i){
+      elements[i].key = num_keys ? (i % num_keys) : i;
+   }
+   if(element_count > 1u){
+      ::random_shuffle(elements, elements + element_count);
+   }
+   for(std::size_t i = 0; i < element_count; ++i){
+      elements[i].val = key_reps[elements[i].key]++;
+   }
+}
+
+//Same as fill_shuffled, but each key is repeated twice
+template<class T>
+void fill_stable(T *elements, std::size_t element_count)
+{  fill_shuffled(elements, element_count, (element_count + 1u)/2u);  }
+
 namespace boost {
 namespace movelib {
 
@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/parallel_move.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#include <atomic>
+#endif
+
+using namespace boost::movelib;
+
+//Iterators whose ranges are split among threads
+BOOST_MOVE_STATIC_ASSERT((detail_parallel_move::has_raw_pointers<int*, int*>::value));
+BOOST_MOVE_STATIC_ASSERT((detail_parallel_move::has_raw_pointers
+   <boost::container::vector<int>::iterator, boost::container::vector<int>::iterator>::value));
+BOOST_MOVE_STATIC_ASSERT((!detail_parallel_move::has_raw_pointers<int*, boost::container::deque<int>::iterator>::value));
+#if defined(__cpp_lib_concepts)
+BOOST_MOVE_STATIC_ASSERT((detail_parallel_move::has_raw_pointers<std::vector<int>::iterator, std::vector<int>::iterator>::value));
+#endif
+
+//Small chunks so that parallel execution is used with small ranges
+const parallel_policy pol(4u, 4096u);
+
+const std::size_t N = 100000u;
+
+void iota(int *f, std::size_t n, int first)
+{
+   for(std::size_t i = 0; i != n; ++i)
+      f[i] = first + int(i);
+}
+
+bool is_iota(const int *f, std::size_t n, int first)
+{
+   for(std::size_t i = 0; i != n; ++i){
+      if(f[i] != first + int(i))
+         return false;
+   }
+   return true;
+}
+
+void test_move()
+{
+   boost::container::vector<int> src(N), dst(N);
+   iota(src.data(), N, 0);
+   BOOST_TEST(boost::move(pol, src.begin(), src.end(), dst.begin()) == dst.end());
+   BOOST_TEST(is_iota(dst.data(), N, 0));
+   BOOST_TEST(boost::move(par, src.data(), src.data(), dst.data()) == dst.data());
+
+   //Move-only elements are moved from
+   boost::container::vector< unique_ptr<int> > p(N), q(N);
+   for(std::size_t i = 0; i != N; ++i)
+      p[i].reset(new int(int(i)));
+   boost::move(pol, p.data(), p.data() + N, q.data());
+   bool ok = true;
+   for(std::size_t i = 0; i != N; ++i)
+      ok = ok && !p[i] && *q[i] == int(i);
+   BOOST_TEST(ok);
+
+   //Standard vectors are contiguous too
+   std::vector<int> v(N);
+   BOOST_TEST(boost::move(pol, src.begin(), src.end(), v.begin()) == v.end());
+   BOOST_TEST(is_iota(&v[0], N, 0));
+
+   //Non contiguous ranges are moved serially
+   boost::container::deque<int> d(N);
+   BOOST_TEST(boost::move(pol, src.begin(), src.end(), d.begin()) == d.end());
+   BOOST_TEST_EQ(d[N-1u], int(N-1u));
+}
+
+void test_overlapping()
+{
+   const std::size_t shifts[] = { 1u, 3u, 1000u, 5000u, 40000u, N - 1u };
+   for(std::size_t s = 0; s != sizeof(shifts)/sizeof(shifts[0]); ++s){
+      const std::size_t d = shifts[s];
+      boost::container::vector<int> v(N + d);
+      //Towards the front
+      iota(v.data() + d, N, 0);
+      BOOST_TEST(boost::move(pol, v.data() + d, v.data() + d + N, v.data()) == v.data() + N);
+      BOOST_TEST(is_iota(v.data(), N, 0));
+      //Towards the back
+      BOOST_TEST(boost::move_backward(pol, v.data(), v.data() + N, v.data() + N + d) == v.data() + d);
+      BOOST_TEST(is_iota(v.data() + d, N, 0));
+   }
+}
+
+//Throws when move constructed from the element with value "throw_value"
+struct thrower
+{
+   #if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+   static std::atomic<int> count;
+   #else
+   static int count;
+   #endif
+   static int throw_value;
+
+   int value;
+
+   explicit thrower(int v) : value(v) { ++count; }
+
+   thrower(const thrower &t)
+      : value(t.value)
+   {
+      if(t.value == throw_value)
+         throw int(t.value);
+      ++count;
+   }
+
+   thrower &operator=(const thrower &t)
+   {  value = t.value; return *this;  }
+
+   ~thrower() { --count; }
+};
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+std::atomic<int> thrower::count(0);
+#else
+int thrower::count = 0;
+#endif
+int thrower::throw_value = -1;
+
+void test_uninitialized_move()
+{
+   const std::size_t n = 20000u;
+   boost::container::vector<thrower> src;
+   src.reserve(n);
+   for(std::size_t i = 0; i != n; ++i)
+      src.push_back(thrower(int(i)));
+   thrower *const buf = static_cast<thrower*>(::operator new(n*sizeof(thrower)));
+   BOOST_TEST(boost::uninitialized_move(pol, src.data(), src.data() + n, buf) == buf + n);
+   BOOST_TEST_EQ(int(thrower::count), int(2u*n));
+   bool ok = true;
+   for(std::size_t i = 0; i != n; ++i){
+      ok = ok && buf[i].value == int(i);
+      buf[i].~thrower();
+   }
+   BOOST_TEST(ok);
+
+   //Elements constructed by all chunks are destroyed on failure
+   const int throw_values[] = { 0, int(n/2u), int(n - 1u) };
+   for(std::size_t t = 0; t != sizeof(throw_values)/sizeof(throw_values[0]); ++t){
+      thrower::throw_value = throw_values[t];
+      BOOST_TEST_THROWS(boost::uninitialized_move(pol, src.data(), src.data() + n, buf), int);
+      BOOST_TEST_EQ(int(thrower::count), int(n));
+   }
+   thrower::throw_value = -1;
+   ::operator delete(buf);
+}
+
+int main()
+{
+   test_move();
+   test_overlapping();
+   test_uninitialized_move();
+   return boost::report_errors();
+}
@@ -0,0 +1,273 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/move/polymorphic_value.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+using namespace boost::movelib;
+
+struct shape
+{
+   static int count;
+   shape() {++count;}
+   shape(const shape&) BOOST_NOEXCEPT {++count;}
+   //Not virtual: polymorphic_value destroys the dynamic type
+   ~shape() {--count;}
+   virtual int area() const = 0;
+};
+
+int shape::count = 0;
+
+//Trivial enough to be relocated copying bytes
+struct square : shape
+{
+   int side;
+   explicit square(int s = 2) : side(s) {}
+   virtual int area() const { return side*side; }
+};
+
+//Moves through its move constructor
+class rect : public shape
+{
+   BOOST_COPYABLE_AND_MOVABLE(rect)
+
+   public:
+   static int moves;
+   int w, h;
+   rect(int x, int y) : w(x), h(y) {}
+   rect(const rect &r) : shape(r), w(r.w), h(r.h) {}
+   rect(BOOST_RV_REF(rect) r) BOOST_NOEXCEPT : shape(r), w(r.w), h(r.h) { r.w = r.h = 0; ++moves; }
+   rect& operator=(BOOST_COPY_ASSIGN_REF(rect) r) { w = r.w; h = r.h; return *this; }
+   rect& operator=(BOOST_RV_REF(rect) r) { w = r.w; h = r.h; return *this; }
+   virtual int area() const { return w*h; }
+};
+
+int rect::moves = 0;
+
+//Too big for the default buffer
+struct polygon : shape
+{
+   int v[16];
+   explicit polygon(int a) { v[0] = a; }
+   virtual int area() const { return v[0]; }
+};
+
+//The shape subobject is not at offset zero
+struct base_a { int a; base_a() : a(1) {} };
+struct offset_square : base_a, square
+{
+   offset_square() : square(3) {}
+};
+
+//C++03 compilers can't detect nothrow move constructors
+namespace boost{
+
+template<>
+struct has_nothrow_move<square>
+{
+   static const bool value = true;
+};
+
+template<>
+struct has_nothrow_move<rect>
+{
+   static const bool value = true;
+};
+
+template<>
+struct has_nothrow_move<polygon>
+{
+   static const bool value = true;
+};
+
+template<>
+struct has_nothrow_move<offset_square>
+{
+   static const bool value = true;
+};
+
+}  //namespace boost{
+
+//Copy constructor throws on demand
+struct throwing : shape
+{
+   static bool throw_on_copy;
+   explicit throwing(bool thr)
+   {
+      if(thr)
+         throw int(0);
+   }
+   throwing(const throwing &t) : shape(t)
+   {
+      if(throw_on_copy)
+         throw int(0);
+   }
+   throwing &operator=(const throwing &) { return *this; }
+   virtual int area() const { return 0; }
+};
+
+bool throwing::throw_on_copy = false;
+
+typedef polymorphic_value<shape> value_t;
+
+value_t make_and_return(int side)
+{
+   value_t v((square(side)));
+   return boost::move(v);
+}
+
+void test_storage()
+{
+   BOOST_TEST(value_t::is_inline_type<square>());
+   BOOST_TEST(value_t::is_inline_type<rect>());
+   BOOST_TEST(!value_t::is_inline_type<polygon>());
+   {
+      value_t v;
+      BOOST_TEST(!v.has_value());
+      BOOST_TEST(!v.is_inline());
+      BOOST_TEST(v.get() == 0);
+   }
+   {
+      value_t v(square(3));
+      BOOST_TEST(v.has_value());
+      BOOST_TEST(v.is_inline());
+      BOOST_TEST_EQ(v->area(), 9);
+      BOOST_TEST_EQ(shape::count, 1);
+
+      polygon &p = v.emplace<polygon>(7);
+      BOOST_TEST(!v.is_inline());
+      BOOST_TEST(v.get() == &p);
+      BOOST_TEST_EQ((*v).area(), 7);
+      BOOST_TEST_EQ(shape::count, 1);
+
+      v.emplace<rect>(2, 5);
+      BOOST_TEST(v.is_inline());
+      BOOST_TEST_EQ(v->area(), 10);
+
+      v.reset();
+      BOOST_TEST(!v.has_value());
+      BOOST_TEST_EQ(shape::count, 0);
+   }
+   {
+      value_t v(make_polymorphic_value<shape, rect>(3, 4));
+      BOOST_TEST_EQ(v->area(), 12);
+      value_t w(make_polymorphic_value<shape, polygon>(5));
+      BOOST_TEST_EQ(w->area(), 5);
+   }
+   {
+      //A bigger buffer stores polygons inline
+      polymorphic_value<shape, sizeof(polygon)> v(polygon(6));
+      BOOST_TEST(v.is_inline());
+      BOOST_TEST_EQ(v->area(), 6);
+   }
+   BOOST_TEST_EQ(shape::count, 0);
+}
+
+void test_copy()
+{
+   {
+      value_t a(square(4));
+      value_t b(a);
+      BOOST_TEST(b.is_inline());
+      BOOST_TEST(a.get() != b.get());
+      BOOST_TEST_EQ(b->area(), 16);
+      BOOST_TEST_EQ(shape::count, 2);
+
+      value_t c(polygon(8));
+      value_t d(c);
+      BOOST_TEST(c.get() != d.get());
+      BOOST_TEST_EQ(d->area(), 8);
+
+      a = c;
+      BOOST_TEST(!a.is_inline());
+      BOOST_TEST_EQ(a->area(), 8);
+      c = b;
+      BOOST_TEST(c.is_inline());
+      BOOST_TEST_EQ(c->area(), 16);
+      const value_t e;
+      c = e;
+      BOOST_TEST(!c.has_value());
+      BOOST_TEST_EQ(shape::count, 3);
+   }
+   {
+      //Strong guarantee in copy assignment
+      value_t a(square(2));
+      value_t b(throwing(false));
+      throwing::throw_on_copy = true;
+      BOOST_TEST_THROWS(a = b, int);
+      BOOST_TEST_THROWS(value_t c(b), int);
+      throwing::throw_on_copy = false;
+      BOOST_TEST_EQ(a->area(), 4);
+      BOOST_TEST_EQ(shape::count, 2);
+      BOOST_TEST_THROWS(a.emplace<throwing>(true), int);
+      BOOST_TEST(!a.has_value());
+      BOOST_TEST_EQ(shape::count, 1);
+   }
+   BOOST_TEST_EQ(shape::count, 0);
+}
+
+void test_move()
+{
+   {
+      value_t a(make_and_return(5));
+      BOOST_TEST_EQ(a->area(), 25);
+
+      //Heap objects are moved by pointer
+      value_t h(polygon(3));
+      shape *const p = h.get();
+      value_t h2(boost::move(h));
+      BOOST_TEST(!h.has_value());
+      BOOST_TEST(h2.get() == p);
+      BOOST_TEST_EQ(shape::count, 2);
+
+      //Inline objects are relocated
+      rect::moves = 0;
+      value_t r(rect(2, 3));
+      const int moves = rect::moves;
+      value_t r2(boost::move(r));
+      BOOST_TEST_EQ(rect::moves, moves + 1);
+      BOOST_TEST(!r.has_value());
+      BOOST_TEST(r2.is_inline());
+      BOOST_TEST_EQ(r2->area(), 6);
+      BOOST_TEST_EQ(shape::count, 3);
+
+      a = boost::move(h2);
+      BOOST_TEST(a.get() == p);
+      BOOST_TEST_EQ(shape::count, 2);
+      a = boost::move(r2);
+      BOOST_TEST_EQ(a->area(), 6);
+      BOOST_TEST_EQ(shape::count, 1);
+
+      value_t o((offset_square()));
+      BOOST_TEST_EQ(o->area(), 9);
+      value_t o2(boost::move(o));
+      BOOST_TEST_EQ(o2->area(), 9);
+      BOOST_TEST_EQ(static_cast<offset_square*>(static_cast<square*>(o2.get()))->a, 1);
+
+      o2.swap(a);
+      BOOST_TEST_EQ(o2->area(), 6);
+      BOOST_TEST_EQ(a->area(), 9);
+      value_t big(polygon(1));
+      swap(big, a);
+      BOOST_TEST_EQ(big->area(), 9);
+      BOOST_TEST_EQ(a->area(), 1);
+      BOOST_TEST(!a.is_inline());
+      BOOST_TEST(big.is_inline());
+   }
+   BOOST_TEST_EQ(shape::count, 0);
+}
+
+int main()
+{
+   test_storage();
+   test_copy();
+   test_move();
+   return boost::report_errors();
+}
@@ -0,0 +1,189 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/scratch_arena.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+using namespace boost::movelib;
+
+void test_arena()
+{
+   scratch_arena arena;
+   BOOST_TEST_EQ(arena.capacity(), 0u);
+   BOOST_TEST(!arena.in_use());
+
+   //Empty requests don't lock the arena nor count
+   BOOST_TEST(arena.acquire(0u) == 0);
+   BOOST_TEST(!arena.in_use());
+   BOOST_TEST_EQ(arena.stats().hits + arena.stats().misses + arena.stats().failures, 0u);
+
+   //First request allocates
+   void *p = arena.acquire(100u);
+   BOOST_TEST(p != 0);
+   BOOST_TEST(arena.in_use());
+   BOOST_TEST(arena.capacity() >= 100u);
+   BOOST_TEST_EQ(arena.capacity() % scratch_arena::alignment, 0u);
+   BOOST_TEST_EQ(std::size_t(p) % scratch_arena::alignment, 0u);
+   //Only one request at a time
+   BOOST_TEST(arena.acquire(10u) == 0);
+   arena.release();
+
+   //Smaller or equal requests reuse the block
+   BOOST_TEST(arena.acquire(50u) == p);
+   arena.release();
+   BOOST_TEST(arena.acquire(arena.capacity()) == p);
+   arena.release();
+
+   //Growth is geometric
+   std::size_t const old_cap = arena.capacity();
+   BOOST_TEST(arena.acquire(old_cap + 1u) != 0);
+   arena.release();
+   BOOST_TEST(arena.capacity() >= 2u*old_cap);
+   //Unless the request is bigger
+   BOOST_TEST(arena.acquire(arena.capacity()*4u) != 0);
+   arena.release();
+
+   BOOST_TEST_EQ(arena.stats().hits, 2u);
+   BOOST_TEST_EQ(arena.stats().misses, 3u);
+   BOOST_TEST_EQ(arena.stats().failures, 1u);
+   BOOST_TEST_EQ(arena.stats().peak_bytes, old_cap*2u*4u);
+
+   //Trim
+   std::size_t const cap = arena.capacity();
+   arena.trim(cap);
+   BOOST_TEST_EQ(arena.capacity(), cap);
+   arena.trim();
+   BOOST_TEST_EQ(arena.capacity(), 0u);
+
+   //Overflow
+   BOOST_TEST(arena.acquire(std::size_t(-1)) == 0);
+   BOOST_TEST_EQ(arena.stats().failures, 2u);
+   BOOST_TEST(!arena.in_use());
+
+   arena.clear_stats();
+   BOOST_TEST_EQ(arena.stats().hits + arena.stats().misses + arena.stats().failures + arena.stats().peak_bytes, 0u);
+}
+
+void test_allocator()
+{
+   const std::size_t n = 10001u;
+   scratch_arena arena;
+   unique_ptr<order_move_type[]> elements(new order_move_type[n]);
+
+   //Only the first call allocates
+   for(std::size_t i = 0; i != 3u; ++i){
+      fill_stable(elements.get(), n);
+      adaptive_sort(elements.get(), elements.get() + n, order_type_less(), scratch_arena_allocator<order_move_type>(arena));
+      BOOST_TEST(is_order_type_ordered(elements.get(), n));
+      BOOST_TEST(!arena.in_use());
+   }
+   BOOST_TEST_EQ(arena.stats().misses, 1u);
+   BOOST_TEST_EQ(arena.stats().hits, 2u);
+
+   //Merges reuse the block allocated by sorts
+   fill_stable(elements.get(), n);
+   adaptive_sort(elements.get(), elements.get() + n/2u, order_type_less());
+   adaptive_sort(elements.get() + n/2u, elements.get() + n, order_type_less());
+   adaptive_merge( elements.get(), elements.get() + n/2u, elements.get() + n, order_type_less()
+                 , scratch_arena_allocator<order_move_type>(arena));
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+   BOOST_TEST_EQ(arena.stats().misses, 1u);
+   BOOST_TEST_EQ(arena.stats().hits, 3u);
+
+   //A busy arena degrades to unbuffered sorting
+   void *const p = arena.acquire(1u);
+   fill_stable(elements.get(), n);
+   adaptive_sort(elements.get(), elements.get() + n, order_type_less(), scratch_arena_allocator<order_move_type>(arena));
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+   BOOST_TEST_EQ(arena.stats().failures, 2u);
+   BOOST_TEST(p != 0);
+   arena.release();
+
+   //Empty allocations neither lock nor release the arena
+   scratch_arena_allocator<order_move_type> a(arena);
+   order_move_type *const e = a.allocate(0u);
+   BOOST_TEST(e == 0);
+   BOOST_TEST(!arena.in_use());
+   order_move_type *const q = a.allocate(1u);
+   a.deallocate(e, 0u);
+   BOOST_TEST(arena.in_use());
+   a.deallocate(q, 1u);
+   BOOST_TEST(!arena.in_use());
+   BOOST_TEST_EQ(arena.stats().failures, 2u);
+}
+
+void test_scratch_buffer()
+{
+   const std::size_t n = 10001u;
+   scratch_arena arena;
+   unique_ptr<order_move_type[]> elements(new order_move_type[n]);
+
+   fill_stable(elements.get(), n);
+   {
+      scratch_buffer<order_move_type> buf(arena, (n+1u)/2u);
+      BOOST_TEST_EQ(buf.size(), (n+1u)/2u);
+      BOOST_TEST(arena.in_use());
+      merge_sort(elements.get(), elements.get() + n, order_type_less(), buf.data());
+   }
+   BOOST_TEST(!arena.in_use());
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+
+   fill_stable(elements.get(), n);
+   {
+      scratch_buffer<order_move_type> buf(arena, 2u*detail_adaptive::ceil_sqrt_multiple(n));
+      stable_sort_adaptive_ONlogN2(elements.get(), elements.get() + n, order_type_less(), buf.data(), buf.size());
+      //Nested requests fail
+      scratch_buffer<order_move_type> nested(arena, 10u);
+      BOOST_TEST(nested.data() == 0);
+      BOOST_TEST_EQ(nested.size(), 0u);
+   }
+   BOOST_TEST(is_order_type_ordered(elements.get(), n));
+   BOOST_TEST(!arena.in_use());
+   BOOST_TEST_EQ(arena.stats().misses, 1u);
+   BOOST_TEST_EQ(arena.stats().hits, 1u);
+}
+
+void test_thread_instance()
+{
+   #if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+   scratch_arena &arena = scratch_arena::thread_instance();
+   BOOST_TEST(&arena == &scratch_arena::thread_instance());
+   scratch_arena_allocator<order_move_type> a;
+   BOOST_TEST(&a.arena() == &arena);
+   scratch_arena_allocator<int> b(a);
+   BOOST_TEST(&b.arena() == &arena);
+
+   order_move_type elements[100];
+   fill_stable(elements, 100u);
+   adaptive_sort(elements, elements + 100, order_type_less(), a);
+   BOOST_TEST(is_order_type_ordered(elements, 100u));
+   BOOST_TEST_EQ(arena.stats().misses, 1u);
+   arena.trim();
+   #endif
+}
+
+int main()
+{
+   std::srand(0);
+   test_arena();
+   test_allocator();
+   test_scratch_buffer();
+   test_thread_instance();
+   return boost::report_errors();
+}
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#define BOOST_MOVE_SCRATCH_STATS
+
+#include <boost/move/algo/scratch_stats.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/detail/merge_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/force_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+using namespace boost::movelib;
+
+std::size_t log2_ceil(std::size_t n)
+{
+   std::size_t r = 0;
+   while((std::size_t(1u) << r) < n)
+      ++r;
+   return r;
+}
+
+void test_adaptive_sort(std::size_t element_count, std::size_t buf_len)
+{
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   unique_ptr<char[]> mem(new char[sizeof(order_perf_type)*(buf_len+1u)]);
+   fill_shuffled(elements.get(), element_count, 0u);
+
+   scratch_stats stats;
+   {
+      scoped_scratch_stats scope(stats);
+      adaptive_sort( elements.get(), elements.get() + element_count, order_type_less()
+                   , boost::move_detail::force_ptr<order_perf_type*>(mem.get()), buf_len);
+   }
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, false));
+   //Never more than the buffer capacity, keys included
+   BOOST_TEST(stats.peak_xbuf_elements <= buf_len);
+   BOOST_TEST_EQ(stats.peak_xbuf_bytes, stats.peak_xbuf_elements*sizeof(order_perf_type));
+   BOOST_TEST(stats.peak_xbuf_bytes + stats.peak_key_bytes <= buf_len*sizeof(order_perf_type));
+   if(buf_len){
+      BOOST_TEST(stats.peak_xbuf_elements != 0u);
+   }
+   BOOST_TEST_EQ(stats.recursion_depth, 0u);
+}
+
+void test_adaptive_merge(std::size_t element_count, std::size_t buf_len)
+{
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   unique_ptr<char[]> mem(new char[sizeof(order_perf_type)*(buf_len+1u)]);
+   fill_shuffled(elements.get(), element_count, 0u);
+   order_perf_type *const mid = elements.get() + element_count/2u;
+   adaptive_sort(elements.get(), mid, order_type_less());
+   adaptive_sort(mid, elements.get() + element_count, order_type_less());
+
+   scratch_stats stats;
+   {
+      scoped_scratch_stats scope(stats);
+      adaptive_merge( elements.get(), mid, elements.get() + element_count, order_type_less()
+                    , boost::move_detail::force_ptr<order_perf_type*>(mem.get()), buf_len);
+   }
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, false));
+   BOOST_TEST(stats.peak_xbuf_elements <= buf_len);
+   BOOST_TEST(stats.peak_xbuf_bytes + stats.peak_key_bytes <= buf_len*sizeof(order_perf_type));
+}
+
+void test_merge_sort()
+{
+   const std::size_t element_count = 10001u;
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   unique_ptr<char[]> mem(new char[sizeof(order_perf_type)*((element_count+1u)/2u)]);
+   fill_shuffled(elements.get(), element_count, 0u);
+
+   scratch_stats stats;
+   {
+      scoped_scratch_stats scope(stats);
+      merge_sort( elements.get(), elements.get() + element_count, order_type_less()
+                , boost::move_detail::force_ptr<order_perf_type*>(mem.get()));
+   }
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, true));
+   BOOST_TEST_EQ(stats.peak_xbuf_elements, (element_count+1u)/2u);
+   BOOST_TEST_EQ(stats.peak_key_bytes, 0u);
+   BOOST_TEST(stats.max_recursion_depth != 0u);
+   BOOST_TEST(stats.max_recursion_depth <= log2_ceil(element_count));
+   BOOST_TEST_EQ(stats.recursion_depth, 0u);
+}
+
+void test_pdqsort()
+{
+   const std::size_t element_count = 10001u;
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   fill_shuffled(elements.get(), element_count, 0u);
+
+   scratch_stats stats;
+   {
+      scoped_scratch_stats scope(stats);
+      pdqsort(elements.get(), elements.get() + element_count, order_type_less());
+   }
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, false));
+   BOOST_TEST_EQ(stats.peak_xbuf_elements, 0u);
+   BOOST_TEST(stats.max_recursion_depth != 0u);
+   BOOST_TEST(stats.max_recursion_depth < element_count);
+   BOOST_TEST_EQ(stats.recursion_depth, 0u);
+}
+
+void test_scopes()
+{
+   const std::size_t element_count = 1001u;
+   unique_ptr<order_perf_type[]> elements(new order_perf_type[element_count]);
+   fill_shuffled(elements.get(), element_count, 0u);
+
+   BOOST_TEST(scoped_scratch_stats::current() == 0);
+   scratch_stats outer, inner;
+   {
+      scoped_scratch_stats outer_scope(outer);
+      {
+         scoped_scratch_stats inner_scope(inner);
+         BOOST_TEST(scoped_scratch_stats::current() == &inner);
+         pdqsort(elements.get(), elements.get() + element_count, order_type_less());
+      }
+      BOOST_TEST(scoped_scratch_stats::current() == &outer);
+   }
+   BOOST_TEST(scoped_scratch_stats::current() == 0);
+   BOOST_TEST(inner.max_recursion_depth != 0u);
+   BOOST_TEST_EQ(outer.max_recursion_depth, 0u);
+
+   //Nothing is recorded without an active scope
+   fill_shuffled(elements.get(), element_count, 0u);
+   pdqsort(elements.get(), elements.get() + element_count, order_type_less());
+   BOOST_TEST_EQ(outer.max_recursion_depth, 0u);
+}
+
+int main()
+{
+   std::srand(0);
+
+   test_adaptive_sort(10001u, 0u);
+   test_adaptive_sort(10001u, 50u);
+   test_adaptive_sort(10001u, 101u);
+   test_adaptive_sort(10001u, 256u);
+   test_adaptive_sort(10001u, 5001u);
+
+   test_adaptive_merge(10001u, 0u);
+   test_adaptive_merge(10001u, 101u);
+   test_adaptive_merge(10001u, 256u);
+   test_adaptive_merge(10001u, 5001u);
+
+   test_merge_sort();
+   test_pdqsort();
+   test_scopes();
+
+   return boost::report_errors();
+}
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/sort.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <functional>   //std::less
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+void test_engine_selection()
+{
+   using namespace boost::movelib;
+   typedef order_move_type *it_t;
+
+   BOOST_TEST(select_sort_engine<it_t BOOST_MOVE_I order_type_less>(10u) == insertion_sort_engine);
+   BOOST_TEST(select_sort_engine<it_t BOOST_MOVE_I order_type_less>(1000u) == pdqsort_engine);
+
+   BOOST_TEST(select_stable_sort_engine<it_t BOOST_MOVE_I order_type_less>(10u) == insertion_sort_engine);
+   BOOST_TEST(select_stable_sort_engine<it_t BOOST_MOVE_I order_type_less>(1000u) == merge_sort_engine);
+   BOOST_TEST(select_stable_sort_engine<it_t BOOST_MOVE_I order_type_less>(1000u, 500u*sizeof(order_move_type)) == merge_sort_engine);
+   BOOST_TEST(select_stable_sort_engine<it_t BOOST_MOVE_I order_type_less>(1000u, 499u*sizeof(order_move_type)) == adaptive_sort_engine);
+   BOOST_TEST(select_stable_sort_engine<it_t BOOST_MOVE_I order_type_less>(1000u, 0u) == adaptive_sort_engine);
+
+   //Equivalent integers are indistinguishable so stability is not needed
+   BOOST_TEST((is_stability_irrelevant<std::less<int>, int>::value));
+   BOOST_TEST((is_stability_irrelevant<std::greater<unsigned>, unsigned>::value));
+   BOOST_TEST(!(is_stability_irrelevant<std::less<double>, double>::value));
+   BOOST_TEST(!(is_stability_irrelevant<order_type_less, order_move_type>::value));
+   BOOST_TEST(select_stable_sort_engine<int* BOOST_MOVE_I std::less<int> >(1000u, 0u) == pdqsort_engine);
+
+   BOOST_TEST(sort_engine_name(pdqsort_engine) != 0);
+}
+
+void test_sort(std::size_t element_count, std::size_t num_keys)
+{
+   boost::movelib::unique_ptr<order_move_type[]> elements(new order_move_type[element_count]);
+   fill_shuffled(elements.get(), element_count, num_keys);
+   boost::movelib::sort_engine e = boost::movelib::sort(elements.get(), elements.get() + element_count, order_type_less());
+   BOOST_TEST(e == boost::movelib::select_sort_engine<order_move_type* BOOST_MOVE_I order_type_less>(element_count));
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, false));
+}
+
+void test_stable_sort(std::size_t element_count, std::size_t num_keys, std::size_t max_memory)
+{
+   boost::movelib::unique_ptr<order_move_type[]> elements(new order_move_type[element_count]);
+   fill_shuffled(elements.get(), element_count, num_keys);
+   boost::movelib::sort_engine e = boost::movelib::stable_sort
+      (elements.get(), elements.get() + element_count, order_type_less(), max_memory);
+   BOOST_TEST(e == boost::movelib::select_stable_sort_engine<order_move_type* BOOST_MOVE_I order_type_less>(element_count, max_memory));
+   BOOST_TEST(is_order_type_ordered(elements.get(), element_count, true));
+}
+
+//Budgets between a quarter and a half of the range make adaptive_sort use a large
+//external buffer that merges the whole range in its first phase
+void test_stable_sort_budgets(std::size_t element_count, std::size_t num_keys)
+{
+   const std::size_t step = element_count/64u + 1u;
+   for(std::size_t budget = element_count/4u; budget < element_count/2u; budget += step){
+      test_stable_sort(element_count, num_keys, budget*sizeof(order_move_type));
+   }
+}
+
+void test_stable_sort_natural_order()
+{
+   int values[100];
+   for(int i = 0; i != 100; ++i){
+      values[i] = (i*37) % 23;
+   }
+   BOOST_TEST(boost::movelib::stable_sort(values, values + 100, std::less<int>()) == boost::movelib::pdqsort_engine);
+   for(int i = 1; i != 100; ++i){
+      BOOST_TEST(values[i-1] <= values[i]);
+   }
+}
+
+int main()
+{
+   std::srand(0);
+   test_engine_selection();
+
+   const std::size_t sizes[] = { 0u, 1u, 15u, 16u, 17u, 1001u, 10001u };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(*sizes); ++i){
+      test_sort(sizes[i], 0u);
+      test_sort(sizes[i], 7u);
+      test_stable_sort(sizes[i], 0u, boost::movelib::unlimited_sort_memory);
+      test_stable_sort(sizes[i], 7u, boost::movelib::unlimited_sort_memory);
+      test_stable_sort(sizes[i], 65u, 0u);
+      test_stable_sort(sizes[i], 0u, 64u*sizeof(order_move_type));
+   }
+   const std::size_t budget_sizes[] = { 17u, 20u, 100u, 1001u };
+   for(std::size_t i = 0; i != sizeof(budget_sizes)/sizeof(*budget_sizes); ++i){
+      test_stable_sort_budgets(budget_sizes[i], 1u);
+      test_stable_sort_budgets(budget_sizes[i], 3u);
+      test_stable_sort_budgets(budget_sizes[i], 7u);
+      test_stable_sort_budgets(budget_sizes[i], 0u);
+   }
+   test_stable_sort_natural_order();
+
+   return boost::report_errors();
+}
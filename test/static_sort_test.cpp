@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Also test the base cases of pdqsort and adaptive_sort
+#define BOOST_MOVE_SORTING_NETWORK_BASE_CASES
+
+#include <boost/move/algo/static_sort.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/algo/detail/is_sorted.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/move/detail/reverse_iterator.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+struct counting_less
+{
+   explicit counting_less(std::size_t &count)
+      : m_count(&count)
+   {}
+
+   template<class T>
+   bool operator()(const T &a, const T &b) const
+   {  ++*m_count; return a < b;  }
+
+   std::size_t *m_count;
+};
+
+//By the 0-1 principle, a network sorts any input if it sorts all 2^N binary sequences
+template<std::size_t N>
+bool sorts_binary_sequences()
+{
+   int v[N ? N : 1u];
+   for(unsigned long bits = 0; bits != (1ul << N); ++bits){
+      for(std::size_t i = 0; i != N; ++i)
+         v[i] = int((bits >> i) & 1u);
+      boost::movelib::static_sort<N>(v, less_int());
+      if(!boost::movelib::is_sorted(v, v + N, less_int()))
+         return false;
+   }
+   return true;
+}
+
+template<std::size_t N>
+std::size_t comparisons()
+{
+   int v[N ? N : 1u] = {};
+   std::size_t count = 0u;
+   boost::movelib::static_sort<N>(v, counting_less(count));
+   return count;
+}
+
+template<std::size_t N>
+void test_random()
+{
+   int v[N];
+   for(std::size_t it = 0; it != 200u; ++it){
+      for(std::size_t i = 0; i != N; ++i)
+         v[i] = std::rand() % 7;
+      boost::movelib::static_sort<N>(v, less_int());
+      BOOST_TEST(boost::movelib::is_sorted(v, v + N, less_int()));
+   }
+   //Reverse iterators and a descending order
+   for(std::size_t i = 0; i != N; ++i)
+      v[i] = int(i);
+   boost::movelib::static_sort<N>(boost::movelib::reverse_iterator<int*>(v + N), less_int());
+   for(std::size_t i = 0; i != N; ++i)
+      BOOST_TEST_EQ(v[i], int(N - 1u - i));
+}
+
+template<class T, std::size_t N>
+void init_keys(T (&v)[N], std::size_t num_keys)
+{
+   std::size_t reps[N];
+   for(std::size_t i = 0; i != N; ++i){
+      v[i].key = i % num_keys;
+      reps[i] = 0u;
+   }
+   ::random_shuffle(v, v + N);
+   for(std::size_t i = 0; i != N; ++i)
+      v[i].val = reps[v[i].key]++;
+}
+
+template<std::size_t N>
+void test_stable()
+{
+   order_perf_type v[N];
+   for(std::size_t it = 0; it != 50u; ++it){
+      init_keys(v, 3u);
+      boost::movelib::static_stable_sort<N>(v, order_type_less());
+      BOOST_TEST(is_order_type_ordered(v, N, true));
+   }
+   std::size_t count = 0u;
+   boost::movelib::static_stable_sort<N>(v, counting_less(count));
+   BOOST_TEST_EQ(count, N*(N - 1u)/2u);
+}
+
+template<std::size_t N>
+void test_move_only()
+{
+   //Non-trivial elements are swapped
+   order_move_type v[N];
+   for(std::size_t i = 0; i != N; ++i)
+      v[i].key = N - i;
+   boost::movelib::static_sort<N>(v, order_type_less());
+   BOOST_TEST(is_order_type_ordered(v, N, false));
+   for(std::size_t i = 0; i != N; ++i)
+      v[i].key = N - i;
+   boost::movelib::static_stable_sort<N>(v, order_type_less());
+   BOOST_TEST(is_order_type_ordered(v, N, false));
+}
+
+//Trivially copyable, sorted with networks in base cases
+struct pod_record
+{
+   unsigned key;
+   unsigned val;
+
+   friend bool operator<(const pod_record &l, const pod_record &r)
+   {  return l.key < r.key;  }
+};
+
+BOOST_MOVE_STATIC_ASSERT((boost::movelib::detail_static_sort::use_network_base_case<pod_record*>::value));
+
+void test_base_cases()
+{
+   const std::size_t n = 10000u;
+   const std::size_t num_keys = 100u;
+   boost::movelib::unique_ptr<pod_record[]> orig(new pod_record[n]), v(new pod_record[n]), buf(new pod_record[n]);
+   std::size_t reps[num_keys] = {};
+   for(std::size_t i = 0; i != n; ++i)
+      orig[i].key = unsigned(i % num_keys);
+   ::random_shuffle(orig.get(), orig.get() + n);
+   for(std::size_t i = 0; i != n; ++i)
+      orig[i].val = unsigned(reps[orig[i].key]++);
+
+   for(std::size_t i = 0; i != n; ++i)
+      v[i] = orig[i];
+   boost::movelib::pdqsort(v.get(), v.get() + n, order_type_less());
+   BOOST_TEST(is_order_type_ordered(v.get(), n, false));
+
+   const std::size_t buf_lens[] = { 0u, n };
+   for(std::size_t b = 0; b != sizeof(buf_lens)/sizeof(*buf_lens); ++b){
+      for(std::size_t i = 0; i != n; ++i)
+         v[i] = orig[i];
+      boost::movelib::adaptive_sort(v.get(), v.get() + n, order_type_less(), buf.get(), buf_lens[b]);
+      BOOST_TEST(is_order_type_ordered(v.get(), n, true));
+   }
+}
+
+int main()
+{
+   BOOST_TEST(sorts_binary_sequences<0>());
+   BOOST_TEST(sorts_binary_sequences<1>());
+   BOOST_TEST(sorts_binary_sequences<2>());
+   BOOST_TEST(sorts_binary_sequences<3>());
+   BOOST_TEST(sorts_binary_sequences<4>());
+   BOOST_TEST(sorts_binary_sequences<5>());
+   BOOST_TEST(sorts_binary_sequences<6>());
+   BOOST_TEST(sorts_binary_sequences<7>());
+   BOOST_TEST(sorts_binary_sequences<8>());
+   BOOST_TEST(sorts_binary_sequences<9>());
+   BOOST_TEST(sorts_binary_sequences<10>());
+   BOOST_TEST(sorts_binary_sequences<11>());
+   BOOST_TEST(sorts_binary_sequences<12>());
+   BOOST_TEST(sorts_binary_sequences<13>());
+   BOOST_TEST(sorts_binary_sequences<14>());
+   BOOST_TEST(sorts_binary_sequences<15>());
+   BOOST_TEST(sorts_binary_sequences<16>());
+   BOOST_TEST(sorts_binary_sequences<17>());
+   BOOST_TEST(sorts_binary_sequences<20>());
+
+   BOOST_TEST_EQ(comparisons<4>(), 5u);
+   BOOST_TEST_EQ(comparisons<5>(), 9u);
+   BOOST_TEST_EQ(comparisons<6>(), 12u);
+   BOOST_TEST_EQ(comparisons<7>(), 16u);
+   BOOST_TEST_EQ(comparisons<8>(), 19u);
+   BOOST_TEST_EQ(comparisons<16>(), 60u);
+   BOOST_TEST_EQ(comparisons<32>(), 191u);
+
+   test_random<24>();
+   test_random<32>();
+   test_random<33>();
+
+   test_stable<1>();
+   test_stable<2>();
+   test_stable<7>();
+   test_stable<16>();
+   test_stable<32>();
+
+   test_move_only<5>();
+   test_move_only<16>();
+   test_move_only<32>();
+
+   //Runtime dispatch for small ranges
+   for(std::size_t n = 0; n <= 17u; ++n){
+      int v[17];
+      for(std::size_t i = 0; i != n; ++i)
+         v[i] = int(n - i);
+      const bool handled = boost::movelib::detail_static_sort::static_sort_small(v, n, less_int());
+      BOOST_TEST_EQ(handled, n <= 16u);
+      BOOST_TEST(!handled || boost::movelib::is_sorted(v, v + n, less_int()));
+   }
+   test_base_cases();
+   return boost::report_errors();
+}
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/streaming_move.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <new>
+
+using namespace boost::movelib;
+
+void test_alignments()
+{
+   //All sizes and misalignments of source and destination around the 16 and 64 byte blocks
+   const std::size_t max_n = 300u;
+   unsigned char src[max_n + 16u], dst[max_n + 16u];
+   for(std::size_t i = 0; i != sizeof(src); ++i)
+      src[i] = static_cast<unsigned char>(i*7u + 1u);
+   bool ok = true;
+   for(std::size_t n = 0; n <= max_n; ++n){
+      for(std::size_t so = 0; so < 16u; so += 5u){
+         for(std::size_t d = 0; d != 16u; ++d){
+            for(std::size_t i = 0; i != sizeof(dst); ++i)
+               dst[i] = 0u;
+            ok = ok && streaming_move(src + so, src + so + n, dst + d, 0u) == dst + d + n;
+            for(std::size_t i = 0; i != sizeof(dst); ++i){
+               const bool in_range = i >= d && i < d + n;
+               ok = ok && dst[i] == (in_range ? src[so + i - d] : 0u);
+            }
+         }
+      }
+   }
+   BOOST_TEST(ok);
+}
+
+void test_threshold()
+{
+   //Bigger than the default threshold
+   const std::size_t n = BOOST_MOVE_STREAMING_THRESHOLD/sizeof(int) + 1000u;
+   boost::container::vector<int> src(n), dst(n);
+   for(std::size_t i = 0; i != n; ++i)
+      src[i] = int(i);
+   BOOST_TEST(streaming_move(src.data(), src.data() + n, dst.data()) == dst.data() + n);
+   bool ok = true;
+   for(std::size_t i = 0; i != n; ++i)
+      ok = ok && dst[i] == int(i);
+   BOOST_TEST(ok);
+
+   //Smaller ranges are copied normally
+   int small_dst[10];
+   BOOST_TEST(streaming_move(src.data(), src.data() + 10, small_dst) == small_dst + 10);
+   BOOST_TEST_EQ(small_dst[9], 9);
+
+   //Iterators
+   boost::container::vector<int> dst2(n);
+   BOOST_TEST(streaming_move(src.begin(), src.end(), dst2.begin(), 0u) == dst2.end());
+   BOOST_TEST(dst2 == src);
+}
+
+void test_uninitialized()
+{
+   const std::size_t n = 1000u;
+   double src[n];
+   for(std::size_t i = 0; i != n; ++i)
+      src[i] = double(i);
+   double *const buf = static_cast<double*>(::operator new(n*sizeof(double)));
+   BOOST_TEST(streaming_uninitialized_move(src, src + n, buf, 0u) == buf + n);
+   bool ok = true;
+   for(std::size_t i = 0; i != n; ++i)
+      ok = ok && buf[i] == double(i);
+   BOOST_TEST(ok);
+   ::operator delete(buf);
+}
+
+void test_non_trivial()
+{
+   //Elements that are not trivially movable are moved normally
+   const std::size_t n = 100u;
+   unique_ptr<int> src[n], dst[n];
+   for(std::size_t i = 0; i != n; ++i)
+      src[i].reset(new int(int(i)));
+   BOOST_TEST(streaming_move(src, src + n, dst, 0u) == dst + n);
+   bool ok = true;
+   for(std::size_t i = 0; i != n; ++i)
+      ok = ok && !src[i] && *dst[i] == int(i);
+   BOOST_TEST(ok);
+
+   unique_ptr<int> *const buf = static_cast<unique_ptr<int>*>(::operator new(n*sizeof(unique_ptr<int>)));
+   BOOST_TEST(streaming_uninitialized_move(dst, dst + n, buf, 0u) == buf + n);
+   ok = true;
+   for(std::size_t i = 0; i != n; ++i){
+      ok = ok && !dst[i] && *buf[i] == int(i);
+      buf[i].~unique_ptr<int>();
+   }
+   BOOST_TEST(ok);
+   ::operator delete(buf);
+}
+
+int main()
+{
+   test_alignments();
+   test_threshold();
+   test_uninitialized();
+   test_non_trivial();
+   return boost::report_errors();
+}
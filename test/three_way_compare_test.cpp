@@ -0,0 +1,223 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/move/algo/three_way_compare.hpp>
+#include <boost/move/algo/detail/set_difference.hpp>
+#include <boost/move/algo/detail/pdqsort.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/unique.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__cpp_lib_three_way_comparison)
+#include <compare>
+#endif
+
+struct record
+{
+   std::size_t key;
+   std::size_t val;
+};
+
+std::size_t num_calls = 0u;
+
+struct record_less
+{
+   bool operator()(const record &l, const record &r) const
+   {  ++num_calls; return l.key < r.key;  }
+};
+
+//strcmp-like comparator
+struct record_compare
+{
+   int operator()(const record &l, const record &r) const
+   {  ++num_calls; return l.key < r.key ? -1 : int(r.key < l.key);  }
+};
+
+#if defined(__cpp_lib_three_way_comparison)
+
+struct record_spaceship
+{
+   std::strong_ordering operator()(const record &l, const record &r) const
+   {  ++num_calls; return l.key <=> r.key;  }
+};
+
+#endif
+
+typedef boost::movelib::unique_ptr<record[]> record_array;
+
+//Sorted range with repeated keys, val holds the position
+void fill_sorted(record *r, std::size_t n, std::size_t step)
+{
+   std::size_t key = 0u;
+   for(std::size_t i = 0; i != n; ++i){
+      key += std::size_t(std::rand()) % step;
+      r[i].key = key;
+      r[i].val = i;
+   }
+}
+
+bool equal_ranges(const record *a, const record *a_end, const record *b, const record *b_end)
+{
+   if((a_end - a) != (b_end - b))
+      return false;
+   for(; a != a_end; ++a, ++b){
+      if(a->key != b->key || a->val != b->val)
+         return false;
+   }
+   return true;
+}
+
+template<class Comp3>
+void test_set_algorithms(Comp3 comp3)
+{
+   const std::size_t n1 = 2000u, n2 = 1500u;
+   for(std::size_t step = 1u; step != 5u; ++step){
+      record_array r1(new record[n1]), r2(new record[n2]), out_b(new record[n1]), out_3(new record[n1]);
+      fill_sorted(r1.get(), n1, step);
+      fill_sorted(r2.get(), n2, step);
+
+      //set_difference
+      num_calls = 0u;
+      record *const end_b = boost::movelib::set_difference(r1.get(), r1.get() + n1, r2.get(), r2.get() + n2, out_b.get(), record_less());
+      const std::size_t calls_b = num_calls;
+      num_calls = 0u;
+      record *const end_3 = boost::movelib::set_difference
+         (r1.get(), r1.get() + n1, r2.get(), r2.get() + n2, out_3.get(), boost::movelib::make_three_way_compare(comp3));
+      BOOST_TEST(equal_ranges(out_b.get(), end_b, out_3.get(), end_3));
+      BOOST_TEST(num_calls < calls_b);
+
+      //Once range 2 is exhausted range 1 is copied
+      record *const end_c = boost::movelib::set_difference
+         (r1.get(), r1.get() + n1, r2.get(), r2.get(), out_3.get(), boost::movelib::make_three_way_compare(comp3));
+      BOOST_TEST(equal_ranges(r1.get(), r1.get() + n1, out_3.get(), end_c));
+
+      //set_unique_difference
+      num_calls = 0u;
+      record *const uend_b = boost::movelib::set_unique_difference(r1.get(), r1.get() + n1, r2.get(), r2.get() + n2, out_b.get(), record_less());
+      const std::size_t ucalls_b = num_calls;
+      num_calls = 0u;
+      record *const uend_3 = boost::movelib::set_unique_difference
+         (r1.get(), r1.get() + n1, r2.get(), r2.get() + n2, out_3.get(), boost::movelib::make_three_way_compare(comp3));
+      BOOST_TEST(equal_ranges(out_b.get(), uend_b, out_3.get(), uend_3));
+      BOOST_TEST(num_calls < ucalls_b);
+
+      //inplace versions
+      for(std::size_t i = 0; i != n1; ++i)
+         out_b[i] = out_3[i] = r1[i];
+      record *const iend_b = boost::movelib::inplace_set_difference(out_b.get(), out_b.get() + n1, r2.get(), r2.get() + n2, record_less());
+      record *const iend_3 = boost::movelib::inplace_set_difference
+         (out_3.get(), out_3.get() + n1, r2.get(), r2.get() + n2, boost::movelib::make_three_way_compare(comp3));
+      BOOST_TEST(equal_ranges(out_b.get(), iend_b, out_3.get(), iend_3));
+
+      for(std::size_t i = 0; i != n1; ++i)
+         out_b[i] = out_3[i] = r1[i];
+      record *const iuend_b = boost::movelib::inplace_set_unique_difference(out_b.get(), out_b.get() + n1, r2.get(), r2.get() + n2, record_less());
+      record *const iuend_3 = boost::movelib::inplace_set_unique_difference
+         (out_3.get(), out_3.get() + n1, r2.get(), r2.get() + n2, boost::movelib::make_three_way_compare(comp3));
+      BOOST_TEST(equal_ranges(out_b.get(), iuend_b, out_3.get(), iuend_3));
+   }
+}
+
+//Boolean comparators skip elements of range 2 with a single call
+void test_inplace_unique_difference_calls()
+{
+   const std::size_t n = 100u;
+   record r1[n], r2[n];
+   for(std::size_t i = 0; i != n; ++i){
+      r1[i].key = n + i;
+      r2[i].key = i;
+      r1[i].val = r2[i].val = i;
+   }
+   num_calls = 0u;
+   record *const end = boost::movelib::inplace_set_unique_difference(r1, r1 + n, r2, r2 + n, record_less());
+   BOOST_TEST(end == r1 + n);
+   //n calls to skip range 2 and n-1 calls to skip duplicates in range 1
+   BOOST_TEST_EQ(num_calls, 2u*n - 1u);
+}
+
+template<class Comp3>
+void test_unique(Comp3 comp3)
+{
+   const std::size_t n = 1000u;
+   record_array a(new record[n]), b(new record[n]);
+   fill_sorted(a.get(), n, 3u);
+   for(std::size_t i = 0; i != n; ++i)
+      b[i] = a[i];
+   num_calls = 0u;
+   record *const end_b = boost::movelib::unique(a.get(), a.get() + n, boost::movelib::make_equivalence(record_less()));
+   //Equivalent neighbours need a second call
+   BOOST_TEST(num_calls > n - 1u);
+   num_calls = 0u;
+   record *const end_3 = boost::movelib::unique(b.get(), b.get() + n
+      , boost::movelib::make_equivalence(boost::movelib::make_three_way_compare(comp3)));
+   BOOST_TEST_EQ(num_calls, n - 1u);
+   BOOST_TEST(equal_ranges(a.get(), end_b, b.get(), end_3));
+}
+
+template<class Comp3>
+void test_sort(Comp3 comp3)
+{
+   const std::size_t n = 5000u;
+   record_array orig(new record[n]), a(new record[n]), b(new record[n]);
+   const std::size_t num_keys[] = { 10u, 100u, n };
+   for(std::size_t k = 0; k != sizeof(num_keys)/sizeof(*num_keys); ++k){
+      for(std::size_t i = 0; i != n; ++i){
+         orig[i].key = std::size_t(std::rand()) % num_keys[k];
+         orig[i].val = i;
+      }
+
+      //adaptive_sort without buffer collects unique keys
+      for(std::size_t i = 0; i != n; ++i)
+         a[i] = b[i] = orig[i];
+      boost::movelib::adaptive_sort(a.get(), a.get() + n, record_less(), (record*)0, 0u);
+      boost::movelib::adaptive_sort(b.get(), b.get() + n, boost::movelib::make_three_way_compare(comp3), (record*)0, 0u);
+      BOOST_TEST(equal_ranges(a.get(), a.get() + n, b.get(), b.get() + n));
+      for(std::size_t i = 1; i < n; ++i){
+         BOOST_TEST(b[i-1].key < b[i].key || (b[i-1].key == b[i].key && b[i-1].val < b[i].val));
+      }
+
+      //adaptive_merge
+      const std::size_t half = n/2u;
+      for(std::size_t i = 0; i != n; ++i)
+         b[i] = orig[i];
+      boost::movelib::pdqsort(b.get(), b.get() + half, boost::movelib::make_three_way_compare(comp3));
+      boost::movelib::pdqsort(b.get() + half, b.get() + n, boost::movelib::make_three_way_compare(comp3));
+      for(std::size_t i = 0; i != n; ++i)
+         b[i].val = i;
+      for(std::size_t i = 0; i != n; ++i)
+         a[i] = b[i];
+      boost::movelib::adaptive_merge(a.get(), a.get() + half, a.get() + n, record_less(), (record*)0, 0u);
+      boost::movelib::adaptive_merge(b.get(), b.get() + half, b.get() + n, boost::movelib::make_three_way_compare(comp3), (record*)0, 0u);
+      BOOST_TEST(equal_ranges(a.get(), a.get() + n, b.get(), b.get() + n));
+   }
+}
+
+template<class Comp3>
+void test_comparator(Comp3 comp3)
+{
+   test_set_algorithms(comp3);
+   test_unique(comp3);
+   test_sort(comp3);
+}
+
+int main()
+{
+   test_inplace_unique_difference_calls();
+   test_comparator(record_compare());
+   #if defined(__cpp_lib_three_way_comparison)
+   test_comparator(record_spaceship());
+   #endif
+   return boost::report_errors();
+}
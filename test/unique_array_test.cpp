@@ -0,0 +1,193 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/move/unique_array.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+
+#include "order_type.hpp"
+#include "random_shuffle.hpp"
+
+using namespace boost::movelib;
+
+struct A
+{
+   int a;
+   static int count;
+   A() : a(999) {++count;}
+   A(const A&) : a(0) {++count;}
+   ~A() {--count;}
+};
+
+int A::count = 0;
+
+//Throws when "throw_at" objects have been constructed
+struct T
+{
+   static int count;
+   static int throw_at;
+   T()
+   {
+      if(count == throw_at)
+         throw int(0);
+      ++count;
+   }
+   ~T() {--count;}
+};
+
+int T::count = 0;
+int T::throw_at = -1;
+
+unique_array<A> make_and_return(std::size_t n)
+{
+   unique_array<A> a(make_unique_array<A>(n));
+   return boost::move(a);
+}
+
+void test_construction()
+{
+   {
+      unique_array<A> a;
+      BOOST_TEST(a.data() == 0);
+      BOOST_TEST(a.empty());
+      BOOST_TEST_EQ(a.capacity(), 0u);
+      BOOST_TEST(a.begin() == a.end());
+   }
+   {
+      unique_array<A> a(make_unique_array<A>(10u));
+      BOOST_TEST_EQ(A::count, 10);
+      BOOST_TEST_EQ(a.size(), 10u);
+      BOOST_TEST_EQ(a.capacity(), 10u);
+      BOOST_TEST_EQ(a.spare_capacity(), 0u);
+      std::size_t n = 0;
+      for(unique_array<A>::iterator it = a.begin(); it != a.end(); ++it, ++n){
+         BOOST_TEST_EQ(it->a, 999);
+      }
+      BOOST_TEST_EQ(n, 10u);
+      BOOST_TEST_EQ(a[9].a, 999);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+   {
+      unique_array<int> v(make_unique_array<int>(100u));
+      for(std::size_t i = 0; i != 100u; ++i){
+         BOOST_TEST_EQ(v[i], 0);
+      }
+      unique_array<int> d(make_unique_array_definit<int>(100u));
+      BOOST_TEST_EQ(d.size(), 100u);
+      d[99] = 1;
+      BOOST_TEST_EQ(d[99], 1);
+      unique_array<int> n(make_unique_array_nothrow<int>(5u));
+      BOOST_TEST_EQ(n.size(), 5u);
+      BOOST_TEST_EQ(n[4], 0);
+      unique_array<int> nd(make_unique_array_nothrow_definit<int>(5u));
+      BOOST_TEST_EQ(nd.size(), 5u);
+   }
+   {
+      //Allocation failures
+      unique_array<int> n(make_unique_array_nothrow<int>(std::size_t(-1)/2u));
+      BOOST_TEST(n.data() == 0);
+      BOOST_TEST_EQ(n.size(), 0u);
+      unique_array<int> u(make_unique_array_nothrow_uninit<int>(std::size_t(-1)/2u));
+      BOOST_TEST(u.data() == 0);
+      BOOST_TEST_EQ(u.capacity(), 0u);
+      BOOST_TEST_THROWS(make_unique_array<int>(std::size_t(-1)/2u), std::bad_alloc);
+   }
+   {
+      //Constructor exceptions
+      T::throw_at = 5;
+      BOOST_TEST_THROWS(make_unique_array<T>(10u), int);
+      BOOST_TEST_EQ(T::count, 0);
+      T::throw_at = -1;
+   }
+}
+
+void test_ownership()
+{
+   {
+      unique_array<A> a(make_and_return(3u));
+      BOOST_TEST_EQ(a.size(), 3u);
+      unique_array<A> b(boost::move(a));
+      BOOST_TEST(a.data() == 0);
+      BOOST_TEST_EQ(a.size(), 0u);
+      BOOST_TEST_EQ(b.size(), 3u);
+      a = make_unique_array<A>(2u);
+      BOOST_TEST_EQ(A::count, 5);
+      a = boost::move(b);
+      BOOST_TEST_EQ(A::count, 3);
+      BOOST_TEST_EQ(a.size(), 3u);
+      BOOST_TEST(b.data() == 0);
+
+      b = make_unique_array<A>(1u);
+      ::boost::adl_move_swap(a, b);
+      BOOST_TEST_EQ(a.size(), 1u);
+      BOOST_TEST_EQ(b.size(), 3u);
+
+      //Clear keeps the storage
+      A *const p = b.data();
+      b.clear();
+      BOOST_TEST_EQ(A::count, 1);
+      BOOST_TEST(b.data() == p);
+      BOOST_TEST_EQ(b.capacity(), 3u);
+      BOOST_TEST(b.spare_data() == p);
+      BOOST_TEST_EQ(b.spare_capacity(), 3u);
+      b.reset();
+      BOOST_TEST(b.data() == 0);
+      BOOST_TEST_EQ(b.capacity(), 0u);
+
+      //Release transfers ownership to the caller
+      std::size_t const sz = a.size();
+      A *const r = a.release();
+      BOOST_TEST(a.data() == 0);
+      for(std::size_t i = 0; i != sz; ++i){
+         r[i].~A();
+      }
+      ::operator delete(r);
+   }
+   BOOST_TEST_EQ(A::count, 0);
+}
+
+void test_scratch_buffer()
+{
+   const std::size_t n = 10001u;
+   unique_array<order_move_type> elements(make_unique_array<order_move_type>(n));
+   unique_array<order_move_type> buf(make_unique_array_uninit<order_move_type>((n+1u)/2u));
+   BOOST_TEST_EQ(buf.size(), 0u);
+   BOOST_TEST_EQ(buf.capacity(), (n+1u)/2u);
+
+   fill_stable(elements.data(), n);
+   adaptive_sort(elements.begin(), elements.end(), order_type_less(), buf);
+   BOOST_TEST(is_order_type_ordered(elements.data(), n));
+   BOOST_TEST_EQ(buf.size(), 0u);
+
+   fill_stable(elements.data(), n);
+   adaptive_sort(elements.begin(), elements.begin() + n/2u, order_type_less(), buf);
+   adaptive_sort(elements.begin() + n/2u, elements.end(), order_type_less(), buf);
+   adaptive_merge(elements.begin(), elements.begin() + n/2u, elements.end(), order_type_less(), buf);
+   BOOST_TEST(is_order_type_ordered(elements.data(), n));
+
+   //Constructed elements are not used as buffer
+   unique_array<order_move_type> full(make_unique_array<order_move_type>(10u));
+   full[0].key = 1234u;
+   fill_stable(elements.data(), n);
+   adaptive_sort(elements.begin(), elements.end(), order_type_less(), full);
+   BOOST_TEST(is_order_type_ordered(elements.data(), n));
+   BOOST_TEST_EQ(full[0].key, 1234u);
+}
+
+int main()
+{
+   std::srand(0);
+   test_construction();
+   test_ownership();
+   test_scratch_buffer();
+   return boost::report_errors();
+}
@@ -0,0 +1,249 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/move for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/move/unique_function.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+using namespace boost::movelib;
+
+int add(int a, int b)
+{  return a + b;  }
+
+void increment(int &i)
+{  ++i;  }
+
+//Small, trivial callable
+struct multiplier
+{
+   int factor;
+   explicit multiplier(int f) : factor(f) {}
+   int operator()(int a) const { return a*factor; }
+};
+
+//Move-only callable
+class owner
+{
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(owner)
+
+   public:
+   static int count;
+   unique_ptr<int> p;
+
+   explicit owner(int v) : p(new int(v)) { ++count; }
+   owner(BOOST_RV_REF(owner) o) BOOST_NOEXCEPT : p(boost::move(o.p)) { ++count; }
+   owner& operator=(BOOST_RV_REF(owner) o) { p = boost::move(o.p); return *this; }
+   ~owner() { --count; }
+   int operator()(int a) { return *p += a; }
+};
+
+int owner::count = 0;
+
+//Too big for the default buffer
+struct big
+{
+   static int count;
+   int v[16];
+   explicit big(int a) { v[0] = a; ++count; }
+   big(const big &b) { v[0] = b.v[0]; ++count; }
+   big &operator=(const big &b) { v[0] = b.v[0]; return *this; }
+   ~big() { --count; }
+   int operator()(int a) const { return a + v[0]; }
+};
+
+int big::count = 0;
+
+//Throws when constructed with true
+struct throwing
+{
+   static int count;
+   explicit throwing(bool thr)
+   {
+      if(thr)
+         throw int(0);
+      ++count;
+   }
+   throwing(const throwing &t)
+   {
+      if(t.count < 0)
+         throw int(0);
+      ++count;
+   }
+   throwing &operator=(const throwing &) { return *this; }
+   ~throwing() { --count; }
+   int operator()(int a) const { return a; }
+};
+
+int throwing::count = 0;
+
+//Takes a move-only argument by value
+struct sink
+{
+   int operator()(unique_ptr<int> p) const { return *p; }
+};
+
+//C++03 compilers can't detect nothrow move constructors
+namespace boost{
+
+template<>
+struct has_nothrow_move<owner>
+{
+   static const bool value = true;
+};
+
+template<>
+struct has_nothrow_move<big>
+{
+   static const bool value = true;
+};
+
+}  //namespace boost{
+
+typedef unique_function<int(int)> int_function;
+
+int_function make_owner_function(int v)
+{
+   owner o(v);
+   int_function f(boost::move(o));
+   return boost::move(f);
+}
+
+void test_construction()
+{
+   {
+      int_function f;
+      BOOST_TEST(!f);
+      BOOST_TEST(!f.is_inline());
+   }
+   {
+      unique_function<int(int, int)> f(add);
+      BOOST_TEST(!!f);
+      BOOST_TEST(f.is_inline());
+      BOOST_TEST_EQ(f(2, 3), 5);
+      unique_function<int(int, int)> g(&add);
+      BOOST_TEST_EQ(g(4, 3), 7);
+   }
+   {
+      BOOST_TEST(int_function::is_inline_type<multiplier>());
+      int_function f((multiplier(3)));
+      BOOST_TEST(f.is_inline());
+      BOOST_TEST_EQ(f(5), 15);
+   }
+   {
+      BOOST_TEST(!int_function::is_inline_type<big>());
+      int_function f((big(10)));
+      BOOST_TEST(!f.is_inline());
+      BOOST_TEST_EQ(f(5), 15);
+      BOOST_TEST_EQ(big::count, 1);
+      //A bigger buffer stores it inline
+      unique_function<int(int), sizeof(big)> g((big(1)));
+      BOOST_TEST(g.is_inline());
+      BOOST_TEST_EQ(g(1), 2);
+   }
+   BOOST_TEST_EQ(big::count, 0);
+   {
+      //Move-only callables
+      BOOST_TEST(int_function::is_inline_type<owner>());
+      int_function f(make_owner_function(1));
+      BOOST_TEST_EQ(f(1), 2);
+      BOOST_TEST_EQ(f(1), 3);
+      BOOST_TEST_EQ(owner::count, 1);
+   }
+   BOOST_TEST_EQ(owner::count, 0);
+   {
+      //Argument passing
+      unique_function<void(int&)> inc(increment);
+      int i = 0;
+      inc(i);
+      BOOST_TEST_EQ(i, 1);
+      unique_function<int(unique_ptr<int>)> s((sink()));
+      BOOST_TEST_EQ(s(unique_ptr<int>(new int(5))), 5);
+      //Results are discarded
+      unique_function<void(int)> v((multiplier(2)));
+      v(1);
+   }
+}
+
+void test_exceptions()
+{
+   {
+      throwing t(false);
+      BOOST_TEST_EQ(throwing::count, 1);
+      throwing::count = -1;
+      BOOST_TEST_THROWS(int_function f(t), int);
+      throwing::count = 1;
+   }
+   BOOST_TEST_EQ(throwing::count, 0);
+   {
+      int_function f((multiplier(2)));
+      throwing t(false);
+      throwing::count = -1;
+      BOOST_TEST_THROWS(f = t, int);
+      throwing::count = 1;
+      //Strong guarantee
+      BOOST_TEST_EQ(f(2), 4);
+   }
+   BOOST_TEST_EQ(throwing::count, 0);
+}
+
+void test_move()
+{
+   {
+      //Inline
+      int_function a(make_owner_function(10));
+      int_function b(boost::move(a));
+      BOOST_TEST(!a);
+      BOOST_TEST_EQ(b(1), 11);
+      BOOST_TEST_EQ(owner::count, 1);
+
+      //Heap
+      int_function h((big(100)));
+      int_function h2(boost::move(h));
+      BOOST_TEST(!h);
+      BOOST_TEST_EQ(h2(1), 101);
+      BOOST_TEST_EQ(big::count, 1);
+
+      a = boost::move(h2);
+      BOOST_TEST_EQ(a(2), 102);
+      b.swap(a);
+      BOOST_TEST_EQ(a(0), 11);
+      BOOST_TEST_EQ(b(0), 100);
+      swap(a, b);
+      BOOST_TEST_EQ(b(0), 11);
+
+      a = multiplier(4);
+      BOOST_TEST_EQ(big::count, 0);
+      BOOST_TEST_EQ(a(2), 8);
+      b.reset();
+      BOOST_TEST(!b);
+      BOOST_TEST_EQ(owner::count, 0);
+      a = boost::move(b);
+      BOOST_TEST(!a);
+   }
+   #if !defined(BOOST_NO_CXX11_LAMBDAS)
+   {
+      unique_ptr<int> p(new int(3));
+      int *const raw = p.get();
+      int_function f = [raw](int a) { return *raw + a; };
+      BOOST_TEST(f.is_inline());
+      int_function g(boost::move(f));
+      BOOST_TEST_EQ(g(1), 4);
+   }
+   #endif
+   BOOST_TEST_EQ(owner::count, 0);
+}
+
+int main()
+{
+   test_construction();
+   test_exceptions();
+   test_move();
+   return boost::report_errors();
+}